@@ -64,6 +64,17 @@ public class MixerInteractivity : ModuleRules
 
 			PrivateDependencyModuleNames.Add("OnlineSubsystemUtils");
 		}
+		else if (Target.Platform == UnrealTargetPlatform.Linux)
+		{
+			// No user login flow, but the websocket backend can talk to the loopback:// test services,
+			// which only exist outside of shipping builds.
+			if (Target.Configuration != UnrealTargetConfiguration.Shipping)
+			{
+				SelectedBackend = Backend.UE;
+			}
+
+			AddPublicDefinition("PLATFORM_SUPPORTS_MIXER_OAUTH=0");
+		}
 		else
 		{
 			AddPublicDefinition("PLATFORM_SUPPORTS_MIXER_OAUTH=0");
@@ -14,46 +14,295 @@
 #include "Dom/JsonObject.h"
 #include "JsonObjectConverter.h"
 #include "UObject/UObjectGlobals.h"
+#include "UObject/Package.h"
+#include "UObject/UnrealType.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
 #include "MixerInteractivityLog.h"
 
+namespace
+{
+	using MixerBindingUtils::FParamBindingPlan;
+
+	struct FEventFunction
+	{
+		TWeakObjectPtr<UFunction> Function;
+		/** False for names known not to have a function, so those aren't looked up again either. */
+		bool bFound;
+
+		FEventFunction()
+			: bFound(false)
+		{
+		}
+	};
+
+	TMap<TWeakObjectPtr<UFunction>, TSharedPtr<FParamBindingPlan>> PlansByFunction;
+	TMap<TWeakObjectPtr<UClass>, TMap<FName, FEventFunction>> EventFunctionsByClass;
+
+	bool IsBoundParam(const UProperty* Property)
+	{
+		return !Property->HasAnyPropertyFlags(CPF_OutParm) || Property->HasAnyPropertyFlags(CPF_ReferenceParm);
+	}
+
+	bool SetAnyProperty(UProperty* Property, void* PropertyValue, const TSharedPtr<FJsonValue>& JsonValue)
+	{
+		return FJsonObjectConverter::JsonValueToUProperty(JsonValue, Property, PropertyValue, 0, 0);
+	}
+
+	bool SetNumericProperty(UProperty* Property, void* PropertyValue, const TSharedPtr<FJsonValue>& JsonValue)
+	{
+		if (JsonValue->Type != EJson::Number)
+		{
+			return SetAnyProperty(Property, PropertyValue, JsonValue);
+		}
+
+		UNumericProperty* NumericProperty = static_cast<UNumericProperty*>(Property);
+		if (NumericProperty->IsFloatingPoint())
+		{
+			NumericProperty->SetFloatingPointPropertyValue(PropertyValue, JsonValue->AsNumber());
+		}
+		else
+		{
+			NumericProperty->SetIntPropertyValue(PropertyValue, static_cast<int64>(JsonValue->AsNumber()));
+		}
+		return true;
+	}
+
+	bool SetBoolProperty(UProperty* Property, void* PropertyValue, const TSharedPtr<FJsonValue>& JsonValue)
+	{
+		if (JsonValue->Type != EJson::Boolean)
+		{
+			return SetAnyProperty(Property, PropertyValue, JsonValue);
+		}
+
+		static_cast<UBoolProperty*>(Property)->SetPropertyValue(PropertyValue, JsonValue->AsBool());
+		return true;
+	}
+
+	bool SetStringProperty(UProperty* Property, void* PropertyValue, const TSharedPtr<FJsonValue>& JsonValue)
+	{
+		if (JsonValue->Type != EJson::String)
+		{
+			return SetAnyProperty(Property, PropertyValue, JsonValue);
+		}
+
+		static_cast<UStrProperty*>(Property)->SetPropertyValue(PropertyValue, JsonValue->AsString());
+		return true;
+	}
+}
+
 namespace MixerBindingUtils
 {
-	void ExtractCustomEventParamsFromMessage(const FJsonObject* JsonObject, UFunction* FunctionPrototype, void* ParamStorage, SIZE_T ParamStorageSize)
+	FJsonPropertySetter GetJsonPropertySetter(UProperty* Property)
+	{
+		if (Property->ArrayDim == 1)
+		{
+			UNumericProperty* NumericProperty = Cast<UNumericProperty>(Property);
+			if (NumericProperty != nullptr && !NumericProperty->IsEnum())
+			{
+				return &SetNumericProperty;
+			}
+			else if (Property->IsA<UBoolProperty>())
+			{
+				return &SetBoolProperty;
+			}
+			else if (Property->IsA<UStrProperty>())
+			{
+				return &SetStringProperty;
+			}
+		}
+
+		return &SetAnyProperty;
+	}
+
+	const FParamBindingPlan& FParamBindingPlan::ForFunction(UFunction* FunctionPrototype)
+	{
+		check(FunctionPrototype != nullptr);
+		TSharedPtr<FParamBindingPlan>* ExistingPlan = PlansByFunction.Find(FunctionPrototype);
+		if (ExistingPlan != nullptr)
+		{
+			return **ExistingPlan;
+		}
+
+		TSharedPtr<FParamBindingPlan> NewPlan = MakeShareable(new FParamBindingPlan(FunctionPrototype));
+		PlansByFunction.Add(FunctionPrototype, NewPlan);
+		return *NewPlan;
+	}
+
+	const FParamBindingPlan* FParamBindingPlan::ForEvent(UClass* Class, FName EventName)
+	{
+		check(Class != nullptr);
+		TMap<FName, FEventFunction>& EventFunctions = EventFunctionsByClass.FindOrAdd(Class);
+		FEventFunction* EventFunction = EventFunctions.Find(EventName);
+
+		// A function found before may since have been replaced, e.g. by a Blueprint recompile
+		if (EventFunction == nullptr || (EventFunction->bFound && !EventFunction->Function.IsValid()))
+		{
+			UFunction* Found = Class->FindFunctionByName(EventName);
+			EventFunction = &EventFunctions.Add(EventName);
+			EventFunction->Function = Found;
+			EventFunction->bFound = Found != nullptr;
+		}
+
+		return EventFunction->bFound ? &ForFunction(EventFunction->Function.Get()) : nullptr;
+	}
+
+	void FParamBindingPlan::InvalidateClass(UClass* Class)
+	{
+		EventFunctionsByClass.Remove(Class);
+		for (TMap<TWeakObjectPtr<UFunction>, TSharedPtr<FParamBindingPlan>>::TIterator It(PlansByFunction); It; ++It)
+		{
+			UFunction* Function = It->Key.Get();
+			if (Function == nullptr || Function->GetOuter() == Class)
+			{
+				It.RemoveCurrent();
+			}
+		}
+	}
+
+	FParamBindingPlan::FParamBindingPlan(UFunction* FunctionPrototype)
+		: Function(FunctionPrototype)
 	{
-		check(ParamStorageSize == FunctionPrototype->ParmsSize);
 		for (TFieldIterator<UProperty> PropIt(FunctionPrototype); PropIt && (PropIt->PropertyFlags & CPF_Parm); ++PropIt)
 		{
-			if (!PropIt->HasAnyPropertyFlags(CPF_OutParm) || PropIt->HasAnyPropertyFlags(CPF_ReferenceParm))
+			if (IsBoundParam(*PropIt))
 			{
-				check(static_cast<SIZE_T>(PropIt->GetOffset_ForUFunction() + PropIt->GetSize()) <= ParamStorageSize);
-				void* ThisParamStorage = static_cast<uint8*>(ParamStorage) + PropIt->GetOffset_ForUFunction();
-				PropIt->InitializeValue(ThisParamStorage);
-				TSharedPtr<FJsonValue> F = JsonObject->TryGetField(PropIt->GetName());
-				if (F.IsValid())
-				{
-					if (!FJsonObjectConverter::JsonValueToUProperty(F, *PropIt, ThisParamStorage, 0, 0))
-					{
-						UE_LOG(LogMixerInteractivity, Error, TEXT("Custom event %s: failed to convert Json value %s for parameter %s"), *FunctionPrototype->GetName(), *F->AsString(), *PropIt->GetName());
-					}
-				}
-				else
+				FParam& Param = Params[Params.AddDefaulted()];
+				Param.Property = *PropIt;
+				Param.Offset = PropIt->GetOffset_ForUFunction();
+				Param.Size = PropIt->GetSize();
+				Param.JsonKey = PropIt->GetName();
+				Param.Setter = GetJsonPropertySetter(*PropIt);
+			}
+		}
+	}
+
+	void FParamBindingPlan::ExtractParams(const FJsonObject* JsonObject, void* ParamStorage, SIZE_T ParamStorageSize) const
+	{
+		for (const FParam& Param : Params)
+		{
+			check(static_cast<SIZE_T>(Param.Offset + Param.Size) <= ParamStorageSize);
+			void* ThisParamStorage = static_cast<uint8*>(ParamStorage) + Param.Offset;
+			Param.Property->InitializeValue(ThisParamStorage);
+			const TSharedPtr<FJsonValue>* F = JsonObject != nullptr ? JsonObject->Values.Find(Param.JsonKey) : nullptr;
+			if (F != nullptr && F->IsValid())
+			{
+				if (!Param.Setter(Param.Property, ThisParamStorage, *F))
 				{
-					UE_LOG(LogMixerInteractivity, Error, TEXT("Custom event %s does not contain expected parameter %s"), *FunctionPrototype->GetName(), *PropIt->GetName());
+					UE_LOG(LogMixerInteractivity, Error, TEXT("Custom event %s: failed to convert Json value %s for parameter %s"), *GetNameSafe(GetFunction()), *(*F)->AsString(), *Param.JsonKey);
 				}
 			}
+			else
+			{
+				UE_LOG(LogMixerInteractivity, Error, TEXT("Custom event %s does not contain expected parameter %s"), *GetNameSafe(GetFunction()), *Param.JsonKey);
+			}
 		}
 	}
 
-	void DestroyCustomEventParams(UFunction* FunctionPrototype, void* ParamStorage, SIZE_T ParamStorageSize)
+	void FParamBindingPlan::DestroyParams(void* ParamStorage, SIZE_T ParamStorageSize) const
 	{
-		for (TFieldIterator<UProperty> PropIt(FunctionPrototype); PropIt && (PropIt->PropertyFlags & CPF_Parm); ++PropIt)
+		for (const FParam& Param : Params)
+		{
+			check(static_cast<SIZE_T>(Param.Offset + Param.Size) <= ParamStorageSize);
+			Param.Property->DestroyValue(static_cast<uint8*>(ParamStorage) + Param.Offset);
+		}
+	}
+}
+
+#if !UE_BUILD_SHIPPING
+
+namespace
+{
+	/**
+	* Transient function taking one parameter for each setter: numeric, bool, string, and a struct
+	* that goes through FJsonObjectConverter.
+	*/
+	UFunction* CreateBenchmarkFunction()
+	{
+		UFunction* Function = new (EC_InternalUseOnlyConstructor, GetTransientPackage(), TEXT("MixerBenchmarkCustomMethod"), RF_Transient) UFunction(FObjectInitializer(), nullptr, FUNC_Public);
+
+		// Properties are prepended to the function's children as they're created, so go last to first
+		new (EC_InternalUseOnlyConstructor, Function, TEXT("Where"), RF_Transient) UStructProperty(FObjectInitializer(), EC_CppProperty, 0, CPF_Parm, TBaseStructure<FVector>::Get());
+		new (EC_InternalUseOnlyConstructor, Function, TEXT("Label"), RF_Transient) UStrProperty(FObjectInitializer(), EC_CppProperty, 0, CPF_Parm);
+		new (EC_InternalUseOnlyConstructor, Function, TEXT("bFlag"), RF_Transient) UBoolProperty(FObjectInitializer(), EC_CppProperty, 0, CPF_Parm, 1, sizeof(bool), true);
+		new (EC_InternalUseOnlyConstructor, Function, TEXT("Amount"), RF_Transient) UFloatProperty(FObjectInitializer(), EC_CppProperty, 0, CPF_Parm);
+		new (EC_InternalUseOnlyConstructor, Function, TEXT("Count"), RF_Transient) UIntProperty(FObjectInitializer(), EC_CppProperty, 0, CPF_Parm);
+		Function->StaticLink(true);
+		return Function;
+	}
+
+	/** Compares filling custom method params through a cached FParamBindingPlan against walking the UFunction on every call, as before. */
+	void BenchmarkCustomMethodBinding(const TArray<FString>& Args)
+	{
+		const int32 Iterations = Args.Num() > 0 ? FMath::Max(FCString::Atoi(*Args[0]), 1) : 100000;
+
+		UFunction* Function = CreateBenchmarkFunction();
+		Function->AddToRoot();
+
+		TSharedRef<FJsonObject> Payload = MakeShared<FJsonObject>();
+		Payload->SetNumberField(TEXT("Count"), 42);
+		Payload->SetNumberField(TEXT("Amount"), 0.5);
+		Payload->SetBoolField(TEXT("bFlag"), true);
+		Payload->SetStringField(TEXT("Label"), TEXT("Benchmark"));
+		TSharedRef<FJsonObject> Where = MakeShared<FJsonObject>();
+		Where->SetNumberField(TEXT("x"), 1.0);
+		Where->SetNumberField(TEXT("y"), 2.0);
+		Where->SetNumberField(TEXT("z"), 3.0);
+		Payload->SetObjectField(TEXT("Where"), Where);
+
+		uint8* ParamStorage = static_cast<uint8*>(FMemory::Malloc(Function->ParmsSize, 16));
+
+		const double WalkStart = FPlatformTime::Seconds();
+		for (int32 i = 0; i < Iterations; ++i)
 		{
-			if (!PropIt->HasAnyPropertyFlags(CPF_OutParm) || PropIt->HasAnyPropertyFlags(CPF_ReferenceParm))
+			for (TFieldIterator<UProperty> PropIt(Function); PropIt && (PropIt->PropertyFlags & CPF_Parm); ++PropIt)
+			{
+				if (IsBoundParam(*PropIt))
+				{
+					void* ThisParamStorage = ParamStorage + PropIt->GetOffset_ForUFunction();
+					PropIt->InitializeValue(ThisParamStorage);
+					TSharedPtr<FJsonValue> F = Payload->TryGetField(PropIt->GetName());
+					if (F.IsValid())
+					{
+						FJsonObjectConverter::JsonValueToUProperty(F, *PropIt, ThisParamStorage, 0, 0);
+					}
+				}
+			}
+			for (TFieldIterator<UProperty> PropIt(Function); PropIt && (PropIt->PropertyFlags & CPF_Parm); ++PropIt)
 			{
-				check(static_cast<SIZE_T>(PropIt->GetOffset_ForUFunction() + PropIt->GetSize()) <= ParamStorageSize);
-				void* ThisParamStorage = static_cast<uint8*>(ParamStorage) + PropIt->GetOffset_ForUFunction();
-				PropIt->DestroyValue(ThisParamStorage);
+				if (IsBoundParam(*PropIt))
+				{
+					PropIt->DestroyValue(ParamStorage + PropIt->GetOffset_ForUFunction());
+				}
 			}
 		}
+		const double WalkSeconds = FPlatformTime::Seconds() - WalkStart;
+
+		const double PlanStart = FPlatformTime::Seconds();
+		for (int32 i = 0; i < Iterations; ++i)
+		{
+			const FParamBindingPlan& Plan = FParamBindingPlan::ForFunction(Function);
+			Plan.ExtractParams(&Payload.Get(), ParamStorage, Function->ParmsSize);
+			Plan.DestroyParams(ParamStorage, Function->ParmsSize);
+		}
+		const double PlanSeconds = FPlatformTime::Seconds() - PlanStart;
+
+		FMemory::Free(ParamStorage);
+		PlansByFunction.Remove(Function);
+		Function->RemoveFromRoot();
+		Function->MarkPendingKill();
+
+		UE_LOG(LogMixerInteractivity, Display, TEXT("Custom method binding x%d: per-call walk %.2fms (%.1fns/call), binding plan %.2fms (%.1fns/call), speedup %.1fx"),
+			Iterations,
+			WalkSeconds * 1000.0, WalkSeconds * 1.0e9 / Iterations,
+			PlanSeconds * 1000.0, PlanSeconds * 1.0e9 / Iterations,
+			PlanSeconds > 0.0 ? WalkSeconds / PlanSeconds : 0.0);
 	}
-}
\ No newline at end of file
+
+	FAutoConsoleCommand BenchmarkCustomMethodBindingCommand(
+		TEXT("Mixer.BenchmarkCustomMethodBinding"),
+		TEXT("Time filling custom method parameters from Json with cached binding plans against walking the function each call.  Optional argument: iteration count."),
+		FConsoleCommandWithArgsDelegate::CreateStatic(&BenchmarkCustomMethodBinding));
+}
+
+#endif
@@ -9,13 +9,64 @@
 //*********************************************************
 #pragma once
 
-#include "HAL/Platform.h"
+#include "CoreMinimal.h"
+#include "UObject/WeakObjectPtrTemplates.h"
 
 class UFunction;
+class UProperty;
 class FJsonObject;
+class FJsonValue;
 
 namespace MixerBindingUtils
 {
-	void ExtractCustomEventParamsFromMessage(const FJsonObject* JsonObject, UFunction* FunctionPrototype, void* ParamStorage, SIZE_T ParamStorageSize);
-	void DestroyCustomEventParams(UFunction* FunctionPrototype, void* ParamStorage, SIZE_T ParamStorageSize);
+	/** Sets a property value from Json.  @Return false if the value couldn't be converted. */
+	typedef bool (*FJsonPropertySetter)(UProperty* Property, void* PropertyValue, const TSharedPtr<FJsonValue>& JsonValue);
+
+	/**
+	* @Return	Setter for the property's type.  Scalar and string properties are set directly when the
+	*			Json type matches; anything else goes through FJsonObjectConverter.
+	*/
+	FJsonPropertySetter GetJsonPropertySetter(UProperty* Property);
+
+	/**
+	* How to fill the parameters of a UFunction from the fields of a Json object, worked out once
+	* per function: each parameter's offset, Json key and setter.
+	*/
+	class FParamBindingPlan
+	{
+	public:
+		static const FParamBindingPlan& ForFunction(UFunction* FunctionPrototype);
+
+		/**
+		* Find the UFunction an object of the class would run for the named event, without repeating
+		* the FindFunction lookup on every event.
+		*
+		* @Return	Plan for the function, or nullptr if the class has no such function.
+		*/
+		static const FParamBindingPlan* ForEvent(UClass* Class, FName EventName);
+
+		/** Forget plans and event lookups for a class whose functions may have changed. */
+		static void InvalidateClass(UClass* Class);
+
+		UFunction* GetFunction() const { return Function.Get(); }
+
+		void ExtractParams(const FJsonObject* JsonObject, void* ParamStorage, SIZE_T ParamStorageSize) const;
+		void DestroyParams(void* ParamStorage, SIZE_T ParamStorageSize) const;
+
+	private:
+		struct FParam
+		{
+			UProperty* Property;
+			int32 Offset;
+			int32 Size;
+			FString JsonKey;
+			FJsonPropertySetter Setter;
+		};
+
+		explicit FParamBindingPlan(UFunction* FunctionPrototype);
+
+	private:
+		TWeakObjectPtr<UFunction> Function;
+		TArray<FParam> Params;
+	};
 }
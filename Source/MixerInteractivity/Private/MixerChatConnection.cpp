@@ -12,6 +12,7 @@
 #include "MixerInteractivityModule.h"
 #include "MixerInteractivityTypes.h"
 #include "MixerInteractivityUserSettings.h"
+#include "MixerInteractivitySettings.h"
 #include "OnlineChatMixer.h"
 #include "OnlineChatMixerPrivate.h"
 #include "MixerJsonHelpers.h"
@@ -26,6 +27,7 @@
 #include "WebsocketsModule.h"
 #include "IWebSocket.h"
 #include "OnlineSubsystemTypes.h"
+#include "Containers/Ticker.h"
 
 DEFINE_LOG_CATEGORY(LogMixerChat);
 
@@ -34,22 +36,70 @@ FMixerChatConnection::FMixerChatConnection(FOnlineChatMixer* InChatInterface, co
 	, ChatInterface(InChatInterface)
 	, User(UserId.AsShared())
 	, RoomId(InRoomId)
+	, ChatHistory(10) // @TODO: pull from config once available
 	, ChannelId(0)
-	, ChatHistoryNum(0)
-	, ChatHistoryMax(10) // @TODO: pull from config once available
 	, bIsReady(false)
 	, bRejoinOnDisconnect(Config.bRejoinOnDisconnect)
 {
 	FMemory::Memzero(Permissions);
+
+	const UMixerInteractivitySettings* Settings = GetDefault<UMixerInteractivitySettings>();
+	SetDecodeOnWorkerThread(Settings->bDecodeMessagesOffGameThread);
+	SetSendBudget(Settings->OutgoingBytesPerSecondLimit);
+	SetReplyTimeout(Settings->ReplyTimeoutSeconds);
+	SetTrafficCaptureName(FString::Printf(TEXT("chat-%s"), *RoomId));
+	TickerHandle = FTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FMixerChatConnection::Tick));
 }
 
 FMixerChatConnection::~FMixerChatConnection()
 {
+	if (TickerHandle.IsValid())
+	{
+		FTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+	}
+}
+
+bool FMixerChatConnection::Tick(float DeltaTime)
+{
+	// Handlers may cause the chat interface to release this connection
+	TSharedRef<FMixerChatConnection> KeepAlive = AsShared();
+
+	const UMixerInteractivitySettings* Settings = GetDefault<UMixerInteractivitySettings>();
+	ProcessDecodedMessages(Settings->MessageHandlingBudgetMs / 1000.0);
+	FlushSendQueue();
+	return true;
 }
 
 bool FMixerChatConnection::Init()
 {
 #if WITH_WEBSOCKETS
+	const UMixerInteractivitySettings* Settings = GetDefault<UMixerInteractivitySettings>();
+	if (!Settings->ChatEndpointOverride.IsEmpty())
+	{
+		// No channel or chat server discovery.  Numeric room ids are used as the channel id as-is.
+		ChannelId = FMath::Max(FCString::Atoi(*RoomId), 1);
+		Endpoints.Add(Settings->ChatEndpointOverride);
+		Permissions.bConnect = true;
+		Permissions.bChat = true;
+		Permissions.bWhisper = true;
+		Permissions.bPollStart = true;
+		Permissions.bPollVote = true;
+		Permissions.bClearMessages = true;
+		Permissions.bPurge = true;
+		Permissions.bGiveawayStart = true;
+
+		// The simulated service accepts any key, so let it see the local user
+		if (MixerIsLoopbackUrl(Settings->ChatEndpointOverride))
+		{
+			AuthKey = TEXT("loopback");
+		}
+
+		UE_LOG(LogMixerChat, Verbose, TEXT("Opening web socket to %s for chat room %s"), *Settings->ChatEndpointOverride, *RoomId);
+		TMap<FString, FString> EmptyHeaders;
+		InitConnection(Settings->ChatEndpointOverride, EmptyHeaders);
+		return true;
+	}
+
 	TSharedRef<IHttpRequest> ChannelRequest = FHttpModule::Get().CreateRequest();
 	ChannelRequest->SetVerb(TEXT("GET"));
 	ChannelRequest->SetURL(FString::Printf(TEXT("https://mixer.com/api/v1/channels/%s"), *RoomId));
@@ -222,6 +272,21 @@ void FMixerChatConnection::HandleSocketClosed(bool bWasClean)
 	}
 }
 
+void FMixerChatConnection::HandleReplyTimeout(const FString& MethodName, int32 TimedOutMessageId, FServerMessageHandler Handler)
+{
+	TMixerWebSocketOwnerBase<FMixerChatConnection>::HandleReplyTimeout(MethodName, TimedOutMessageId, Handler);
+
+	if (Handler == &FMixerChatConnection::HandleAuthReply)
+	{
+		// Without an auth reply the room is never joined; treat it like a dropped connection (which may rejoin)
+		UE_LOG(LogMixerChat, Warning, TEXT("Chat auth for %s timed out."), *RoomId);
+		CleanupConnection();
+		HandleSocketClosed(false);
+
+		// Note: we have probably self-destructed at this point
+	}
+}
+
 bool FMixerChatConnection::HandleWelcomeEvent(class FJsonObject* JsonObj)
 {
 	// Welcomed by the server.  We are now fully connected.
@@ -405,24 +470,14 @@ bool FMixerChatConnection::HandleDeleteMessageEvent(FJsonObject* JsonObj)
 		return false;
 	}
 
-	DeleteFromChatHistoryIf([&MessageGuid](TSharedPtr<FChatMessageMixerImpl> ChatMessage)
-	{
-		return ChatMessage->GetMessageId() == MessageGuid;
-	});
+	ChatHistory.Delete(MessageGuid);
 
 	return true;
 }
 
 bool FMixerChatConnection::HandleClearMessagesEvent(FJsonObject* JsonObj)
 {
-	DeleteFromChatHistoryIf([](TSharedPtr<FChatMessageMixerImpl>)
-	{
-		return true;
-	});
-
-	check(ChatHistoryNum == 0);
-	check(!ChatHistoryNewest.IsValid());
-	check(!ChatHistoryOldest.IsValid());
+	ChatHistory.DeleteAll();
 
 	ChatInterface->TriggerOnChatRoomMessagesClearedDelegates(*User, RoomId);
 
@@ -433,10 +488,7 @@ bool FMixerChatConnection::HandlePurgeMessageEvent(FJsonObject* JsonObj)
 {
 	GET_JSON_INT_RETURN_FAILURE(UserIdWithUnderscore, UserId);
 
-	DeleteFromChatHistoryIf([UserId](TSharedPtr<FChatMessageMixerImpl> ChatMessage)
-	{
-		return ChatMessage->GetSender().Id == UserId;
-	});
+	ChatHistory.DeleteAllFrom(UserId);
 
 	ChatInterface->TriggerOnChatRoomUserPurgedDelegates(*User, RoomId, FUniqueNetIdMixer(UserId));
 
@@ -698,17 +750,6 @@ bool FMixerChatConnection::SendVoteChoose(const FChatPollMixer& Poll, int32 Answ
 	return true;
 }
 
-void FMixerChatConnection::GetMessageHistory(int32 NumMessages, TArray< TSharedRef<FChatMessage> >& OutMessages) const
-{
-	TSharedPtr<FChatMessageMixerImpl> ChatMessage = ChatHistoryNewest;
-	while (ChatMessage.IsValid() &&
-		(NumMessages == -1 || OutMessages.Num() < NumMessages))
-	{
-		OutMessages.Add(ChatMessage.ToSharedRef());
-		ChatMessage = ChatMessage->NextLink;
-	}
-}
-
 void FMixerChatConnection::RegisterAllServerMessageHandlers()
 {
 	RegisterServerMessageHandler(MixerStringConstants::EventTypes::Welcome, &FMixerChatConnection::HandleWelcomeEvent);
@@ -724,64 +765,9 @@ void FMixerChatConnection::RegisterAllServerMessageHandlers()
 
 void FMixerChatConnection::AddMessageToChatHistory(TSharedRef<FChatMessageMixerImpl> ChatMessage)
 {
-	if (ChatHistoryMax > 0 && !ChatMessage->IsWhisper())
+	if (!ChatMessage->IsWhisper())
 	{
-		ChatMessage->NextLink = ChatHistoryNewest;
-		if (ChatHistoryNewest.IsValid())
-		{
-			ChatHistoryNewest->PrevLink = ChatMessage;
-		}
-		ChatHistoryNewest = ChatMessage;
-		++ChatHistoryNum;
-		if (!ChatHistoryOldest.IsValid())
-		{
-			ChatHistoryOldest = ChatMessage;
-		}
-		else if (ChatHistoryNum > ChatHistoryMax)
-		{
-			ChatHistoryOldest = ChatHistoryOldest->PrevLink;
-			if (ChatHistoryOldest.IsValid())
-			{
-				check(ChatHistoryOldest->NextLink.IsValid());
-				ChatHistoryOldest->NextLink->PrevLink.Reset();
-				ChatHistoryOldest->NextLink.Reset();
-			}
-			--ChatHistoryNum;
-		}
-	}
-}
-
-void FMixerChatConnection::DeleteFromChatHistoryIf(TFunctionRef<bool(TSharedPtr<FChatMessageMixerImpl>)> Predicate)
-{
-	// @TODO - pass moderator here when available
-	TSharedPtr<FChatMessageMixerImpl> ChatMessage = ChatHistoryNewest;
-	while (ChatMessage.IsValid())
-	{
-		TSharedPtr<FChatMessageMixerImpl> NextMessage = ChatMessage->NextLink;
-		if (Predicate(ChatMessage))
-		{
-			ChatMessage->FlagAsDeleted();
-			if (ChatMessage == ChatHistoryNewest)
-			{
-				ChatHistoryNewest = ChatMessage->NextLink;
-			}
-			if (ChatMessage == ChatHistoryOldest)
-			{
-				ChatHistoryOldest = ChatMessage->PrevLink;
-			}
-			if (ChatMessage->NextLink.IsValid())
-			{
-				ChatMessage->NextLink->PrevLink = ChatMessage->PrevLink;
-			}
-			if (ChatMessage->PrevLink.IsValid())
-			{
-				ChatMessage->PrevLink->NextLink = ChatMessage->NextLink;
-			}
-			ChatMessage->NextLink.Reset();
-			ChatMessage->PrevLink.Reset();
-			--ChatHistoryNum;
-		}
-		ChatMessage = NextMessage;
+		ChatHistory.AddNewest(ChatMessage);
 	}
 }
 
@@ -801,9 +787,9 @@ bool FMixerChatConnection::HandleAuthReply(FJsonObject* JsonObj)
 	else
 	{
 		bIsReady = true;
-		if (ChatHistoryMax > 0)
+		if (ChatHistory.GetCapacity() > 0)
 		{
-			SendMethodMessageArrayParams(MixerStringConstants::MethodNames::History, &FMixerChatConnection::HandleHistoryReply, FMath::Min(ChatHistoryMax, 100));
+			SendMethodMessageArrayParams(MixerStringConstants::MethodNames::History, &FMixerChatConnection::HandleHistoryReply, FMath::Min(ChatHistory.GetCapacity(), 100));
 		}
 		// Maybe we have some interest in roles?
 
@@ -817,74 +803,19 @@ bool FMixerChatConnection::HandleHistoryReply(FJsonObject* JsonObj)
 {
 	GET_JSON_ARRAY_RETURN_FAILURE(Data, Data);
 
-	// Stash the current history and then clear member pointers.
-	// We'll splice what we have back on the front of the history
-	// reported by the server.
-	TSharedPtr<FChatMessageMixerImpl> LocalHistoryNewest = ChatHistoryNewest;
-	TSharedPtr<FChatMessageMixerImpl> LocalHistoryOldest = ChatHistoryOldest;
-	int32 LocalHistoryNum = ChatHistoryNum;
-	int32 LocalHistoryMax = ChatHistoryMax;
-	ChatHistoryNewest.Reset();
-	ChatHistoryOldest.Reset();
-	ChatHistoryNum = 0;
-	ChatHistoryMax = LocalHistoryMax - LocalHistoryNum;
-
-	// Oldest entry is at index 0 as reported by Mixer
-	// Whereas we keep the newest entry at the head of the list,
-	// which is where HandleChatMessagePacket pushes.
-	for (const TSharedPtr<FJsonValue> HistoryEntry : *Data)
+	// Oldest entry is at index 0 as reported by Mixer.  Anything already
+	// held is newer, so fill in behind it working backwards, skipping
+	// messages that also arrived live while the request was in flight.
+	for (int32 i = Data->Num() - 1; i >= 0 && ChatHistory.HasRoomForOlder(); --i)
 	{
 		TSharedPtr<FChatMessageMixerImpl> ChatMessage;
-		if (HandleChatMessageEventInternal(HistoryEntry->AsObject().Get(), ChatMessage))
+		if (HandleChatMessageEventInternal((*Data)[i]->AsObject().Get(), ChatMessage))
 		{
 			check(!ChatMessage->IsWhisper());
-			AddMessageToChatHistory(ChatMessage.ToSharedRef());
+			ChatHistory.AddOldest(ChatMessage.ToSharedRef());
 		}
 	}
 
-	// Relink the history we'd already accumulated.
-	// Possibly our history request crossed paths with some
-	// new messages and we could have some dupes?
-	if (!ChatHistoryNewest.IsValid())
-	{
-		ChatHistoryNewest = LocalHistoryNewest;
-		ChatHistoryOldest = LocalHistoryOldest;
-	}
-	else if (LocalHistoryOldest.IsValid())
-	{
-		int32 DupeCount = 0;
-		FGuid IdToCheckForDupes = LocalHistoryOldest->GetMessageId();
-		TSharedPtr<FChatMessageMixerImpl> ServerHistoryMessage = ChatHistoryNewest;
-		while (ServerHistoryMessage.IsValid())
-		{
-			++DupeCount;
-			if (ServerHistoryMessage->GetMessageId() == IdToCheckForDupes)
-			{
-				break;
-			}
-			ServerHistoryMessage = ServerHistoryMessage->NextLink;
-		}
-
-		if (ServerHistoryMessage.IsValid())
-		{
-			LocalHistoryOldest->NextLink = ServerHistoryMessage->NextLink;
-			if (ServerHistoryMessage->NextLink.IsValid())
-			{
-				ServerHistoryMessage->NextLink->PrevLink = LocalHistoryOldest;
-			}
-			ChatHistoryNum -= DupeCount;
-		}
-		else
-		{
-			LocalHistoryOldest->NextLink = ChatHistoryNewest;
-			ChatHistoryNewest->PrevLink = LocalHistoryOldest;
-		}
-
-		ChatHistoryNewest = LocalHistoryNewest;
-		ChatHistoryNum += LocalHistoryNum;
-		ChatHistoryMax = LocalHistoryMax;
-	}
-
 	return true;
 }
 
@@ -15,6 +15,7 @@
 #include "Interfaces/IHttpResponse.h"
 #include "OnlineChatMixerPrivate.h"
 #include "MixerWebSocketOwnerBase.h"
+#include "MixerChatHistory.h"
 
 DECLARE_LOG_CATEGORY_EXTERN(LogMixerChat, Log, All);
 
@@ -38,7 +39,8 @@ public:
 
 	void SetRejoinOnDisconnect(bool bInRejoin)	{ bRejoinOnDisconnect = bInRejoin; }
 
-	void GetMessageHistory(int32 NumMessages, TArray<TSharedRef<FChatMessage>>& OutMessages) const;
+	/** Recent room messages, newest first when iterated. */
+	const FMixerChatHistory& GetMessageHistory() const	{ return ChatHistory; }
 
 	void GetAllCachedUsers(TArray< TSharedRef<FChatRoomMember> >& OutUsers) const;
 
@@ -51,9 +53,12 @@ protected:
 	virtual void HandleSocketConnected();
 	virtual void HandleSocketConnectionError();
 	virtual void HandleSocketClosed(bool bWasClean);
+	virtual void HandleReplyTimeout(const FString& MethodName, int32 TimedOutMessageId, FServerMessageHandler Handler);
 
 private:
 
+	bool Tick(float DeltaTime);
+
 	void JoinDiscoveredChatChannel();
 
 	void OnGetChannelInfoForRoomIdComplete(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded);
@@ -76,7 +81,6 @@ private:
 	bool UpdateActivePollFromServer(class FJsonObject* JsonObj, bool& bOutAnythingChanged);
 
 	void AddMessageToChatHistory(TSharedRef<struct FChatMessageMixerImpl> ChatMessage);
-	void DeleteFromChatHistoryIf(TFunctionRef<bool(TSharedPtr<FChatMessageMixerImpl>)> Predicate);
 
 private:
 	bool HandleAuthReply(class FJsonObject* JsonObj);
@@ -90,13 +94,11 @@ private:
 	TArray<FString> Endpoints;
 	TMap<FUniqueNetIdMixer, TSharedPtr<FMixerChatUser>> CachedUsers;
 	TSharedPtr<struct FChatPollMixerImpl> ActivePoll;
-	TSharedPtr<struct FChatMessageMixerImpl> ChatHistoryNewest;
-	TSharedPtr<struct FChatMessageMixerImpl> ChatHistoryOldest;
-	int32 ChatHistoryNum;
-	int32 ChatHistoryMax;
+	FMixerChatHistory ChatHistory;
 	int32 ChannelId;
 	bool bIsReady;
 	bool bRejoinOnDisconnect;
+	FDelegateHandle TickerHandle;
 
 	struct
 	{
@@ -0,0 +1,171 @@
+//*********************************************************
+//
+// Copyright (c) Microsoft. All rights reserved.
+// THIS CODE IS PROVIDED *AS IS* WITHOUT WARRANTY OF
+// ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING ANY
+// IMPLIED WARRANTIES OF FITNESS FOR A PARTICULAR
+// PURPOSE, MERCHANTABILITY, OR NON-INFRINGEMENT.
+//
+//*********************************************************
+#include "MixerChatHistory.h"
+#include "OnlineChatMixerPrivate.h"
+
+FMixerChatHistory::FMixerChatHistory(int32 Capacity)
+	: OldestSlot(0)
+	, NumSlotsUsed(0)
+	, NumMessages(0)
+{
+	Slots.SetNum(FMath::Max(Capacity, 0));
+}
+
+bool FMixerChatHistory::AddNewest(const TSharedRef<FChatMessageMixerImpl>& Message)
+{
+	if (Slots.Num() == 0 || Contains(Message->GetMessageId()))
+	{
+		return false;
+	}
+
+	if (NumSlotsUsed == Slots.Num())
+	{
+		if (Slots[OldestSlot].Message.IsValid())
+		{
+			EmptySlot(OldestSlot);
+		}
+		OldestSlot = SlotIndexAt(1);
+		--NumSlotsUsed;
+	}
+
+	FillSlot(SlotIndexAt(NumSlotsUsed), Message);
+	++NumSlotsUsed;
+	return true;
+}
+
+bool FMixerChatHistory::AddOldest(const TSharedRef<FChatMessageMixerImpl>& Message)
+{
+	if (!HasRoomForOlder() || Contains(Message->GetMessageId()))
+	{
+		return false;
+	}
+
+	OldestSlot = SlotIndexAt(Slots.Num() - 1);
+	FillSlot(OldestSlot, Message);
+	++NumSlotsUsed;
+	return true;
+}
+
+bool FMixerChatHistory::Delete(const FGuid& MessageId)
+{
+	const int32* SlotIndex = SlotsById.Find(MessageId);
+	if (SlotIndex == nullptr)
+	{
+		return false;
+	}
+
+	// @TODO - pass moderator here when available
+	Slots[*SlotIndex].Message->FlagAsDeleted();
+	EmptySlot(*SlotIndex);
+	TrimEmptyEnds();
+	return true;
+}
+
+int32 FMixerChatHistory::DeleteAllFrom(int32 SenderId)
+{
+	const int32* FirstSlot = FirstSlotBySender.Find(SenderId);
+	if (FirstSlot == nullptr)
+	{
+		return 0;
+	}
+
+	int32 NumDeleted = 0;
+	for (int32 SlotIndex = *FirstSlot; SlotIndex != INDEX_NONE; )
+	{
+		const int32 NextSlot = Slots[SlotIndex].NextFromSender;
+		Slots[SlotIndex].Message->FlagAsDeleted();
+		EmptySlot(SlotIndex);
+		++NumDeleted;
+		SlotIndex = NextSlot;
+	}
+
+	TrimEmptyEnds();
+	return NumDeleted;
+}
+
+void FMixerChatHistory::DeleteAll()
+{
+	for (FSlot& Slot : Slots)
+	{
+		if (Slot.Message.IsValid())
+		{
+			Slot.Message->FlagAsDeleted();
+		}
+		Slot = FSlot();
+	}
+
+	SlotsById.Empty();
+	FirstSlotBySender.Empty();
+	OldestSlot = 0;
+	NumSlotsUsed = 0;
+	NumMessages = 0;
+}
+
+void FMixerChatHistory::FillSlot(int32 SlotIndex, const TSharedRef<FChatMessageMixerImpl>& Message)
+{
+	FSlot& Slot = Slots[SlotIndex];
+	check(!Slot.Message.IsValid());
+	Slot.Message = Message;
+
+	const int32 SenderId = Message->GetSender().Id;
+	const int32* FirstSlot = FirstSlotBySender.Find(SenderId);
+	Slot.PrevFromSender = INDEX_NONE;
+	Slot.NextFromSender = FirstSlot != nullptr ? *FirstSlot : INDEX_NONE;
+	if (FirstSlot != nullptr)
+	{
+		Slots[*FirstSlot].PrevFromSender = SlotIndex;
+	}
+	FirstSlotBySender.Add(SenderId, SlotIndex);
+
+	SlotsById.Add(Message->GetMessageId(), SlotIndex);
+	++NumMessages;
+}
+
+void FMixerChatHistory::EmptySlot(int32 SlotIndex)
+{
+	FSlot& Slot = Slots[SlotIndex];
+	check(Slot.Message.IsValid());
+
+	if (Slot.PrevFromSender != INDEX_NONE)
+	{
+		Slots[Slot.PrevFromSender].NextFromSender = Slot.NextFromSender;
+	}
+	else if (Slot.NextFromSender != INDEX_NONE)
+	{
+		FirstSlotBySender.FindChecked(Slot.Message->GetSender().Id) = Slot.NextFromSender;
+	}
+	else
+	{
+		FirstSlotBySender.Remove(Slot.Message->GetSender().Id);
+	}
+
+	if (Slot.NextFromSender != INDEX_NONE)
+	{
+		Slots[Slot.NextFromSender].PrevFromSender = Slot.PrevFromSender;
+	}
+
+	SlotsById.Remove(Slot.Message->GetMessageId());
+	Slot = FSlot();
+	--NumMessages;
+}
+
+void FMixerChatHistory::TrimEmptyEnds()
+{
+	while (NumSlotsUsed > 0 && !Slots[SlotIndexAt(NumSlotsUsed - 1)].Message.IsValid())
+	{
+		--NumSlotsUsed;
+	}
+
+	while (NumSlotsUsed > 0 && !Slots[OldestSlot].Message.IsValid())
+	{
+		OldestSlot = SlotIndexAt(1);
+		--NumSlotsUsed;
+	}
+}
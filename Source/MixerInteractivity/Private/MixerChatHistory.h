@@ -0,0 +1,129 @@
+//*********************************************************
+//
+// Copyright (c) Microsoft. All rights reserved.
+// THIS CODE IS PROVIDED *AS IS* WITHOUT WARRANTY OF
+// ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING ANY
+// IMPLIED WARRANTIES OF FITNESS FOR A PARTICULAR
+// PURPOSE, MERCHANTABILITY, OR NON-INFRINGEMENT.
+//
+//*********************************************************
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Misc/Guid.h"
+
+struct FChatMessageMixerImpl;
+
+/**
+* The most recent messages in a chat room, held in a fixed number of slots used as a ring.
+*
+* Messages are indexed by id, and each slot also links to the other slots holding messages from
+* the same sender, so deleting a single message costs the same however much history is held and
+* purging a user only visits that user's messages.  A deleted message leaves an empty slot in
+* place until the ring wraps around to it (or it reaches either end of the history).
+*/
+class FMixerChatHistory
+{
+public:
+	explicit FMixerChatHistory(int32 Capacity);
+
+	int32 GetCapacity() const	{ return Slots.Num(); }
+	int32 Num() const			{ return NumMessages; }
+
+	/** Whether AddOldest would find room. */
+	bool HasRoomForOlder() const	{ return NumSlotsUsed < Slots.Num(); }
+
+	bool Contains(const FGuid& MessageId) const	{ return SlotsById.Contains(MessageId); }
+
+	/**
+	* Add a message newer than any held, dropping the oldest if every slot is in use.
+	* @Return	False if there is no history or the message is already held.
+	*/
+	bool AddNewest(const TSharedRef<FChatMessageMixerImpl>& Message);
+
+	/**
+	* Add a message older than any held, e.g. from the history the service reports on joining.
+	* @Return	False if there is no room or the message is already held.
+	*/
+	bool AddOldest(const TSharedRef<FChatMessageMixerImpl>& Message);
+
+	/** Flag the message as deleted and drop it from the history.  @Return Whether it was held. */
+	bool Delete(const FGuid& MessageId);
+
+	/** As Delete, for every message from one user.  @Return The number deleted. */
+	int32 DeleteAllFrom(int32 SenderId);
+
+	/** As Delete, for every message. */
+	void DeleteAll();
+
+	/** Visits the held messages in place, newest first. */
+	class FConstIterator
+	{
+	public:
+		explicit FConstIterator(const FMixerChatHistory& InHistory)
+			: History(InHistory)
+			, Offset(InHistory.NumSlotsUsed - 1)
+		{
+			SkipEmptySlots();
+		}
+
+		explicit operator bool() const					{ return Offset >= 0; }
+		TSharedRef<FChatMessageMixerImpl> operator*() const	{ return History.SlotAt(Offset).Message.ToSharedRef(); }
+		FChatMessageMixerImpl* operator->() const		{ return History.SlotAt(Offset).Message.Get(); }
+
+		FConstIterator& operator++()
+		{
+			--Offset;
+			SkipEmptySlots();
+			return *this;
+		}
+
+	private:
+		void SkipEmptySlots()
+		{
+			while (Offset >= 0 && !History.SlotAt(Offset).Message.IsValid())
+			{
+				--Offset;
+			}
+		}
+
+		const FMixerChatHistory& History;
+		/** Position relative to the oldest used slot. */
+		int32 Offset;
+	};
+
+	FConstIterator CreateConstIterator() const	{ return FConstIterator(*this); }
+
+private:
+	struct FSlot
+	{
+		TSharedPtr<FChatMessageMixerImpl> Message;
+		int32 PrevFromSender;
+		int32 NextFromSender;
+
+		FSlot()
+			: PrevFromSender(INDEX_NONE)
+			, NextFromSender(INDEX_NONE)
+		{
+		}
+	};
+
+	int32 SlotIndexAt(int32 Offset) const	{ return (OldestSlot + Offset) % Slots.Num(); }
+	const FSlot& SlotAt(int32 Offset) const	{ return Slots[SlotIndexAt(Offset)]; }
+
+	void FillSlot(int32 SlotIndex, const TSharedRef<FChatMessageMixerImpl>& Message);
+	void EmptySlot(int32 SlotIndex);
+
+	/** Stop counting empty slots at either end of the history as used. */
+	void TrimEmptyEnds();
+
+private:
+	TArray<FSlot> Slots;
+	TMap<FGuid, int32> SlotsById;
+	/** Most recently filled slot for each sender, heading the chain through FSlot::NextFromSender. */
+	TMap<int32, int32> FirstSlotBySender;
+	int32 OldestSlot;
+	/** Slots from OldestSlot onwards that hold a message or a gap left by a deleted one. */
+	int32 NumSlotsUsed;
+	int32 NumMessages;
+};
@@ -0,0 +1,157 @@
+//*********************************************************
+//
+// Copyright (c) Microsoft. All rights reserved.
+// THIS CODE IS PROVIDED *AS IS* WITHOUT WARRANTY OF
+// ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING ANY
+// IMPLIED WARRANTIES OF FITNESS FOR A PARTICULAR
+// PURPOSE, MERCHANTABILITY, OR NON-INFRINGEMENT.
+//
+//*********************************************************
+#include "MixerControlDirectory.h"
+#include "Containers/StringConv.h"
+
+namespace
+{
+	const int32 MinBuckets = 64;
+
+	bool KeysEqual(const ANSICHAR* StoredKey, const ANSICHAR* Key, int32 Length)
+	{
+		return FMemory::Memcmp(StoredKey, Key, Length) == 0;
+	}
+
+	/** Key must be ASCII, which is encoded the same in UTF-8. */
+	bool KeysEqual(const ANSICHAR* StoredKey, const TCHAR* Key, int32 Length)
+	{
+		for (int32 i = 0; i < Length; ++i)
+		{
+			if (static_cast<uint8>(StoredKey[i]) != static_cast<uint32>(Key[i]))
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+}
+
+void FMixerControlDirectory::Add(const FString& ControlId, EMixerControlKind Kind, int32 Index)
+{
+	FTCHARToUTF8 Utf8ControlId(*ControlId, ControlId.Len());
+	const ANSICHAR* Key = reinterpret_cast<const ANSICHAR*>(Utf8ControlId.Get());
+	const int32 Length = Utf8ControlId.Length();
+	const uint32 Hash = HashKey(Key, Length);
+
+	if ((Entries.Num() + 1) * 2 > Buckets.Num())
+	{
+		Rehash(FMath::Max(Buckets.Num() * 2, MinBuckets));
+	}
+
+	const int32 Bucket = FindBucket(Key, Length, Hash);
+	if (Buckets[Bucket] != INDEX_NONE)
+	{
+		Entries[Buckets[Bucket]].Entry = FMixerControlDirectoryEntry(Kind, Index);
+		return;
+	}
+
+	FEntryWithKey& NewEntry = Entries[Entries.AddUninitialized()];
+	NewEntry.Entry = FMixerControlDirectoryEntry(Kind, Index);
+	NewEntry.Hash = Hash;
+	NewEntry.KeyOffset = KeyPool.Num();
+	NewEntry.KeyLength = Length;
+	KeyPool.Append(Key, Length);
+
+	Buckets[Bucket] = Entries.Num() - 1;
+}
+
+FMixerControlDirectoryEntry FMixerControlDirectory::Find(const ANSICHAR* Utf8ControlId, int32 Length) const
+{
+	if (Entries.Num() == 0)
+	{
+		return FMixerControlDirectoryEntry();
+	}
+
+	const int32 Bucket = FindBucket(Utf8ControlId, Length, HashKey(Utf8ControlId, Length));
+	return Buckets[Bucket] != INDEX_NONE ? Entries[Buckets[Bucket]].Entry : FMixerControlDirectoryEntry();
+}
+
+FMixerControlDirectoryEntry FMixerControlDirectory::Find(const TCHAR* ControlId, int32 Length) const
+{
+	if (Entries.Num() == 0)
+	{
+		return FMixerControlDirectoryEntry();
+	}
+
+	for (int32 i = 0; i < Length; ++i)
+	{
+		if (static_cast<uint32>(ControlId[i]) >= 0x80)
+		{
+			// Control ids are short, so this converts on the stack
+			FTCHARToUTF8 Utf8ControlId(ControlId, Length);
+			return Find(reinterpret_cast<const ANSICHAR*>(Utf8ControlId.Get()), Utf8ControlId.Length());
+		}
+	}
+
+	const int32 Bucket = FindBucket(ControlId, Length, HashKey(ControlId, Length));
+	return Buckets[Bucket] != INDEX_NONE ? Entries[Buckets[Bucket]].Entry : FMixerControlDirectoryEntry();
+}
+
+void FMixerControlDirectory::Empty()
+{
+	Entries.Empty();
+	Buckets.Empty();
+	KeyPool.Empty();
+}
+
+template <typename CharType>
+uint32 FMixerControlDirectory::HashKey(const CharType* Key, int32 Length)
+{
+	// FNV-1a
+	uint32 Hash = 2166136261u;
+	for (int32 i = 0; i < Length; ++i)
+	{
+		Hash = (Hash ^ static_cast<uint8>(Key[i])) * 16777619u;
+	}
+	return Hash;
+}
+
+template <typename CharType>
+int32 FMixerControlDirectory::FindBucket(const CharType* Key, int32 Length, uint32 Hash) const
+{
+	const int32 BucketMask = Buckets.Num() - 1;
+	int32 Bucket = Hash & BucketMask;
+	for (;;)
+	{
+		const int32 EntryIndex = Buckets[Bucket];
+		if (EntryIndex == INDEX_NONE)
+		{
+			return Bucket;
+		}
+
+		const FEntryWithKey& Existing = Entries[EntryIndex];
+		if (Existing.Hash == Hash
+			&& Existing.KeyLength == Length
+			&& KeysEqual(KeyPool.GetData() + Existing.KeyOffset, Key, Length))
+		{
+			return Bucket;
+		}
+
+		// Never full, so this terminates
+		Bucket = (Bucket + 1) & BucketMask;
+	}
+}
+
+void FMixerControlDirectory::Rehash(int32 NumBuckets)
+{
+	check(FMath::IsPowerOfTwo(NumBuckets));
+	Buckets.Init(INDEX_NONE, NumBuckets);
+
+	const int32 BucketMask = NumBuckets - 1;
+	for (int32 EntryIndex = 0; EntryIndex < Entries.Num(); ++EntryIndex)
+	{
+		int32 Bucket = Entries[EntryIndex].Hash & BucketMask;
+		while (Buckets[Bucket] != INDEX_NONE)
+		{
+			Bucket = (Bucket + 1) & BucketMask;
+		}
+		Buckets[Bucket] = EntryIndex;
+	}
+}
@@ -0,0 +1,98 @@
+//*********************************************************
+//
+// Copyright (c) Microsoft. All rights reserved.
+// THIS CODE IS PROVIDED *AS IS* WITHOUT WARRANTY OF
+// ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING ANY
+// IMPLIED WARRANTIES OF FITNESS FOR A PARTICULAR
+// PURPOSE, MERCHANTABILITY, OR NON-INFRINGEMENT.
+//
+//*********************************************************
+#pragma once
+
+#include "CoreMinimal.h"
+
+enum class EMixerControlKind : uint8
+{
+	None,
+	Button,
+	Stick,
+	Label,
+	Textbox,
+};
+
+/** What a control id refers to.  Index is a handle index for the control table of that kind. */
+struct FMixerControlDirectoryEntry
+{
+	EMixerControlKind Kind;
+	int32 Index;
+
+	FMixerControlDirectoryEntry()
+		: Kind(EMixerControlKind::None)
+		, Index(INDEX_NONE)
+	{
+	}
+
+	FMixerControlDirectoryEntry(EMixerControlKind InKind, int32 InIndex)
+		: Kind(InKind)
+		, Index(InIndex)
+	{
+	}
+};
+
+/**
+* Every control in the current session, keyed by its id exactly as it appears on the wire.
+*
+* Ids are stored UTF-8 encoded in a single pool and found with one probe of an open-addressed
+* hash table, so incoming input can be routed to a control of any kind straight from the raw
+* message text without creating an FName.  Unlike FName, matching is case sensitive, which is
+* how the service treats control ids.
+*/
+class FMixerControlDirectory
+{
+public:
+	/** Add a control, replacing any existing entry with the same id. */
+	void Add(const FString& ControlId, EMixerControlKind Kind, int32 Index);
+
+	/** @Return	The entry for the UTF-8 encoded id, or one of kind None if there isn't one. */
+	FMixerControlDirectoryEntry Find(const ANSICHAR* Utf8ControlId, int32 Length) const;
+
+	/**
+	* @Return	The entry for the id, or one of kind None if there isn't one.  Ids that are plain ASCII,
+	*			as they almost always are, are matched in place without converting to UTF-8.
+	*/
+	FMixerControlDirectoryEntry Find(const TCHAR* ControlId, int32 Length) const;
+
+	/** @Return	The entry for the id, or one of kind None if there isn't one. */
+	FMixerControlDirectoryEntry Find(const FString& ControlId) const { return Find(*ControlId, ControlId.Len()); }
+
+	int32 Num() const { return Entries.Num(); }
+
+	void Empty();
+
+private:
+	struct FEntryWithKey
+	{
+		FMixerControlDirectoryEntry Entry;
+		uint32 Hash;
+		int32 KeyOffset;
+		int32 KeyLength;
+	};
+
+	/** CharType is ANSICHAR for UTF-8 keys, or TCHAR for keys known to be ASCII. */
+	template <typename CharType>
+	static uint32 HashKey(const CharType* Key, int32 Length);
+
+	/** @Return	Bucket holding the key, or the empty bucket where it would go. */
+	template <typename CharType>
+	int32 FindBucket(const CharType* Key, int32 Length, uint32 Hash) const;
+
+	void Rehash(int32 NumBuckets);
+
+private:
+	TArray<FEntryWithKey> Entries;
+
+	/** Index into Entries, or INDEX_NONE for an empty bucket.  Always a power of two in size and at most half full. */
+	TArray<int32> Buckets;
+
+	TArray<ANSICHAR> KeyPool;
+};
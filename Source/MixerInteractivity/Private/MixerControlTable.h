@@ -0,0 +1,120 @@
+//*********************************************************
+//
+// Copyright (c) Microsoft. All rights reserved.
+// THIS CODE IS PROVIDED *AS IS* WITHOUT WARRANTY OF
+// ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING ANY
+// IMPLIED WARRANTIES OF FITNESS FOR A PARTICULAR
+// PURPOSE, MERCHANTABILITY, OR NON-INFRINGEMENT.
+//
+//*********************************************************
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+* Cached records for one kind of control, stored contiguously and addressed by dense index.
+*
+* A name is assigned an index the first time it is seen, whether from the scenes of a session
+* or from game code resolving a handle, and keeps it until the table is destroyed.  Emptying
+* the table between sessions only drops the records, so handles resolved earlier still refer
+* to the same controls once the next session repopulates it.
+*/
+template <typename RecordType>
+class TMixerControlTable
+{
+public:
+	TMixerControlTable()
+		: NumPresent(0)
+	{
+	}
+
+	/** @Return	Index for the name, assigning a new one if the name hasn't been seen before. */
+	int32 Resolve(FName Name)
+	{
+		const int32* ExistingIndex = IndicesByName.Find(Name);
+		if (ExistingIndex != nullptr)
+		{
+			return *ExistingIndex;
+		}
+
+		const int32 NewIndex = Records.AddDefaulted();
+		Names.Add(Name);
+		Present.Add(false);
+		IndicesByName.Add(Name, NewIndex);
+		return NewIndex;
+	}
+
+	/** @Return	Index for the name, or INDEX_NONE if it hasn't been seen. */
+	int32 FindIndex(FName Name) const
+	{
+		const int32* ExistingIndex = IndicesByName.Find(Name);
+		return ExistingIndex != nullptr ? *ExistingIndex : INDEX_NONE;
+	}
+
+	/**
+	* Add or replace the record for a control.
+	*
+	* @Return	Index of the record.
+	*/
+	int32 Add(FName Name, const RecordType& Record)
+	{
+		const int32 Index = Resolve(Name);
+		Records[Index] = Record;
+		if (!Present[Index])
+		{
+			Present[Index] = true;
+			++NumPresent;
+		}
+		return Index;
+	}
+
+	/** @Return	The record at the index, or nullptr if there isn't one in the current session. */
+	RecordType* Get(int32 Index)
+	{
+		return Present.IsValidIndex(Index) && Present[Index] ? &Records[Index] : nullptr;
+	}
+
+	RecordType* Find(FName Name)
+	{
+		return Get(FindIndex(Name));
+	}
+
+	FName GetName(int32 Index) const
+	{
+		return Names.IsValidIndex(Index) ? Names[Index] : NAME_None;
+	}
+
+	/** Number of controls with records. */
+	int32 Num() const
+	{
+		return NumPresent;
+	}
+
+	/** Drop every record, keeping the assignment of names to indices. */
+	void Empty()
+	{
+		for (TConstSetBitIterator<> It(Present); It; ++It)
+		{
+			Records[It.GetIndex()] = RecordType();
+		}
+		Present.Init(false, Present.Num());
+		NumPresent = 0;
+	}
+
+	/** Call Func(RecordType&) for each control with a record. */
+	template <typename FuncType>
+	void ForEach(FuncType Func)
+	{
+		for (TConstSetBitIterator<> It(Present); It; ++It)
+		{
+			Func(Records[It.GetIndex()]);
+		}
+	}
+
+private:
+	TArray<RecordType> Records;
+	TArray<FName> Names;
+	TBitArray<> Present;
+	TMap<FName, int32> IndicesByName;
+	int32 NumPresent;
+};
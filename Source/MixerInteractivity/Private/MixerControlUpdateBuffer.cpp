@@ -0,0 +1,272 @@
+//*********************************************************
+//
+// Copyright (c) Microsoft. All rights reserved.
+// THIS CODE IS PROVIDED *AS IS* WITHOUT WARRANTY OF
+// ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING ANY
+// IMPLIED WARRANTIES OF FITNESS FOR A PARTICULAR
+// PURPOSE, MERCHANTABILITY, OR NON-INFRINGEMENT.
+//
+//*********************************************************
+#include "MixerControlUpdateBuffer.h"
+#include "MixerJsonHelpers.h"
+#include "MixerJsonWriter.h"
+#include "Dom/JsonValue.h"
+#include "Dom/JsonObject.h"
+
+namespace
+{
+	void WriteJsonValue(FMixerJsonUtf8Writer& Writer, const TSharedPtr<FJsonValue>& Value)
+	{
+		const EJson Type = Value.IsValid() ? Value->Type : EJson::Null;
+		switch (Type)
+		{
+		case EJson::String:
+			Writer.WriteValue(Value->AsString());
+			break;
+
+		case EJson::Number:
+			Writer.WriteValue(Value->AsNumber());
+			break;
+
+		case EJson::Boolean:
+			Writer.WriteValue(Value->AsBool());
+			break;
+
+		case EJson::Array:
+			Writer.BeginArray();
+			for (const TSharedPtr<FJsonValue>& Element : Value->AsArray())
+			{
+				WriteJsonValue(Writer, Element);
+			}
+			Writer.EndArray();
+			break;
+
+		case EJson::Object:
+			Writer.BeginObject();
+			for (const TPair<FString, TSharedPtr<FJsonValue>>& Field : Value->AsObject()->Values)
+			{
+				Writer.WriteKey(Field.Key);
+				WriteJsonValue(Writer, Field.Value);
+			}
+			Writer.EndObject();
+			break;
+
+		default:
+			Writer.WriteNull();
+			break;
+		}
+	}
+
+	bool IsSameValue(const TSharedPtr<FJsonValue>& A, const TSharedPtr<FJsonValue>& B)
+	{
+		if (!A.IsValid() || !B.IsValid())
+		{
+			return A.IsValid() == B.IsValid();
+		}
+		return FJsonValue::CompareEqual(*A, *B);
+	}
+
+	bool IsWithinTolerance(float Tolerance, const TSharedPtr<FJsonValue>& LastSent, const TSharedPtr<FJsonValue>& NewValue)
+	{
+		if (IsSameValue(LastSent, NewValue))
+		{
+			return true;
+		}
+
+		return Tolerance > 0.0f
+			&& LastSent.IsValid() && LastSent->Type == EJson::Number
+			&& NewValue.IsValid() && NewValue->Type == EJson::Number
+			&& FMath::Abs(NewValue->AsNumber() - LastSent->AsNumber()) <= Tolerance;
+	}
+}
+
+void FMixerControlUpdateBuffer::SetLimits(float MaxSceneUpdatesPerSecond, float MaxControlUpdatesPerSecond, int32 InBytesPerSecond)
+{
+	MinSceneInterval = MaxSceneUpdatesPerSecond > 0.0f ? 1.0 / MaxSceneUpdatesPerSecond : 0.0;
+	MinControlInterval = MaxControlUpdatesPerSecond > 0.0f ? 1.0 / MaxControlUpdatesPerSecond : 0.0;
+	BytesPerSecond = FMath::Max(InBytesPerSecond, 0);
+	ByteBudgetAvailable = BytesPerSecond;
+	LastByteBudgetRefillTime = 0.0;
+}
+
+void FMixerControlUpdateBuffer::SetPropertyRule(const FString& PropertyName, float Tolerance, bool bUrgent)
+{
+	FPropertyRule& Rule = PropertyRules.FindOrAdd(PropertyName);
+	Rule.Tolerance = FMath::Max(Tolerance, 0.0f);
+	Rule.bUrgent = bUrgent;
+}
+
+void FMixerControlUpdateBuffer::Set(FName SceneName, FName ControlName, const FJsonObject& Properties)
+{
+	FSceneState& Scene = Scenes.FindOrAdd(SceneName);
+	const int32 ControlIndex = FindOrAddControl(Scene, ControlName);
+	FControlState& Control = Scene.Controls[ControlIndex];
+
+	for (const TPair<FString, TSharedPtr<FJsonValue>>& Property : Properties.Values)
+	{
+		if (Property.Key == MixerStringConstants::FieldNames::ControlId)
+		{
+			continue;
+		}
+
+		const FPropertyRule* Rule = PropertyRules.Find(Property.Key);
+		const TSharedPtr<FJsonValue>* LastSent = Control.LastSent.Find(Property.Key);
+		if (LastSent != nullptr && IsWithinTolerance(Rule != nullptr ? Rule->Tolerance : 0.0f, *LastSent, Property.Value))
+		{
+			// The service already has this value or close enough, so any other value queued since the last send is moot too
+			Control.Pending.Remove(Property.Key);
+			continue;
+		}
+
+		Control.Pending.Add(Property.Key, Property.Value);
+		Control.bUrgent |= Rule != nullptr && Rule->bUrgent;
+		if (!Control.bQueued)
+		{
+			Control.bQueued = true;
+			Scene.Queued.Add(ControlIndex);
+			++NumQueuedControls;
+		}
+	}
+}
+
+void FMixerControlUpdateBuffer::Acknowledge(FName SceneName, FName ControlName, const FJsonObject& Properties)
+{
+	FSceneState& Scene = Scenes.FindOrAdd(SceneName);
+	FControlState& Control = Scene.Controls[FindOrAddControl(Scene, ControlName)];
+	for (const TPair<FString, TSharedPtr<FJsonValue>>& Property : Properties.Values)
+	{
+		if (Property.Key != MixerStringConstants::FieldNames::ControlId)
+		{
+			Control.LastSent.Add(Property.Key, Property.Value);
+		}
+	}
+}
+
+void FMixerControlUpdateBuffer::Flush(double Now, bool bUrgentOnly, TFunctionRef<FString(FName)> SceneIdForName, TFunctionRef<void(FName, const ANSICHAR*, int32, bool)> Send)
+{
+	if (NumQueuedControls == 0)
+	{
+		return;
+	}
+
+	if (BytesPerSecond > 0)
+	{
+		// Allow at most a second's worth of burst
+		ByteBudgetAvailable = FMath::Min(ByteBudgetAvailable + (Now - LastByteBudgetRefillTime) * BytesPerSecond, static_cast<double>(BytesPerSecond));
+		LastByteBudgetRefillTime = Now;
+	}
+
+	TArray<int32> StillQueued;
+	for (TMap<FName, FSceneState>::TIterator It(Scenes); It; ++It)
+	{
+		FSceneState& Scene = It->Value;
+		if (Scene.Queued.Num() == 0)
+		{
+			continue;
+		}
+
+		const bool bSceneDue = !bUrgentOnly && Now >= Scene.NextSendTime && (BytesPerSecond == 0 || ByteBudgetAvailable > 0.0);
+		const bool bAnyUrgent = Scene.Queued.ContainsByPredicate([&Scene](int32 ControlIndex) { return Scene.Controls[ControlIndex].bUrgent; });
+		if (!bSceneDue && !bAnyUrgent)
+		{
+			continue;
+		}
+
+		// Urgent changes go in a message of their own, regardless of limits, so that they
+		// can be sent ahead of cosmetic updates rather than waiting in line with them
+		const FString SceneId = SceneIdForName(It->Key);
+		if (bAnyUrgent && WriteSceneUpdate(Scene, SceneId, Now, true))
+		{
+			ByteBudgetAvailable -= ParamsScratch.Num() - 1;
+			Send(It->Key, ParamsScratch.GetData(), ParamsScratch.Num() - 1, true);
+		}
+
+		if (bSceneDue && WriteSceneUpdate(Scene, SceneId, Now, false))
+		{
+			Scene.NextSendTime = Now + MinSceneInterval;
+			ByteBudgetAvailable -= ParamsScratch.Num() - 1;
+			Send(It->Key, ParamsScratch.GetData(), ParamsScratch.Num() - 1, false);
+		}
+
+		StillQueued.Reset();
+		for (int32 ControlIndex : Scene.Queued)
+		{
+			FControlState& Control = Scene.Controls[ControlIndex];
+			if (Control.Pending.Num() > 0)
+			{
+				StillQueued.Add(ControlIndex);
+			}
+			else
+			{
+				// Sent, or every change was cancelled out
+				Control.bQueued = false;
+				Control.bUrgent = false;
+			}
+		}
+		NumQueuedControls -= Scene.Queued.Num() - StillQueued.Num();
+		Exchange(Scene.Queued, StillQueued);
+	}
+}
+
+bool FMixerControlUpdateBuffer::WriteSceneUpdate(FSceneState& Scene, const FString& SceneId, double Now, bool bUrgent)
+{
+	ParamsScratch.Reset();
+	FMixerJsonUtf8Writer Writer(ParamsScratch);
+	Writer.BeginObject();
+	Writer.WriteField(MixerStringConstants::FieldNames::SceneId, SceneId);
+	Writer.WriteKey(MixerStringConstants::FieldNames::Controls);
+	Writer.BeginArray();
+
+	int32 NumWritten = 0;
+	for (int32 ControlIndex : Scene.Queued)
+	{
+		FControlState& Control = Scene.Controls[ControlIndex];
+		if (Control.Pending.Num() == 0 || Control.bUrgent != bUrgent || (!bUrgent && Now < Control.NextSendTime))
+		{
+			continue;
+		}
+
+		Writer.BeginObject();
+		Writer.WriteField(MixerStringConstants::FieldNames::ControlId, Control.ControlName.ToString());
+		for (const TPair<FString, TSharedPtr<FJsonValue>>& Property : Control.Pending)
+		{
+			Writer.WriteKey(Property.Key);
+			WriteJsonValue(Writer, Property.Value);
+			Control.LastSent.Add(Property.Key, Property.Value);
+		}
+		Writer.EndObject();
+
+		Control.Pending.Empty();
+		Control.NextSendTime = Now + MinControlInterval;
+		++NumWritten;
+	}
+
+	Writer.EndArray();
+	Writer.EndObject();
+	ParamsScratch.Add('\0');
+	return NumWritten > 0;
+}
+
+void FMixerControlUpdateBuffer::Empty()
+{
+	Scenes.Empty();
+	NumQueuedControls = 0;
+}
+
+int32 FMixerControlUpdateBuffer::FindOrAddControl(FSceneState& Scene, FName ControlName)
+{
+	const int32* ExistingIndex = Scene.ControlIndices.Find(ControlName);
+	if (ExistingIndex != nullptr)
+	{
+		return *ExistingIndex;
+	}
+
+	const int32 NewIndex = Scene.Controls.AddDefaulted();
+	FControlState& NewControl = Scene.Controls[NewIndex];
+	NewControl.ControlName = ControlName;
+	NewControl.NextSendTime = 0.0;
+	NewControl.bQueued = false;
+	NewControl.bUrgent = false;
+	Scene.ControlIndices.Add(ControlName, NewIndex);
+	return NewIndex;
+}
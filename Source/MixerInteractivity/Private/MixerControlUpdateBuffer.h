@@ -0,0 +1,134 @@
+//*********************************************************
+//
+// Copyright (c) Microsoft. All rights reserved.
+// THIS CODE IS PROVIDED *AS IS* WITHOUT WARRANTY OF
+// ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING ANY
+// IMPLIED WARRANTIES OF FITNESS FOR A PARTICULAR
+// PURPOSE, MERCHANTABILITY, OR NON-INFRINGEMENT.
+//
+//*********************************************************
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Templates/Function.h"
+
+class FJsonObject;
+class FJsonValue;
+
+/**
+* Control property changes waiting to be sent to the service, together with the last value of
+* each property the service is known to hold.
+*
+* Controls are found by name through a per-scene index rather than by scanning the pending
+* updates, and a change that would leave a property at the value the service already has is
+* dropped (cancelling any different value queued earlier in the same frame).  Each scene's
+* updates are written straight to the params text of an updateControls call, without building
+* a JSON object tree first.
+*
+* Flushes are rate limited per scene, per control and by bytes sent; changes held back by the
+* limits simply stay pending and merge with later ones.  Controls with changes to properties
+* marked urgent skip the limits and are sent in a separate message, flagged as urgent.
+*/
+class FMixerControlUpdateBuffer
+{
+public:
+	FMixerControlUpdateBuffer()
+		: NumQueuedControls(0)
+		, MinSceneInterval(0.0)
+		, MinControlInterval(0.0)
+		, BytesPerSecond(0)
+		, ByteBudgetAvailable(0.0)
+		, LastByteBudgetRefillTime(0.0)
+	{
+	}
+
+	/** Rates of 0 mean no limit. */
+	void SetLimits(float MaxSceneUpdatesPerSecond, float MaxControlUpdatesPerSecond, int32 InBytesPerSecond);
+
+	/**
+	* Numeric changes to the property no larger than Tolerance, relative to the value last sent, are
+	* dropped.  Changes to urgent properties are sent by the next flush regardless of limits.
+	*/
+	void SetPropertyRule(const FString& PropertyName, float Tolerance, bool bUrgent);
+
+	void ClearPropertyRules() { PropertyRules.Empty(); }
+
+	/** Queue changes to a control's properties.  Any controlID field is ignored. */
+	void Set(FName SceneName, FName ControlName, const FJsonObject& Properties);
+
+	/** Record property values the service reports a control as holding. */
+	void Acknowledge(FName SceneName, FName ControlName, const FJsonObject& Properties);
+
+	bool HasPending() const { return NumQueuedControls > 0; }
+
+	/**
+	* Serialize and clear the pending changes that the limits allow, calling Send up to twice for each
+	* scene with any: once for controls with urgent changes, then once for the rest.  The values sent
+	* become the new baseline for dropping redundant changes.
+	*
+	* @param Now				Current time in seconds (FPlatformTime::Seconds).
+	* @param bUrgentOnly		Leave everything but urgent changes pending, e.g. while the transport is backed up.
+	* @param SceneIdForName	Maps a scene name to the id used on the wire.
+	* @param Send			Receives the scene name, the params object for updateControls as UTF-8 JSON text
+	*						(null terminated), its length excluding the terminator, and whether it holds urgent changes.
+	*/
+	void Flush(double Now, bool bUrgentOnly, TFunctionRef<FString(FName)> SceneIdForName, TFunctionRef<void(FName, const ANSICHAR*, int32, bool)> Send);
+
+	/** Forget everything, e.g. when the session ends and the service no longer holds any of these values. */
+	void Empty();
+
+private:
+	struct FPropertyRule
+	{
+		float Tolerance;
+		bool bUrgent;
+	};
+
+	struct FControlState
+	{
+		FName ControlName;
+		/** Changes queued since the last flush, in the order first queued. */
+		TMap<FString, TSharedPtr<FJsonValue>> Pending;
+		/** Last value of each property sent to, or reported by, the service. */
+		TMap<FString, TSharedPtr<FJsonValue>> LastSent;
+		double NextSendTime;
+		bool bQueued;
+		/** Pending includes a change to an urgent property. */
+		bool bUrgent;
+	};
+
+	struct FSceneState
+	{
+		TArray<FControlState> Controls;
+		TMap<FName, int32> ControlIndices;
+		/** Indices into Controls that may have pending changes. */
+		TArray<int32> Queued;
+		double NextSendTime;
+
+		FSceneState()
+			: NextSendTime(0.0)
+		{
+		}
+	};
+
+	/** @Return	Index of the control in Scene.Controls. */
+	static int32 FindOrAddControl(FSceneState& Scene, FName ControlName);
+
+	/**
+	* Write an updateControls params object to ParamsScratch for the scene's controls that are due and
+	* whose urgency matches, clearing their pending changes.  @Return	False if there were none.
+	*/
+	bool WriteSceneUpdate(FSceneState& Scene, const FString& SceneId, double Now, bool bUrgent);
+
+private:
+	TMap<FName, FSceneState> Scenes;
+	TMap<FString, FPropertyRule> PropertyRules;
+	int32 NumQueuedControls;
+	TArray<ANSICHAR> ParamsScratch;
+
+	double MinSceneInterval;
+	double MinControlInterval;
+	int32 BytesPerSecond;
+	double ByteBudgetAvailable;
+	double LastByteBudgetRefillTime;
+};
@@ -0,0 +1,67 @@
+//*********************************************************
+//
+// Copyright (c) Microsoft. All rights reserved.
+// THIS CODE IS PROVIDED *AS IS* WITHOUT WARRANTY OF
+// ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING ANY
+// IMPLIED WARRANTIES OF FITNESS FOR A PARTICULAR
+// PURPOSE, MERCHANTABILITY, OR NON-INFRINGEMENT.
+//
+//*********************************************************
+#include "MixerCustomControlCodec.h"
+#include "MixerBindingUtils.h"
+#include "Dom/JsonValue.h"
+#include "Dom/JsonObject.h"
+#include "JsonObjectConverter.h"
+#include "UObject/UnrealType.h"
+
+TMap<TWeakObjectPtr<UClass>, TSharedPtr<FMixerCustomControlCodec>> FMixerCustomControlCodec::CodecsByClass;
+
+const FMixerCustomControlCodec& FMixerCustomControlCodec::ForClass(UClass* ControlClass)
+{
+	check(ControlClass != nullptr);
+	TSharedPtr<FMixerCustomControlCodec>* ExistingCodec = CodecsByClass.Find(ControlClass);
+	if (ExistingCodec != nullptr)
+	{
+		return **ExistingCodec;
+	}
+
+	TSharedPtr<FMixerCustomControlCodec> NewCodec = MakeShareable(new FMixerCustomControlCodec(ControlClass));
+	CodecsByClass.Add(ControlClass, NewCodec);
+	return *NewCodec;
+}
+
+void FMixerCustomControlCodec::Invalidate(UClass* ControlClass)
+{
+	CodecsByClass.Remove(ControlClass);
+}
+
+FMixerCustomControlCodec::FMixerCustomControlCodec(UClass* ControlClass)
+{
+	for (TFieldIterator<UProperty> PropIt(ControlClass); PropIt; ++PropIt)
+	{
+		UProperty* Property = *PropIt;
+
+		FField Field;
+		Field.Property = Property;
+		Field.Setter = MixerBindingUtils::GetJsonPropertySetter(Property);
+		const FString WireName = FJsonObjectConverter::StandardizeCase(Property->GetName());
+		FieldsByWireName.Add(WireName, Field);
+		FieldsByWireNameIgnoreCase.Add(WireName, Field);
+	}
+}
+
+void FMixerCustomControlCodec::Apply(const FJsonObject& Update, UObject* Control) const
+{
+	for (const TPair<FString, TSharedPtr<FJsonValue>>& UpdatedField : Update.Values)
+	{
+		const FField* Field = FieldsByWireName.Find(UpdatedField.Key);
+		if (Field == nullptr)
+		{
+			Field = FieldsByWireNameIgnoreCase.Find(UpdatedField.Key);
+		}
+		if (Field != nullptr && UpdatedField.Value.IsValid())
+		{
+			Field->Setter(Field->Property, Field->Property->ContainerPtrToValuePtr<void>(Control), UpdatedField.Value);
+		}
+	}
+}
@@ -0,0 +1,66 @@
+//*********************************************************
+//
+// Copyright (c) Microsoft. All rights reserved.
+// THIS CODE IS PROVIDED *AS IS* WITHOUT WARRANTY OF
+// ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING ANY
+// IMPLIED WARRANTIES OF FITNESS FOR A PARTICULAR
+// PURPOSE, MERCHANTABILITY, OR NON-INFRINGEMENT.
+//
+//*********************************************************
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/WeakObjectPtrTemplates.h"
+#include "MixerBindingUtils.h"
+
+class FJsonObject;
+class FJsonValue;
+class UProperty;
+
+/**
+* Applies property updates from the Mixer service to instances of one custom control class.
+*
+* Built once per class: each wire field name maps straight to the property it sets and a setter
+* chosen for that property's type, so applying an update only looks at the fields actually in
+* the message.  Scalar and string properties are set directly; anything else goes through
+* FJsonObjectConverter for that one property.
+*
+* Field names are looked up case-sensitively first, which is what the service normally sends
+* back.  Only on a miss are they matched case-insensitively, as FJsonObjectConverter::JsonObjectToUStruct
+* always did, since FName may hand back property names with different casing to the wire names
+* a control was designed with.
+*/
+class FMixerCustomControlCodec
+{
+public:
+	/** @Return	Codec for the class, building it if this is the first use since the class was (re)compiled. */
+	static const FMixerCustomControlCodec& ForClass(UClass* ControlClass);
+
+	/** Drop the codec for a class whose properties may have changed. */
+	static void Invalidate(UClass* ControlClass);
+
+	/** Set properties of Control from matching fields of Update.  Unknown fields are ignored. */
+	void Apply(const FJsonObject& Update, UObject* Control) const;
+
+private:
+	struct FField
+	{
+		UProperty* Property;
+		MixerBindingUtils::FJsonPropertySetter Setter;
+	};
+
+	struct FCaseSensitiveKeyFuncs : TDefaultMapKeyFuncs<FString, FField, false>
+	{
+		static bool Matches(KeyInitType A, KeyInitType B) { return A.Equals(B, ESearchCase::CaseSensitive); }
+		static uint32 GetKeyHash(KeyInitType Key) { return FCrc::StrCrc32(*Key); }
+	};
+
+	explicit FMixerCustomControlCodec(UClass* ControlClass);
+
+private:
+	TMap<FString, FField, FDefaultSetAllocator, FCaseSensitiveKeyFuncs> FieldsByWireName;
+	/** Fallback for fields whose casing doesn't match exactly. */
+	TMap<FString, FField> FieldsByWireNameIgnoreCase;
+
+	static TMap<TWeakObjectPtr<UClass>, TSharedPtr<FMixerCustomControlCodec>> CodecsByClass;
+};
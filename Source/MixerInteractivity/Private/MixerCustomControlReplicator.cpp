@@ -0,0 +1,254 @@
+//*********************************************************
+//
+// Copyright (c) Microsoft. All rights reserved.
+// THIS CODE IS PROVIDED *AS IS* WITHOUT WARRANTY OF
+// ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING ANY
+// IMPLIED WARRANTIES OF FITNESS FOR A PARTICULAR
+// PURPOSE, MERCHANTABILITY, OR NON-INFRINGEMENT.
+//
+//*********************************************************
+#include "MixerCustomControlReplicator.h"
+#include "MixerCustomControl.h"
+#include "MixerInteractivityModule.h"
+#include "Containers/Ticker.h"
+#include "JsonObjectConverter.h"
+#include "Engine/World.h"
+#include "HAL/PlatformTime.h"
+
+namespace
+{
+	bool CanCompareAsPlainOldData(const UProperty* Property)
+	{
+		// Bitfield bools share their storage with neighbours
+		return Property->HasAnyPropertyFlags(CPF_IsPlainOldData) && !Property->IsA<UBoolProperty>();
+	}
+}
+
+FMixerCustomControlReplicator& FMixerCustomControlReplicator::Get()
+{
+	static FMixerCustomControlReplicator Instance;
+	return Instance;
+}
+
+void FMixerCustomControlReplicator::Register(UMixerCustomControl* Control, const TArray<UProperty*>& ClientWritableProperties)
+{
+	check(Control != nullptr);
+	Unregister(Control);
+
+	if (ClientWritableProperties.Num() == 0)
+	{
+		return;
+	}
+
+	FControlEntry& Entry = Entries[Entries.AddDefaulted()];
+	Entry.Control = Control;
+	Entry.Plan = FindOrCreatePlan(Control->GetClass(), ClientWritableProperties);
+	Entry.NextUpdateTime = FPlatformTime::Seconds() + FMath::Max(Control->ClientPropertyUpdateInterval, 0.0f);
+
+	Entry.Shadow.AddUninitialized(Entry.Plan->ShadowSize);
+	for (const FPropertyPlan& PropertyPlan : Entry.Plan->Properties)
+	{
+		uint8* ShadowValue = Entry.Shadow.GetData() + PropertyPlan.ShadowOffset;
+		PropertyPlan.Property->InitializeValue(ShadowValue);
+		PropertyPlan.Property->CopyCompleteValue(ShadowValue, PropertyPlan.Property->ContainerPtrToValuePtr<void>(Control));
+	}
+
+	if (!TickerHandle.IsValid())
+	{
+		TickerHandle = FTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FMixerCustomControlReplicator::Tick));
+	}
+}
+
+void FMixerCustomControlReplicator::Unregister(UMixerCustomControl* Control)
+{
+	// Compared without resolving, since this is also called while the control is being destroyed
+	const TWeakObjectPtr<UMixerCustomControl> WeakControl(Control);
+	for (int32 i = Entries.Num() - 1; i >= 0; --i)
+	{
+		if (Entries[i].Control.HasSameIndexAndSerialNumber(WeakControl))
+		{
+			DestroyShadow(Entries[i]);
+			Entries.RemoveAtSwap(i);
+		}
+	}
+}
+
+void FMixerCustomControlReplicator::InvalidateClass(UClass* ControlClass)
+{
+	PlansByClass.Remove(ControlClass);
+
+	// The old plan's properties have been moved aside by the compile but not yet collected,
+	// so they can still be used to tear down the shadows that were built with them.
+	TArray<UMixerCustomControl*> ControlsToRegister;
+	for (int32 i = Entries.Num() - 1; i >= 0; --i)
+	{
+		UMixerCustomControl* Control = Entries[i].Control.Get();
+		if (Control == nullptr || Control->GetClass() == ControlClass)
+		{
+			if (Control != nullptr)
+			{
+				ControlsToRegister.Add(Control);
+			}
+			DestroyShadow(Entries[i]);
+			Entries.RemoveAtSwap(i);
+		}
+	}
+
+	for (UMixerCustomControl* Control : ControlsToRegister)
+	{
+		Control->InitClientWrittenPropertyMaintenance();
+	}
+}
+
+TSharedPtr<FMixerCustomControlReplicator::FClassPlan> FMixerCustomControlReplicator::FindOrCreatePlan(UClass* ControlClass, const TArray<UProperty*>& ClientWritableProperties)
+{
+	TSharedPtr<FClassPlan>* ExistingPlan = PlansByClass.Find(ControlClass);
+	if (ExistingPlan != nullptr)
+	{
+		return *ExistingPlan;
+	}
+
+	TSharedPtr<FClassPlan> Plan = MakeShared<FClassPlan>();
+	int32 ShadowSize = 0;
+	for (UProperty* Property : ClientWritableProperties)
+	{
+		FPropertyPlan& PropertyPlan = Plan->Properties[Plan->Properties.AddDefaulted()];
+		PropertyPlan.Property = Property;
+		PropertyPlan.JsonName = FJsonObjectConverter::StandardizeCase(Property->GetName());
+		PropertyPlan.ShadowOffset = Align(ShadowSize, Property->GetMinAlignment());
+		ShadowSize = PropertyPlan.ShadowOffset + Property->GetSize();
+
+		const int32 PropertyIndex = Plan->Properties.Num() - 1;
+		if (!CanCompareAsPlainOldData(Property))
+		{
+			Plan->ComplexProperties.Add(PropertyIndex);
+			continue;
+		}
+
+		const int32 SourceOffset = Property->GetOffset_ForInternal();
+		FPodRun* LastRun = Plan->PodRuns.Num() > 0 ? &Plan->PodRuns.Last() : nullptr;
+		if (LastRun != nullptr
+			&& LastRun->FirstProperty + LastRun->NumProperties == PropertyIndex
+			&& LastRun->SourceOffset + LastRun->Size == SourceOffset
+			&& LastRun->ShadowOffset + LastRun->Size == PropertyPlan.ShadowOffset)
+		{
+			LastRun->Size += Property->GetSize();
+			++LastRun->NumProperties;
+		}
+		else
+		{
+			FPodRun& NewRun = Plan->PodRuns[Plan->PodRuns.AddUninitialized()];
+			NewRun.SourceOffset = SourceOffset;
+			NewRun.ShadowOffset = PropertyPlan.ShadowOffset;
+			NewRun.Size = Property->GetSize();
+			NewRun.FirstProperty = PropertyIndex;
+			NewRun.NumProperties = 1;
+		}
+	}
+	Plan->ShadowSize = ShadowSize;
+
+	PlansByClass.Add(ControlClass, Plan);
+	return Plan;
+}
+
+bool FMixerCustomControlReplicator::Tick(float DeltaTime)
+{
+	const double Now = FPlatformTime::Seconds();
+	for (int32 i = Entries.Num() - 1; i >= 0; --i)
+	{
+		if (Now >= Entries[i].NextUpdateTime && !UpdateControl(Entries[i], Now))
+		{
+			DestroyShadow(Entries[i]);
+			Entries.RemoveAtSwap(i);
+		}
+	}
+
+	if (Entries.Num() == 0)
+	{
+		TickerHandle.Reset();
+		return false;
+	}
+
+	return true;
+}
+
+bool FMixerCustomControlReplicator::UpdateControl(FControlEntry& Entry, double Now)
+{
+	UMixerCustomControl* Control = Entry.Control.Get();
+	if (Control == nullptr)
+	{
+		return false;
+	}
+
+	UWorld* World = Control->GetWorld();
+	if (World == nullptr || !World->IsGameWorld())
+	{
+		return false;
+	}
+
+	Entry.NextUpdateTime = Now + FMath::Max(Control->ClientPropertyUpdateInterval, 0.0f);
+
+	const FClassPlan& Plan = *Entry.Plan;
+	uint8* Source = reinterpret_cast<uint8*>(Control);
+	uint8* Shadow = Entry.Shadow.GetData();
+
+	TSharedPtr<FJsonObject> ControlJson;
+	auto AddChangedProperty = [&ControlJson](const FPropertyPlan& PropertyPlan, const void* Value)
+	{
+		if (!ControlJson.IsValid())
+		{
+			ControlJson = MakeShared<FJsonObject>();
+		}
+		ControlJson->SetField(PropertyPlan.JsonName, FJsonObjectConverter::UPropertyToJsonValue(PropertyPlan.Property, Value, 0, 0));
+	};
+
+	for (const FPodRun& Run : Plan.PodRuns)
+	{
+		if (FMemory::Memcmp(Source + Run.SourceOffset, Shadow + Run.ShadowOffset, Run.Size) == 0)
+		{
+			continue;
+		}
+
+		for (int32 PropertyIndex = Run.FirstProperty; PropertyIndex < Run.FirstProperty + Run.NumProperties; ++PropertyIndex)
+		{
+			const FPropertyPlan& PropertyPlan = Plan.Properties[PropertyIndex];
+			const uint8* SourceValue = PropertyPlan.Property->ContainerPtrToValuePtr<uint8>(Control);
+			uint8* ShadowValue = Shadow + PropertyPlan.ShadowOffset;
+			const int32 Size = PropertyPlan.Property->GetSize();
+			if (FMemory::Memcmp(SourceValue, ShadowValue, Size) != 0)
+			{
+				AddChangedProperty(PropertyPlan, SourceValue);
+				FMemory::Memcpy(ShadowValue, SourceValue, Size);
+			}
+		}
+	}
+
+	for (int32 PropertyIndex : Plan.ComplexProperties)
+	{
+		const FPropertyPlan& PropertyPlan = Plan.Properties[PropertyIndex];
+		void* SourceValue = PropertyPlan.Property->ContainerPtrToValuePtr<void>(Control);
+		uint8* ShadowValue = Shadow + PropertyPlan.ShadowOffset;
+		if (!PropertyPlan.Property->Identical(SourceValue, ShadowValue))
+		{
+			AddChangedProperty(PropertyPlan, SourceValue);
+			PropertyPlan.Property->CopyCompleteValue(ShadowValue, SourceValue);
+		}
+	}
+
+	if (ControlJson.IsValid())
+	{
+		// Queued updates for all controls are sent together when the module next flushes
+		IMixerInteractivityModule::Get().UpdateRemoteControl(Control->SceneName, Control->ControlName, ControlJson.ToSharedRef());
+	}
+
+	return true;
+}
+
+void FMixerCustomControlReplicator::DestroyShadow(FControlEntry& Entry)
+{
+	for (const FPropertyPlan& PropertyPlan : Entry.Plan->Properties)
+	{
+		PropertyPlan.Property->DestroyValue(Entry.Shadow.GetData() + PropertyPlan.ShadowOffset);
+	}
+	Entry.Shadow.Empty();
+}
@@ -0,0 +1,96 @@
+//*********************************************************
+//
+// Copyright (c) Microsoft. All rights reserved.
+// THIS CODE IS PROVIDED *AS IS* WITHOUT WARRANTY OF
+// ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING ANY
+// IMPLIED WARRANTIES OF FITNESS FOR A PARTICULAR
+// PURPOSE, MERCHANTABILITY, OR NON-INFRINGEMENT.
+//
+//*********************************************************
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/WeakObjectPtrTemplates.h"
+
+class UMixerCustomControl;
+class UProperty;
+
+/**
+* Sends changes to the client-writable properties of every mapped custom control from a single
+* ticker, rather than one ticker per control.
+*
+* The properties to compare are worked out once per class.  Plain-old-data properties that sit
+* next to each other in the object are grouped into runs and compared against a packed copy of
+* the values last sent with one memcmp per run; other properties fall back to UProperty::Identical.
+* Everything that changed in a pass is queued with the module together, so it goes out as one
+* updateControls per scene.
+*/
+class FMixerCustomControlReplicator
+{
+public:
+	static FMixerCustomControlReplicator& Get();
+
+	/** Start tracking a control.  The values it holds now are taken as already sent. */
+	void Register(UMixerCustomControl* Control, const TArray<UProperty*>& ClientWritableProperties);
+
+	void Unregister(UMixerCustomControl* Control);
+
+	/**
+	* Forget the plan for a class whose properties have changed (e.g. a Blueprint recompile) and
+	* register its tracked controls again against the new layout.
+	*/
+	void InvalidateClass(UClass* ControlClass);
+
+private:
+	struct FPropertyPlan
+	{
+		UProperty* Property;
+		FString JsonName;
+		int32 ShadowOffset;
+	};
+
+	/** Adjacent plain-old-data properties, compared as one block. */
+	struct FPodRun
+	{
+		int32 SourceOffset;
+		int32 ShadowOffset;
+		int32 Size;
+		int32 FirstProperty;
+		int32 NumProperties;
+	};
+
+	struct FClassPlan
+	{
+		TArray<FPropertyPlan> Properties;
+		TArray<FPodRun> PodRuns;
+		/** Indices into Properties that need UProperty::Identical. */
+		TArray<int32> ComplexProperties;
+		int32 ShadowSize;
+	};
+
+	struct FControlEntry
+	{
+		TWeakObjectPtr<UMixerCustomControl> Control;
+		TSharedPtr<FClassPlan> Plan;
+		TArray<uint8> Shadow;
+		double NextUpdateTime;
+	};
+
+	FMixerCustomControlReplicator()
+	{
+	}
+
+	TSharedPtr<FClassPlan> FindOrCreatePlan(UClass* ControlClass, const TArray<UProperty*>& ClientWritableProperties);
+
+	bool Tick(float DeltaTime);
+
+	/** @Return	Whether the control is still valid and wants updates. */
+	bool UpdateControl(FControlEntry& Entry, double Now);
+
+	static void DestroyShadow(FControlEntry& Entry);
+
+private:
+	TArray<FControlEntry> Entries;
+	TMap<TWeakObjectPtr<UClass>, TSharedPtr<FClassPlan>> PlansByClass;
+	FDelegateHandle TickerHandle;
+};
@@ -13,10 +13,11 @@
 #include "MixerBindingUtils.h"
 #include "MixerInteractivitySettings.h"
 #include "MixerInteractivityProjectAsset.h"
+#include "MixerCustomControlCodec.h"
+#include "MixerCustomControlReplicator.h"
 #include "Engine/World.h"
 #include "Dom/JsonValue.h"
 #include "Dom/JsonObject.h"
-#include "JsonObjectConverter.h"
 #include "Serialization/JsonReader.h"
 #include "Serialization/JsonWriter.h"
 #include "Serialization/JsonSerializer.h"
@@ -26,6 +27,26 @@
 
 TArray<TWeakObjectPtr<UMixerInteractivityBlueprintEventSource>> UMixerInteractivityBlueprintEventSource::BlueprintEventSources;
 
+namespace
+{
+	void RememberNameForHandle(TArray<FName>& NamesByHandle, const FMixerControlHandle& Handle, FName Name)
+	{
+		if (Handle.IsSet())
+		{
+			if (Handle.Index >= NamesByHandle.Num())
+			{
+				NamesByHandle.SetNum(Handle.Index + 1);
+			}
+			NamesByHandle[Handle.Index] = Name;
+		}
+	}
+
+	FName GetNameForHandle(const TArray<FName>& NamesByHandle, const FMixerControlHandle& Handle)
+	{
+		return NamesByHandle.IsValidIndex(Handle.Index) ? NamesByHandle[Handle.Index] : NAME_None;
+	}
+}
+
 UMixerInteractivityBlueprintEventSource::UMixerInteractivityBlueprintEventSource(const FObjectInitializer& Initializer)
 	: Super(Initializer)
 {
@@ -41,14 +62,32 @@ void UMixerInteractivityBlueprintEventSource::RegisterForMixerEvents()
 {
 	// Use GetModuleChecked here to avoid unsafe non-game thread warning
 	IMixerInteractivityModule& InteractivityModule = FModuleManager::GetModuleChecked<IMixerInteractivityModule>("MixerInteractivity");
-	if (ButtonDelegates.Num() > 0)
+	bool bAnyPerInputButtons = false;
+	bool bAnyCoalesced = false;
+	for (TMap<FName, FMixerButtonEventDynamicDelegateWrapper>::TIterator It(ButtonDelegates); It; ++It)
+	{
+		bAnyPerInputButtons |= It->Value.HasPerInputBindings();
+		bAnyCoalesced |= It->Value.HasCoalescedBindings();
+	}
+	bool bAnyPerInputSticks = false;
+	for (TMap<FName, FMixerStickEventDynamicDelegateWrapper>::TIterator It(StickDelegates); It; ++It)
+	{
+		bAnyPerInputSticks |= It->Value.HasPerInputBindings();
+		bAnyCoalesced |= It->Value.HasCoalescedBindings();
+	}
+
+	if (bAnyPerInputButtons)
 	{
 		InteractivityModule.OnButtonEvent().AddUObject(this, &UMixerInteractivityBlueprintEventSource::OnButtonNativeEvent);
 	}
-	if (StickDelegates.Num() > 0)
+	if (bAnyPerInputSticks)
 	{
 		InteractivityModule.OnStickEvent().AddUObject(this, &UMixerInteractivityBlueprintEventSource::OnStickNativeEvent);
 	}
+	if (bAnyCoalesced)
+	{
+		InteractivityModule.OnInputFrame().AddUObject(this, &UMixerInteractivityBlueprintEventSource::OnInputFrameNativeEvent);
+	}
 	if (TextboxDelegates.Num() > 0)
 	{
 		InteractivityModule.OnTextboxSubmitEvent().AddUObject(this, &UMixerInteractivityBlueprintEventSource::OnTextboxSubmitNativeEvent);
@@ -87,10 +126,22 @@ UMixerInteractivityBlueprintEventSource* UMixerInteractivityBlueprintEventSource
 	return NewObject<UMixerInteractivityBlueprintEventSource>(ForWorld);
 }
 
-FMixerButtonEventDynamicDelegate* UMixerInteractivityBlueprintEventSource::GetButtonEvent(FName ButtonName, bool Pressed)
+FMulticastScriptDelegate* UMixerInteractivityBlueprintEventSource::GetButtonEvent(FName ButtonName, bool Pressed, EMixerButtonEventCoalescing Coalescing)
 {
 	FMixerButtonEventDynamicDelegateWrapper& DelegateWrapper = ButtonDelegates.FindOrAdd(ButtonName);
-	return Pressed ? &DelegateWrapper.PressedDelegate : &DelegateWrapper.ReleasedDelegate;
+	switch (Coalescing)
+	{
+	case EMixerButtonEventCoalescing::None:
+		return Pressed ? &DelegateWrapper.PressedDelegate : &DelegateWrapper.ReleasedDelegate;
+
+	case EMixerButtonEventCoalescing::OncePerFrame:
+		RememberNameForHandle(ButtonNamesByHandle, IMixerInteractivityModule::Get().ResolveButton(ButtonName), ButtonName);
+		return Pressed ? &DelegateWrapper.CoalescedPressedDelegate : &DelegateWrapper.CoalescedReleasedDelegate;
+
+	default:
+		UE_LOG(LogMixerInteractivity, Error, TEXT("Unknown coalescing mode %d for button %s"), static_cast<int32>(Coalescing), *ButtonName.ToString());
+		return nullptr;
+	}
 }
 
 void UMixerInteractivityBlueprintEventSource::AddCustomMethodBinding(FName EventName, UObject* TargetObject, FName TargetFunctionName)
@@ -141,10 +192,25 @@ void UMixerInteractivityBlueprintEventSource::RemoveTextSubmittedBinding(FName T
 	}
 }
 
-FMixerStickEventDynamicDelegate* UMixerInteractivityBlueprintEventSource::GetStickEvent(FName StickName)
+FMulticastScriptDelegate* UMixerInteractivityBlueprintEventSource::GetStickEvent(FName StickName, EMixerStickEventCoalescing Coalescing)
 {
 	FMixerStickEventDynamicDelegateWrapper& DelegateWrapper = StickDelegates.FindOrAdd(StickName);
-	return &DelegateWrapper.Delegate;
+	switch (Coalescing)
+	{
+	case EMixerStickEventCoalescing::None:
+		return &DelegateWrapper.Delegate;
+
+	case EMixerStickEventCoalescing::LatestPerParticipant:
+		RememberNameForHandle(StickNamesByHandle, IMixerInteractivityModule::Get().ResolveStick(StickName), StickName);
+		return &DelegateWrapper.LatestPerParticipantDelegate;
+
+	case EMixerStickEventCoalescing::Aggregate:
+		return &DelegateWrapper.AggregateDelegate;
+
+	default:
+		UE_LOG(LogMixerInteractivity, Error, TEXT("Unknown coalescing mode %d for stick %s"), static_cast<int32>(Coalescing), *StickName.ToString());
+		return nullptr;
+	}
 }
 
 FMixerCustomControlInputDynamicDelegate& UMixerInteractivityBlueprintEventSource::GetCustomControlInputEvent(FName ControlName)
@@ -182,6 +248,134 @@ void UMixerInteractivityBlueprintEventSource::OnStickNativeEvent(FName StickName
 	}
 }
 
+void UMixerInteractivityBlueprintEventSource::OnInputFrameNativeEvent(const FMixerInputFrame& Frame)
+{
+	// Everything is gathered before anything is broadcast, since Blueprint handlers may add bindings
+	CoalescedButtonEvents.Reset();
+	CoalescedPressIndices.Reset();
+	CoalescedReleaseIndices.Reset();
+	for (const FMixerButtonInput& Input : Frame.Buttons)
+	{
+		const FName ButtonName = GetNameForHandle(ButtonNamesByHandle, Input.Button);
+		FMixerButtonEventDynamicDelegateWrapper* DelegateWrapper = ButtonName.IsNone() ? nullptr : ButtonDelegates.Find(ButtonName);
+		if (DelegateWrapper == nullptr || !(Input.Pressed ? DelegateWrapper->CoalescedPressedDelegate : DelegateWrapper->CoalescedReleasedDelegate).IsBound())
+		{
+			continue;
+		}
+
+		// Each spark transaction has to be captured on its own, so those are never merged
+		TMap<FName, int32>& EventIndices = Input.Pressed ? CoalescedPressIndices : CoalescedReleaseIndices;
+		int32* ExistingIndex = Input.TransactionIndex == INDEX_NONE ? EventIndices.Find(ButtonName) : nullptr;
+		const int32 EventIndex = ExistingIndex != nullptr ? *ExistingIndex : CoalescedButtonEvents.AddUninitialized();
+		if (ExistingIndex == nullptr)
+		{
+			if (Input.TransactionIndex == INDEX_NONE)
+			{
+				EventIndices.Add(ButtonName, EventIndex);
+			}
+			CoalescedButtonEvents[EventIndex].Count = 0;
+		}
+
+		FMixerCoalescedButtonEvent& Event = CoalescedButtonEvents[EventIndex];
+		++Event.Count;
+		Event.ButtonName = ButtonName;
+		Event.ParticipantId = Input.ParticipantId;
+		Event.SparkCost = Input.SparkCost;
+		Event.TransactionIndex = Input.TransactionIndex;
+		Event.Pressed = Input.Pressed;
+	}
+
+	for (const FName& StickName : CoalescedSticksThisFrame)
+	{
+		FMixerCoalescedStickFrame& StickFrame = CoalescedStickFrames.FindChecked(StickName);
+		StickFrame.LatestMoves.Reset();
+		StickFrame.MoveIndexByParticipant.Reset();
+	}
+	CoalescedSticksThisFrame.Reset();
+	for (const FMixerStickInput& Input : Frame.Sticks)
+	{
+		const FName StickName = GetNameForHandle(StickNamesByHandle, Input.Stick);
+		FMixerStickEventDynamicDelegateWrapper* DelegateWrapper = StickName.IsNone() ? nullptr : StickDelegates.Find(StickName);
+		if (DelegateWrapper == nullptr || !DelegateWrapper->LatestPerParticipantDelegate.IsBound())
+		{
+			continue;
+		}
+
+		FMixerCoalescedStickFrame& StickFrame = CoalescedStickFrames.FindOrAdd(StickName);
+		if (StickFrame.LatestMoves.Num() == 0)
+		{
+			CoalescedSticksThisFrame.Add(StickName);
+		}
+
+		const int32* ExistingIndex = StickFrame.MoveIndexByParticipant.Find(Input.ParticipantId);
+		if (ExistingIndex == nullptr)
+		{
+			const int32 MoveIndex = StickFrame.LatestMoves.AddDefaulted();
+			StickFrame.LatestMoves[MoveIndex].ParticipantId = static_cast<int32>(Input.ParticipantId);
+			ExistingIndex = &StickFrame.MoveIndexByParticipant.Add(Input.ParticipantId, MoveIndex);
+		}
+
+		FMixerStickParticipantMove& Move = StickFrame.LatestMoves[*ExistingIndex];
+		Move.XAxis = Input.Axes.X;
+		Move.YAxis = Input.Axes.Y;
+	}
+
+	// Aggregate bindings report the stick's polled state, which includes participants holding it still
+	AggregateStickAxes.Reset();
+	IMixerInteractivityModule& InteractivityModule = IMixerInteractivityModule::Get();
+	for (TMap<FName, FMixerStickEventDynamicDelegateWrapper>::TIterator It(StickDelegates); It; ++It)
+	{
+		FMixerStickState StickState;
+		if (It->Value.AggregateDelegate.IsBound() && InteractivityModule.GetStickState(It->Key, StickState))
+		{
+			AggregateStickAxes.Emplace(It->Key, StickState.Axes);
+		}
+	}
+
+	for (const FMixerCoalescedButtonEvent& Event : CoalescedButtonEvents)
+	{
+		// Found again each time since a handler may have added bindings and moved the wrapper
+		FMixerButtonEventDynamicDelegateWrapper* DelegateWrapper = ButtonDelegates.Find(Event.ButtonName);
+		if (DelegateWrapper != nullptr)
+		{
+			FMixerButtonReference ButtonRef;
+			ButtonRef.Name = Event.ButtonName;
+			FMixerTransactionId TransactionId;
+			if (Event.TransactionIndex != INDEX_NONE)
+			{
+				TransactionId.Id = Frame.TransactionIds[Event.TransactionIndex];
+			}
+			FMixerCoalescedButtonEventDynamicDelegate& DelegateToFire = Event.Pressed ? DelegateWrapper->CoalescedPressedDelegate : DelegateWrapper->CoalescedReleasedDelegate;
+			DelegateToFire.Broadcast(ButtonRef, static_cast<int32>(Event.ParticipantId), TransactionId, static_cast<int32>(Event.SparkCost), Event.Count);
+		}
+	}
+
+	for (const FName& StickName : CoalescedSticksThisFrame)
+	{
+		// Only the gathering above adds to CoalescedStickFrames, so this stays valid while handlers run
+		const TArray<FMixerStickParticipantMove>& LatestMoves = CoalescedStickFrames.FindChecked(StickName).LatestMoves;
+		FMixerStickReference StickRef;
+		StickRef.Name = StickName;
+
+		FMixerStickEventDynamicDelegateWrapper* DelegateWrapper = StickDelegates.Find(StickName);
+		if (DelegateWrapper != nullptr && DelegateWrapper->LatestPerParticipantDelegate.IsBound())
+		{
+			DelegateWrapper->LatestPerParticipantDelegate.Broadcast(StickRef, LatestMoves);
+		}
+	}
+
+	for (const TPair<FName, FVector2D>& StickAxes : AggregateStickAxes)
+	{
+		FMixerStickEventDynamicDelegateWrapper* DelegateWrapper = StickDelegates.Find(StickAxes.Key);
+		if (DelegateWrapper != nullptr && DelegateWrapper->AggregateDelegate.IsBound())
+		{
+			FMixerStickReference StickRef;
+			StickRef.Name = StickAxes.Key;
+			DelegateWrapper->AggregateDelegate.Broadcast(StickRef, 0, StickAxes.Value.X, StickAxes.Value.Y);
+		}
+	}
+}
+
 void UMixerInteractivityBlueprintEventSource::OnParticipantStateChangedNativeEvent(TSharedPtr<const FMixerRemoteUser> Participant, EMixerInteractivityParticipantState NewState)
 {
 	check(Participant.IsValid());
@@ -228,12 +422,13 @@ void UMixerInteractivityBlueprintEventSource::OnCustomMethodCallNativeEvent(FNam
 
 	if (FunctionPrototype != nullptr && BlueprintEvent != nullptr)
 	{
+		const MixerBindingUtils::FParamBindingPlan& BindingPlan = MixerBindingUtils::FParamBindingPlan::ForFunction(FunctionPrototype);
 		void* ParamStorage = FMemory_Alloca(FunctionPrototype->ParmsSize);
 		if (ParamStorage != nullptr)
 		{
-			MixerBindingUtils::ExtractCustomEventParamsFromMessage(MethodParams.Get(), FunctionPrototype, ParamStorage, FunctionPrototype->ParmsSize);
+			BindingPlan.ExtractParams(MethodParams.Get(), ParamStorage, FunctionPrototype->ParmsSize);
 			BlueprintEvent->ProcessMulticastDelegate<UObject>(ParamStorage);
-			MixerBindingUtils::DestroyCustomEventParams(FunctionPrototype, ParamStorage, FunctionPrototype->ParmsSize);
+			BindingPlan.DestroyParams(ParamStorage, FunctionPrototype->ParmsSize);
 		}
 	}
 }
@@ -245,15 +440,16 @@ void UMixerInteractivityBlueprintEventSource::OnCustomControlInputNativeEvent(FN
 	{
 		if (Wrapper->MappedControl != nullptr)
 		{
-			UFunction* HandlerMethod = Wrapper->MappedControl->FindFunction(EventType);
-			if (HandlerMethod != nullptr)
+			const MixerBindingUtils::FParamBindingPlan* BindingPlan = MixerBindingUtils::FParamBindingPlan::ForEvent(Wrapper->MappedControl->GetClass(), EventType);
+			if (BindingPlan != nullptr)
 			{
+				UFunction* HandlerMethod = BindingPlan->GetFunction();
 				void* ParamStorage = FMemory_Alloca(HandlerMethod->ParmsSize);
 				if (ParamStorage != nullptr)
 				{
-					MixerBindingUtils::ExtractCustomEventParamsFromMessage(&EventPayload.Get(), HandlerMethod, ParamStorage, HandlerMethod->ParmsSize);
+					BindingPlan->ExtractParams(&EventPayload.Get(), ParamStorage, HandlerMethod->ParmsSize);
 					Wrapper->MappedControl->ProcessEvent(HandlerMethod, ParamStorage);
-					MixerBindingUtils::DestroyCustomEventParams(HandlerMethod, ParamStorage, HandlerMethod->ParmsSize);
+					BindingPlan->DestroyParams(ParamStorage, HandlerMethod->ParmsSize);
 				}
 			}
 			else
@@ -277,7 +473,7 @@ void UMixerInteractivityBlueprintEventSource::OnCustomControlPropertyUpdateNativ
 	{
 		if (Wrapper->MappedControl != nullptr)
 		{
-			FJsonObjectConverter::JsonObjectToUStruct(UpdatedProperties, Wrapper->MappedControl->GetClass(), Wrapper->MappedControl);
+			FMixerCustomControlCodec::ForClass(Wrapper->MappedControl->GetClass()).Apply(*UpdatedProperties, Wrapper->MappedControl);
 			Wrapper->MappedControl->NativeOnServerPropertiesUpdated();
 		}
 		else if (Wrapper->UpdateDelegate.IsBound())
@@ -341,6 +537,8 @@ void UMixerInteractivityBlueprintEventSource::RefreshCustomControls()
 						bCustomControlsChanged = true;
 					}
 
+					FMixerCustomControlCodec::ForClass(ControlClass);
+
 					UBlueprint* GeneratedByBP = Cast<UBlueprint>(ControlClass->ClassGeneratedBy);
 					if (GeneratedByBP && !GeneratedByBP->OnCompiled().IsBoundToObject(this))
 					{
@@ -381,6 +579,13 @@ void UMixerInteractivityBlueprintEventSource::RefreshCustomControls()
 
 void UMixerInteractivityBlueprintEventSource::OnCustomControlCompiled(UBlueprint* CompiledBP)
 {
+	if (CompiledBP->GeneratedClass != nullptr)
+	{
+		FMixerCustomControlCodec::Invalidate(CompiledBP->GeneratedClass);
+		MixerBindingUtils::FParamBindingPlan::InvalidateClass(CompiledBP->GeneratedClass);
+		FMixerCustomControlReplicator::Get().InvalidateClass(CompiledBP->GeneratedClass);
+	}
+
 	for (TMap<FName, FMixerCustomControlDelegateWrapper>::TIterator It(CustomControlDelegates); It; ++It)
 	{
 		UMixerCustomControl* ControlObj = It->Value.MappedControl;
@@ -491,7 +696,7 @@ void UMixerDelegateBinding::BindDynamicDelegates(UObject* InInstance) const
 
 	for (const FMixerButtonEventBinding& ButtonBinding : ButtonEventBindings)
 	{
-		FMixerButtonEventDynamicDelegate* Event = EventSource->GetButtonEvent(ButtonBinding.ButtonId, ButtonBinding.Pressed);
+		FMulticastScriptDelegate* Event = EventSource->GetButtonEvent(ButtonBinding.ButtonId, ButtonBinding.Pressed, ButtonBinding.Coalescing);
 		if (Event)
 		{
 			FScriptDelegate Delegate;
@@ -506,7 +711,7 @@ void UMixerDelegateBinding::BindDynamicDelegates(UObject* InInstance) const
 		{
 		case EMixerGenericEventBindingType::Stick:
 			{
-				FMixerStickEventDynamicDelegate * Event = EventSource->GetStickEvent(GenericBinding.NameParam);
+				FMulticastScriptDelegate* Event = EventSource->GetStickEvent(GenericBinding.NameParam, GenericBinding.StickCoalescing);
 				if (Event)
 				{
 					FScriptDelegate Delegate;
@@ -589,7 +794,7 @@ void UMixerDelegateBinding::UnbindDynamicDelegates(UObject* InInstance) const
 	check(EventSource);
 	for (const FMixerButtonEventBinding& ButtonBinding : ButtonEventBindings)
 	{
-		FMixerButtonEventDynamicDelegate* Event = EventSource->GetButtonEvent(ButtonBinding.ButtonId, ButtonBinding.Pressed);
+		FMulticastScriptDelegate* Event = EventSource->GetButtonEvent(ButtonBinding.ButtonId, ButtonBinding.Pressed, ButtonBinding.Coalescing);
 		if (Event)
 		{
 			Event->Remove(InInstance, ButtonBinding.TargetFunctionName);
@@ -614,7 +819,7 @@ void UMixerDelegateBinding::UnbindDynamicDelegates(UObject* InInstance) const
 		{
 		case EMixerGenericEventBindingType::Stick:
 			{
-				FMixerStickEventDynamicDelegate* Event = EventSource->GetStickEvent(GenericBinding.NameParam);
+				FMulticastScriptDelegate* Event = EventSource->GetStickEvent(GenericBinding.NameParam, GenericBinding.StickCoalescing);
 				if (Event)
 				{
 					Event->Remove(InInstance, GenericBinding.TargetFunctionName);
@@ -21,6 +21,67 @@ const FName MixerObjectKindMetadataTag = "MixerObjectKind";
 
 #define LOCTEXT_NAMESPACE "MixerInteractivityEditor"
 
+namespace
+{
+	void CopyOutButtonState(bool bGotState, const FMixerButtonState& ButtonState, FTimespan& RemainingCooldown, float& Progress, int32& DownCount, int32& PressCount, int32& UpCount, bool& Enabled)
+	{
+		if (bGotState)
+		{
+			RemainingCooldown = ButtonState.RemainingCooldown;
+			Progress = ButtonState.Progress;
+			DownCount = static_cast<int32>(ButtonState.DownCount);
+			PressCount = static_cast<int32>(ButtonState.PressCount);
+			UpCount = static_cast<int32>(ButtonState.UpCount);
+			Enabled = ButtonState.Enabled;
+		}
+		else
+		{
+			RemainingCooldown = FTimespan(0);
+			Progress = 0.0f;
+			DownCount = 0;
+			PressCount = 0;
+			UpCount = 0;
+			Enabled = false;
+		}
+	}
+
+	void CopyOutStickState(bool bGotState, const FMixerStickState& StickState, float& XAxis, float& YAxis, bool& Enabled)
+	{
+		if (bGotState)
+		{
+			XAxis = StickState.Axes.X;
+			YAxis = StickState.Axes.Y;
+			Enabled = StickState.Enabled;
+		}
+		else
+		{
+			XAxis = 0.0f;
+			YAxis = 0.0f;
+			Enabled = false;
+		}
+	}
+
+	void CopyOutLabelDescription(bool bGotDesc, const FMixerLabelDescription& LabelDesc, FText& Text, FString& TextSize, FColor& TextColor, bool& Bold, bool& Underline, bool& Italic)
+	{
+		if (bGotDesc)
+		{
+			Text = LabelDesc.Text;
+			TextSize = LabelDesc.TextSize;
+			TextColor = LabelDesc.TextColor;
+			Bold = LabelDesc.Bold;
+			Underline = LabelDesc.Underline;
+			Italic = LabelDesc.Italic;
+		}
+		else
+		{
+			TextColor = FColor::Black;
+			Bold = false;
+			Underline = false;
+			Italic = false;
+		}
+	}
+}
+
 struct FMixerInteractivityChangeAction : public FPendingLatentAction
 {
 public:
@@ -187,24 +248,21 @@ void UMixerInteractivityBlueprintLibrary::GetButtonState(FMixerButtonReference B
 		GotState = IMixerInteractivityModule::Get().GetButtonState(Button.Name, ButtonState);
 	}
 
-	if (GotState)
-	{
-		RemainingCooldown = ButtonState.RemainingCooldown;
-		Progress = ButtonState.Progress;
-		DownCount = static_cast<int32>(ButtonState.DownCount);
-		PressCount = static_cast<int32>(ButtonState.PressCount);
-		UpCount = static_cast<int32>(ButtonState.UpCount);
-		Enabled = ButtonState.Enabled;
-	}
-	else
-	{
-		RemainingCooldown = FTimespan(0);
-		Progress = 0.0f;
-		DownCount = 0;
-		PressCount = 0;
-		UpCount = 0;
-		Enabled = false;
-	}
+	CopyOutButtonState(GotState, ButtonState, RemainingCooldown, Progress, DownCount, PressCount, UpCount, Enabled);
+}
+
+FMixerResolvedButton UMixerInteractivityBlueprintLibrary::ResolveButton(FMixerButtonReference Button)
+{
+	FMixerResolvedButton Resolved;
+	Resolved.Index = IMixerInteractivityModule::Get().ResolveButton(Button.Name).Index;
+	return Resolved;
+}
+
+void UMixerInteractivityBlueprintLibrary::GetResolvedButtonState(FMixerResolvedButton Button, FTimespan& RemainingCooldown, float& Progress, int32& DownCount, int32& PressCount, int32& UpCount, bool& Enabled)
+{
+	FMixerButtonState ButtonState;
+	bool GotState = IMixerInteractivityModule::Get().GetButtonState(FMixerButtonHandle(Button.Index), ButtonState);
+	CopyOutButtonState(GotState, ButtonState, RemainingCooldown, Progress, DownCount, PressCount, UpCount, Enabled);
 }
 
 void UMixerInteractivityBlueprintLibrary::GetStickDescription(FMixerStickReference Stick, FText& HelpText)
@@ -229,18 +287,21 @@ void UMixerInteractivityBlueprintLibrary::GetStickState(FMixerStickReference Sti
 		GotState = IMixerInteractivityModule::Get().GetStickState(Stick.Name, StickState);
 	}
 
-	if (GotState)
-	{
-		XAxis = StickState.Axes.X;
-		YAxis = StickState.Axes.Y;
-		Enabled = StickState.Enabled;
-	}
-	else
-	{
-		XAxis = 0.0f;
-		YAxis = 0.0f;
-		Enabled = false;
-	}
+	CopyOutStickState(GotState, StickState, XAxis, YAxis, Enabled);
+}
+
+FMixerResolvedStick UMixerInteractivityBlueprintLibrary::ResolveStick(FMixerStickReference Stick)
+{
+	FMixerResolvedStick Resolved;
+	Resolved.Index = IMixerInteractivityModule::Get().ResolveStick(Stick.Name).Index;
+	return Resolved;
+}
+
+void UMixerInteractivityBlueprintLibrary::GetResolvedStickState(FMixerResolvedStick Stick, float& XAxis, float& YAxis, bool& Enabled)
+{
+	FMixerStickState StickState;
+	bool GotState = IMixerInteractivityModule::Get().GetStickState(FMixerStickHandle(Stick.Index), StickState);
+	CopyOutStickState(GotState, StickState, XAxis, YAxis, Enabled);
 }
 
 void UMixerInteractivityBlueprintLibrary::SetLabelText(FMixerLabelReference Label, const FText& Text)
@@ -251,22 +312,22 @@ void UMixerInteractivityBlueprintLibrary::SetLabelText(FMixerLabelReference Labe
 void UMixerInteractivityBlueprintLibrary::GetLabelDescription(FMixerLabelReference Label, FText& Text, FString& TextSize, FColor& TextColor, bool& Bold, bool& Underline, bool& Italic)
 {
 	FMixerLabelDescription LabelDesc;
-	if (IMixerInteractivityModule::Get().GetLabelDescription(Label.Name, LabelDesc))
-	{
-		Text = LabelDesc.Text;
-		TextSize = LabelDesc.TextSize;
-		TextColor = LabelDesc.TextColor;
-		Bold = LabelDesc.Bold;
-		Underline = LabelDesc.Underline;
-		Italic = LabelDesc.Italic;
-	}
-	else
-	{
-		TextColor = FColor::Black;
-		Bold = false;
-		Underline = false;
-		Italic = false;
-	}
+	bool GotDesc = IMixerInteractivityModule::Get().GetLabelDescription(Label.Name, LabelDesc);
+	CopyOutLabelDescription(GotDesc, LabelDesc, Text, TextSize, TextColor, Bold, Underline, Italic);
+}
+
+FMixerResolvedLabel UMixerInteractivityBlueprintLibrary::ResolveLabel(FMixerLabelReference Label)
+{
+	FMixerResolvedLabel Resolved;
+	Resolved.Index = IMixerInteractivityModule::Get().ResolveLabel(Label.Name).Index;
+	return Resolved;
+}
+
+void UMixerInteractivityBlueprintLibrary::GetResolvedLabelDescription(FMixerResolvedLabel Label, FText& Text, FString& TextSize, FColor& TextColor, bool& Bold, bool& Underline, bool& Italic)
+{
+	FMixerLabelDescription LabelDesc;
+	bool GotDesc = IMixerInteractivityModule::Get().GetLabelDescription(FMixerLabelHandle(Label.Index), LabelDesc);
+	CopyOutLabelDescription(GotDesc, LabelDesc, Text, TextSize, TextColor, Bold, Underline, Italic);
 }
 
 void UMixerInteractivityBlueprintLibrary::GetTextboxDescription(FMixerTextboxReference Textbox, FText& PlaceholderText, bool& Multiline, bool& HasSubmit, FText& SubmitText, int32& SparkCost)
@@ -337,15 +398,20 @@ void UMixerInteractivityBlueprintLibrary::GetRemoteParticipantInfo(int32 Partici
 
 void UMixerInteractivityBlueprintLibrary::GetParticipantsInGroup(FMixerGroupReference Group, TArray<int32>& ParticipantIds)
 {
-	TArray<TSharedPtr<const FMixerRemoteUser>> ParticipantInfo;
-	IMixerInteractivityModule::Get().GetParticipantsInGroup(Group.Name, ParticipantInfo);
-	ParticipantIds.Empty(ParticipantInfo.Num());
-	for (TSharedPtr<const FMixerRemoteUser> Info : ParticipantInfo)
+	TArray<uint32> UnsignedIds;
+	IMixerInteractivityModule::Get().GetParticipantIdsInGroup(Group.Name, UnsignedIds);
+	ParticipantIds.Empty(UnsignedIds.Num());
+	for (uint32 Id : UnsignedIds)
 	{
-		ParticipantIds.Add(Info->Id);
+		ParticipantIds.Add(static_cast<int32>(Id));
 	}
 }
 
+int32 UMixerInteractivityBlueprintLibrary::GetParticipantCountInGroup(FMixerGroupReference Group)
+{
+	return IMixerInteractivityModule::Get().GetParticipantCountInGroup(Group.Name);
+}
+
 void UMixerInteractivityBlueprintLibrary::MoveParticipantToGroup(FMixerGroupReference Group, int32 ParticipantId)
 {
 	if (!IMixerInteractivityModule::Get().MoveParticipantToGroup(Group.Name, ParticipantId))
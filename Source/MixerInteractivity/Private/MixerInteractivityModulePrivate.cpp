@@ -13,6 +13,8 @@
 #include "MixerDynamicDelegateBinding.h"
 #include "MixerInteractivityLog.h"
 #include "MixerBindingUtils.h"
+#include "MixerJsonHelpers.h"
+#include "MixerLoopbackWebSocket.h"
 #include "MixerInteractivityProjectAsset.h"
 #include "OnlineChatMixerPrivate.h"
 #include "OnlineChatMixerPrivate.h"
@@ -107,6 +109,28 @@ bool FMixerInteractivityModule::LoginSilently(TSharedPtr<const FUniqueNetId> Use
 		return false;
 	}
 
+#if MIXER_WITH_LOOPBACK_SERVICE
+	const UMixerInteractivitySettings* Settings = GetDefault<UMixerInteractivitySettings>();
+	if (MixerIsLoopbackUrl(Settings->InteractiveEndpointOverride))
+	{
+		// The simulated service doesn't check credentials, so skip the platform login flow entirely.
+		TSharedRef<FMixerLocalUserJsonSerializable> LoopbackUser = MakeShared<FMixerLocalUserJsonSerializable>();
+		LoopbackUser->Name = TEXT("LoopbackStreamer");
+		LoopbackUser->Id = 1;
+		LoopbackUser->Level = 1;
+		LoopbackUser->Channel.Id = 1;
+		LoopbackUser->Channel.Name = LoopbackUser->Name;
+		// There is no user endpoint to poll for updates
+		LoopbackUser->RefreshAtAppTime = MAX_dbl;
+
+		NetId = UserId;
+		SetUserAuthState(EMixerLoginState::Logging_In);
+		CurrentUser = LoopbackUser;
+		SetUserAuthState(EMixerLoginState::Logged_In);
+		return true;
+	}
+#endif
+
 	if (!PLATFORM_XBOXONE && !PLATFORM_SUPPORTS_MIXER_OAUTH && !PLATFORM_NEEDS_OSS_LIVE)
 	{
 		UE_LOG(LogMixerInteractivity, Warning, TEXT("There is no supported user login flow for this platform."));
@@ -339,7 +363,9 @@ bool FMixerInteractivityModule::Tick(float DeltaTime)
 #endif
 
 	TickLocalUserMaintenance();
-	FlushControlUpdates();
+
+	// Urgent changes go out even while the backend wants the rest held back
+	FlushControlUpdates(!IsReadyForControlUpdates());
 
 	if (!NeedsClientLibraryActive())
 	{
@@ -583,6 +609,13 @@ void FMixerInteractivityModule::InitDesignTimeGroups()
 
 bool FMixerInteractivityModule::HandleControlUpdateMessage(FJsonObject* ParamsJson)
 {
+	FString SceneIdRaw;
+	FName SceneName = NAME_None;
+	if (ParamsJson->TryGetStringField(TEXT("sceneID"), SceneIdRaw))
+	{
+		SceneName = *SceneIdRaw;
+	}
+
 	const TArray<TSharedPtr<FJsonValue>> *UpdatedControls;
 	if (ParamsJson->TryGetArrayField(TEXT("controls"), UpdatedControls))
 	{
@@ -596,6 +629,11 @@ bool FMixerInteractivityModule::HandleControlUpdateMessage(FJsonObject* ParamsJs
 				{
 					FName ControlId = *ControlIdRaw;
 					const TSharedRef<FJsonObject> ControlJsonRef = ControlObject.ToSharedRef();
+					if (SceneName != NAME_None)
+					{
+						ControlUpdates.Acknowledge(SceneName, ControlId, *ControlJsonRef);
+					}
+
 					if (!HandleSingleControlUpdate(ControlId, ControlJsonRef))
 					{
 						OnCustomControlPropertyUpdate().Broadcast(ControlId, ControlJsonRef);
@@ -629,40 +667,37 @@ void FMixerInteractivityModule::HandleCustomControlInputMessage(FJsonObject* Par
 
 void FMixerInteractivityModule::UpdateRemoteControl(FName SceneName, FName ControlName, TSharedRef<FJsonObject> PropertiesToUpdate)
 {
-	// @TODO - centralize field name constants
-	static const FString ControlIdField = TEXT("controlID");
-
-	FString ControlNameString = ControlName.ToString();
+	ControlUpdates.Set(SceneName, ControlName, *PropertiesToUpdate);
+}
 
-	TArray<TSharedPtr<FJsonValue>>& ControlsForScene = PendingControlUpdates.FindOrAdd(SceneName);
-	for (TSharedPtr<FJsonValue>& ExistingControlUpdate : ControlsForScene)
-	{
-		TSharedPtr<FJsonObject> UpdateObject = ExistingControlUpdate->AsObject();
-		if (UpdateObject->GetStringField(ControlIdField) == ControlNameString)
+void FMixerInteractivityModule::FlushControlUpdates(bool bUrgentOnly)
+{
+	ControlUpdates.Flush(FPlatformTime::Seconds(), bUrgentOnly,
+		[](FName SceneName) -> FString
 		{
-			UpdateObject->Values.Append(PropertiesToUpdate->Values);
-			return;
-		}
-	}
+			// Special case - 'default' is used all over the place as a name, but with 'D'
+			return SceneName != NAME_DefaultMixerParticipantGroup ? SceneName.ToString() : TEXT("default");
+		},
+		[this](FName SceneName, const ANSICHAR* Utf8ParamsJson, int32 Length, bool bUrgent)
+		{
+			SendControlUpdates(Utf8ParamsJson, Length, bUrgent);
+		});
+}
 
-	PropertiesToUpdate->SetStringField(ControlIdField, ControlName.ToString());
-	ControlsForScene.Add(MakeShared<FJsonValueObject>(PropertiesToUpdate));
+void FMixerInteractivityModule::SendControlUpdates(const ANSICHAR* Utf8ParamsJson, int32 Length, bool bUrgent)
+{
+	CallRemoteMethodWithJsonParams(MixerStringConstants::MethodNames::UpdateControls, Utf8ParamsJson, Length);
 }
 
-void FMixerInteractivityModule::FlushControlUpdates()
+void FMixerInteractivityModule::ApplyControlUpdateSettings()
 {
-	for (TMap<FName, TArray<TSharedPtr<FJsonValue>>>::TIterator It(PendingControlUpdates); It; ++It)
+	const UMixerInteractivitySettings* Settings = GetDefault<UMixerInteractivitySettings>();
+	ControlUpdates.SetLimits(Settings->MaxSceneUpdatesPerSecond, Settings->MaxControlUpdatesPerSecond, Settings->ControlUpdateBytesPerSecondLimit);
+	ControlUpdates.ClearPropertyRules();
+	for (const FMixerControlPropertyUpdateRule& Rule : Settings->ControlPropertyUpdateRules)
 	{
-		TSharedRef<FJsonObject> UpdateMethodParams = MakeShared<FJsonObject>();
-
-		// Special case - 'default' is used all over the place as a name, but with 'D'
-		UpdateMethodParams->SetStringField(TEXT("sceneID"), It->Key != NAME_DefaultMixerParticipantGroup ? It->Key.ToString() : TEXT("default"));
-		UpdateMethodParams->SetArrayField(TEXT("controls"), It->Value);
-
-		CallRemoteMethod(TEXT("updateControls"), UpdateMethodParams);
+		ControlUpdates.SetPropertyRule(Rule.Property, Rule.Tolerance, Rule.bUrgent);
 	}
-
-	PendingControlUpdates.Empty();
 }
 
 TSharedPtr<IOnlineChat> FMixerInteractivityModule::GetChatInterface()
@@ -707,6 +742,16 @@ void FMixerInteractivityModule::SetInteractiveConnectionAuthState(EMixerLoginSta
 		}
 	}
 
+	// A new session starts from the scene definitions, not from anything sent to the last one
+	if (InState == EMixerLoginState::Not_Logged_In)
+	{
+		ControlUpdates.Empty();
+	}
+	else if (InState == EMixerLoginState::Logging_In)
+	{
+		ApplyControlUpdateSettings();
+	}
+
 	EMixerLoginState PreviousFullLoginState = GetLoginState();
 	InteractiveConnectionAuthState = InState;
 	HandleLoginStateChange(PreviousFullLoginState, GetLoginState());
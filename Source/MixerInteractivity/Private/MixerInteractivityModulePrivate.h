@@ -12,6 +12,7 @@
 
 #include "MixerInteractivityModule.h"
 #include "MixerInteractivityTypes.h"
+#include "MixerControlUpdateBuffer.h"
 #include "Containers/Ticker.h"
 #include "UObject/WeakObjectPtrTemplates.h"
 #include "Interfaces/IHttpRequest.h"
@@ -99,6 +100,8 @@ public:
 	virtual bool GetCustomControl(UWorld* ForWorld, FName ControlName, class UMixerCustomControl*& OutControlObject);
 	virtual TSharedPtr<const FMixerLocalUser> GetCurrentUser()				{ return CurrentUser; }
 
+	virtual bool GetOutgoingMessageStats(FMixerOutgoingMessageStats& OutStats)	{ return false; }
+
 	virtual TSharedPtr<class IOnlineChat> GetChatInterface();
 	virtual TSharedPtr<class IOnlineChatMixer> GetExtendedChatInterface();
 
@@ -112,6 +115,7 @@ public:
 	virtual FOnCustomControlPropertyUpdate& OnCustomControlPropertyUpdate()		{ return CustomControlPropertyUpdate; }
 	virtual FOnCustomMethodCall& OnCustomMethodCall()							{ return CustomMethodCall; }
 	virtual FOnTextboxSubmitEvent& OnTextboxSubmitEvent()						{ return TextboxSubmitEvent; }
+	virtual FOnInputFrame& OnInputFrame()										{ return InputFrame; }
 
 public:
 	virtual bool Tick(float DeltaTime);
@@ -135,6 +139,21 @@ protected:
 
 	virtual bool HandleSingleControlUpdate(FName ControlId, const TSharedRef<FJsonObject> ControlData) { return false; }
 
+	/**
+	* Call a method whose params have already been serialized to JSON text.  The text is UTF-8 and
+	* also null terminated, with Length excluding the terminator.
+	*/
+	virtual void CallRemoteMethodWithJsonParams(const FString& MethodName, const ANSICHAR* Utf8ParamsJson, int32 Length) = 0;
+
+	/**
+	* Send the params for an updateControls call.  Urgent updates carry changes that alter what viewers
+	* can do (e.g. disabled or cooldown) and should not wait behind other traffic.
+	*/
+	virtual void SendControlUpdates(const ANSICHAR* Utf8ParamsJson, int32 Length, bool bUrgent);
+
+	/** Return false to keep accumulating control updates, other than urgent ones, rather than sending them this frame. */
+	virtual bool IsReadyForControlUpdates() const { return true; }
+
 private:
 	EMixerLoginState GetUserAuthState() const { return UserAuthState; }
 	void SetUserAuthState(EMixerLoginState InState);
@@ -156,7 +175,8 @@ private:
 	void InitDesignTimeGroups();
 
 	void TickLocalUserMaintenance();
-	void FlushControlUpdates();
+	void FlushControlUpdates(bool bUrgentOnly);
+	void ApplyControlUpdateSettings();
 
 private:
 
@@ -190,10 +210,11 @@ private:
 	FOnCustomControlPropertyUpdate CustomControlPropertyUpdate;
 	FOnCustomMethodCall CustomMethodCall;
 	FOnTextboxSubmitEvent TextboxSubmitEvent;
+	FOnInputFrame InputFrame;
 
 	TSharedPtr<class FOnlineChatMixer> ChatInterface;
 
-	TMap<FName, TArray<TSharedPtr<FJsonValue>>> PendingControlUpdates;
+	FMixerControlUpdateBuffer ControlUpdates;
 
 	bool RetryLoginWithUI;
 };
\ No newline at end of file
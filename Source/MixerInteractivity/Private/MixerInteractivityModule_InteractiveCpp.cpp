@@ -377,6 +377,53 @@ bool FMixerInteractivityModule_InteractiveCpp::GetButtonState(FName Button, uint
 	return false;
 }
 
+bool FMixerInteractivityModule_InteractiveCpp::GetButtonStateForGroup(FName Button, FName GroupName, FMixerButtonState& OutState)
+{
+	UE_LOG(LogMixerInteractivity, Error, TEXT("This implementation does not support per-group control state."));
+	return false;
+}
+
+bool FMixerInteractivityModule_InteractiveCpp::GetButtonPressHistogram(FName Button, FMixerButtonPressHistogram& OutHistogram)
+{
+	UE_LOG(LogMixerInteractivity, Error, TEXT("This implementation does not support button press histograms."));
+	return false;
+}
+
+bool FMixerInteractivityModule_InteractiveCpp::GetParticipantsHoldingButtons(const TArray<FName>& ButtonNames, TArray<uint32>& OutParticipantIds)
+{
+	using namespace Microsoft::mixer;
+
+	TArray<std::shared_ptr<interactive_button_control>> ButtonControls;
+	for (FName Button : ButtonNames)
+	{
+		std::shared_ptr<interactive_button_control> ButtonControl = FindButton(Button);
+		if (!ButtonControl)
+		{
+			return false;
+		}
+		ButtonControls.Add(ButtonControl);
+	}
+
+	for (const std::shared_ptr<interactive_participant>& Participant : interactivity_manager::get_singleton_instance()->participants())
+	{
+		bool bHoldingAll = ButtonControls.Num() > 0;
+		for (const std::shared_ptr<interactive_button_control>& ButtonControl : ButtonControls)
+		{
+			if (!ButtonControl->is_down(Participant->mixer_id()))
+			{
+				bHoldingAll = false;
+				break;
+			}
+		}
+
+		if (bHoldingAll)
+		{
+			OutParticipantIds.Add(Participant->mixer_id());
+		}
+	}
+	return true;
+}
+
 bool FMixerInteractivityModule_InteractiveCpp::GetStickDescription(FName Stick, FMixerStickDescription& OutDesc)
 {
 	using namespace Microsoft::mixer;
@@ -398,6 +445,12 @@ bool FMixerInteractivityModule_InteractiveCpp::GetStickState(FName Stick, FMixer
 	if (StickControl)
 	{
 		OutState.Axes = FVector2D(static_cast<float>(StickControl->x()), static_cast<float>(StickControl->y()));
+		// The SDK only exposes the mean
+		OutState.AxesVariance = FVector2D(0, 0);
+		OutState.LevelWeightedAxes = OutState.Axes;
+		OutState.MedianAxes = OutState.Axes;
+		OutState.TrimmedMeanAxes = OutState.Axes;
+		OutState.ParticipantCount = 0;
 		OutState.Enabled = true; //!StickControl->disabled();
 		return true;
 	}
@@ -412,12 +465,23 @@ bool FMixerInteractivityModule_InteractiveCpp::GetStickState(FName Stick, uint32
 	if (StickControl)
 	{
 		OutState.Axes = FVector2D(static_cast<float>(StickControl->x(ParticipantId)), static_cast<float>(StickControl->y(ParticipantId)));
+		OutState.AxesVariance = FVector2D(0, 0);
+		OutState.LevelWeightedAxes = OutState.Axes;
+		OutState.MedianAxes = OutState.Axes;
+		OutState.TrimmedMeanAxes = OutState.Axes;
+		OutState.ParticipantCount = OutState.Axes.IsZero() ? 0 : 1;
 		OutState.Enabled = true; //!StickControl->disabled();
 		return true;
 	}
 	return false;
 }
 
+bool FMixerInteractivityModule_InteractiveCpp::GetStickStateForGroup(FName Stick, FName GroupName, FMixerStickState& OutState)
+{
+	UE_LOG(LogMixerInteractivity, Error, TEXT("This implementation does not support per-group control state."));
+	return false;
+}
+
 void FMixerInteractivityModule_InteractiveCpp::SetLabelText(FName Label, const FText& DisplayText)
 {
 	UE_LOG(LogMixerInteractivity, Error, TEXT("This implementation does not support setting label text."));
@@ -433,6 +497,69 @@ bool FMixerInteractivityModule_InteractiveCpp::GetTextboxDescription(FName Textb
 	return false;
 }
 
+FMixerButtonHandle FMixerInteractivityModule_InteractiveCpp::ResolveButton(FName Button)
+{
+	return FMixerButtonHandle(ResolveControlName(Button));
+}
+
+bool FMixerInteractivityModule_InteractiveCpp::GetButtonDescription(FMixerButtonHandle Button, FMixerButtonDescription& OutDesc)
+{
+	return GetButtonDescription(GetResolvedControlName(Button), OutDesc);
+}
+
+bool FMixerInteractivityModule_InteractiveCpp::GetButtonState(FMixerButtonHandle Button, FMixerButtonState& OutState)
+{
+	return GetButtonState(GetResolvedControlName(Button), OutState);
+}
+
+FMixerStickHandle FMixerInteractivityModule_InteractiveCpp::ResolveStick(FName Stick)
+{
+	return FMixerStickHandle(ResolveControlName(Stick));
+}
+
+bool FMixerInteractivityModule_InteractiveCpp::GetStickState(FMixerStickHandle Stick, FMixerStickState& OutState)
+{
+	return GetStickState(GetResolvedControlName(Stick), OutState);
+}
+
+FMixerLabelHandle FMixerInteractivityModule_InteractiveCpp::ResolveLabel(FName Label)
+{
+	return FMixerLabelHandle(ResolveControlName(Label));
+}
+
+bool FMixerInteractivityModule_InteractiveCpp::GetLabelDescription(FMixerLabelHandle Label, FMixerLabelDescription& OutDesc)
+{
+	return GetLabelDescription(GetResolvedControlName(Label), OutDesc);
+}
+
+FMixerTextboxHandle FMixerInteractivityModule_InteractiveCpp::ResolveTextbox(FName Textbox)
+{
+	return FMixerTextboxHandle(ResolveControlName(Textbox));
+}
+
+bool FMixerInteractivityModule_InteractiveCpp::GetTextboxDescription(FMixerTextboxHandle Textbox, FMixerTextboxDescription& OutDesc)
+{
+	return GetTextboxDescription(GetResolvedControlName(Textbox), OutDesc);
+}
+
+int32 FMixerInteractivityModule_InteractiveCpp::ResolveControlName(FName Name)
+{
+	const int32* ExistingIndex = ResolvedControlIndices.Find(Name);
+	if (ExistingIndex != nullptr)
+	{
+		return *ExistingIndex;
+	}
+
+	const int32 NewIndex = ResolvedControlNames.Add(Name);
+	ResolvedControlIndices.Add(Name, NewIndex);
+	return NewIndex;
+}
+
+FName FMixerInteractivityModule_InteractiveCpp::GetResolvedControlName(const FMixerControlHandle& Handle) const
+{
+	return ResolvedControlNames.IsValidIndex(Handle.Index) ? ResolvedControlNames[Handle.Index] : NAME_None;
+}
+
 std::shared_ptr<Microsoft::mixer::interactive_button_control> FMixerInteractivityModule_InteractiveCpp::FindButton(FName Name)
 {
 	using namespace Microsoft::mixer;
@@ -559,6 +686,34 @@ bool FMixerInteractivityModule_InteractiveCpp::GetParticipantsInGroup(FName Grou
 	return FoundGroup;
 }
 
+bool FMixerInteractivityModule_InteractiveCpp::GetParticipantIdsInGroup(FName GroupName, TArray<uint32>& OutParticipantIds)
+{
+	using namespace Microsoft::mixer;
+
+	// Unlike GetParticipantsInGroup this doesn't need to refresh the cached participant for every member
+	std::shared_ptr<interactive_group> ExistingGroup = interactivity_manager::get_singleton_instance()->group(*GroupName.ToString());
+	if (!ExistingGroup)
+	{
+		return false;
+	}
+
+	const std::vector<std::shared_ptr<interactive_participant>> ParticipantsInternal = ExistingGroup->participants();
+	OutParticipantIds.Reserve(OutParticipantIds.Num() + ParticipantsInternal.size());
+	for (const std::shared_ptr<interactive_participant>& Participant : ParticipantsInternal)
+	{
+		OutParticipantIds.Add(Participant->mixer_id());
+	}
+	return true;
+}
+
+int32 FMixerInteractivityModule_InteractiveCpp::GetParticipantCountInGroup(FName GroupName)
+{
+	using namespace Microsoft::mixer;
+
+	std::shared_ptr<interactive_group> ExistingGroup = interactivity_manager::get_singleton_instance()->group(*GroupName.ToString());
+	return ExistingGroup ? static_cast<int32>(ExistingGroup->participants().size()) : 0;
+}
+
 bool FMixerInteractivityModule_InteractiveCpp::MoveParticipantToGroup(FName GroupName, uint32 ParticipantId)
 {
 	using namespace Microsoft::mixer;
@@ -642,6 +797,11 @@ void FMixerInteractivityModule_InteractiveCpp::CallRemoteMethod(const FString& M
 	//Microsoft::mixer::interactivity_manager::get_singleton_instance()->send_rpc_message(*MethodName, *SerializedParams);
 }
 
+void FMixerInteractivityModule_InteractiveCpp::CallRemoteMethodWithJsonParams(const FString& MethodName, const ANSICHAR* Utf8ParamsJson, int32 Length)
+{
+	// As above, nothing to send it with.  Not worth parsing the text back into an object just to drop it.
+}
+
 FMixerRemoteUserCached::FMixerRemoteUserCached(std::shared_ptr<Microsoft::mixer::interactive_participant> InParticipant)
 	: SourceParticipant(InParticipant)
 {
@@ -48,15 +48,30 @@ public:
 	virtual bool GetButtonDescription(FName Button, FMixerButtonDescription& OutDesc);
 	virtual bool GetButtonState(FName Button, FMixerButtonState& OutState);
 	virtual bool GetButtonState(FName Button, uint32 ParticipantId, FMixerButtonState& OutState);
+	virtual bool GetButtonStateForGroup(FName Button, FName GroupName, FMixerButtonState& OutState);
+	virtual bool GetButtonPressHistogram(FName Button, FMixerButtonPressHistogram& OutHistogram);
+	virtual bool GetParticipantsHoldingButtons(const TArray<FName>& ButtonNames, TArray<uint32>& OutParticipantIds);
 	virtual bool GetStickDescription(FName Stick, FMixerStickDescription& OutDesc);
 	virtual bool GetStickState(FName Stick, FMixerStickState& OutState);
 	virtual bool GetStickState(FName Stick, uint32 ParticipantId, FMixerStickState& OutState);
+	virtual bool GetStickStateForGroup(FName Stick, FName GroupName, FMixerStickState& OutState);
 	virtual void SetLabelText(FName Label, const FText& DisplayText);
 	virtual bool GetLabelDescription(FName Label, FMixerLabelDescription& OutDesc);
 	virtual bool GetTextboxDescription(FName Textbox, FMixerTextboxDescription& OutDesc);
+	virtual FMixerButtonHandle ResolveButton(FName Button);
+	virtual bool GetButtonDescription(FMixerButtonHandle Button, FMixerButtonDescription& OutDesc);
+	virtual bool GetButtonState(FMixerButtonHandle Button, FMixerButtonState& OutState);
+	virtual FMixerStickHandle ResolveStick(FName Stick);
+	virtual bool GetStickState(FMixerStickHandle Stick, FMixerStickState& OutState);
+	virtual FMixerLabelHandle ResolveLabel(FName Label);
+	virtual bool GetLabelDescription(FMixerLabelHandle Label, FMixerLabelDescription& OutDesc);
+	virtual FMixerTextboxHandle ResolveTextbox(FName Textbox);
+	virtual bool GetTextboxDescription(FMixerTextboxHandle Textbox, FMixerTextboxDescription& OutDesc);
 	virtual TSharedPtr<const FMixerRemoteUser> GetParticipant(uint32 ParticipantId);
 	virtual bool CreateGroup(FName GroupName, FName InitialScene = NAME_None);
 	virtual bool GetParticipantsInGroup(FName GroupName, TArray<TSharedPtr<const FMixerRemoteUser>>& OutParticipants);
+	virtual bool GetParticipantIdsInGroup(FName GroupName, TArray<uint32>& OutParticipantIds);
+	virtual int32 GetParticipantCountInGroup(FName GroupName);
 	virtual bool MoveParticipantToGroup(FName GroupName, uint32 ParticipantId);
 	virtual void CaptureSparkTransaction(const FString& TransactionId);
 	virtual void CallRemoteMethod(const FString& MethodName, const TSharedRef<FJsonObject> MethodParams);
@@ -67,16 +82,23 @@ public:
 protected:
 	virtual bool StartInteractiveConnection();
 	virtual void StopInteractiveConnection();
+	virtual void CallRemoteMethodWithJsonParams(const FString& MethodName, const ANSICHAR* Utf8ParamsJson, int32 Length) override;
 
 private:
 	std::shared_ptr<Microsoft::mixer::interactive_button_control> FindButton(FName Name);
 	std::shared_ptr<Microsoft::mixer::interactive_joystick_control> FindStick(FName Name);
 	TSharedPtr<FMixerRemoteUserCached> CreateOrUpdateCachedParticipant(std::shared_ptr<Microsoft::mixer::interactive_participant> Participant);
 
+	/** The SDK only looks controls up by name, so handles just index a list of names. */
+	int32 ResolveControlName(FName Name);
+	FName GetResolvedControlName(const FMixerControlHandle& Handle) const;
+
 	void TickParticipantCacheMaintenance();
 
 private:
 	TMap<uint32, TSharedPtr<FMixerRemoteUserCached>> RemoteParticipantCache;
+	TArray<FName> ResolvedControlNames;
+	TMap<FName, int32> ResolvedControlIndices;
 };
 
 #endif // MIXER_BACKEND_INTERACTIVE_CPP
\ No newline at end of file
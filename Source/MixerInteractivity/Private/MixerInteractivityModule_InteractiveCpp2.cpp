@@ -163,15 +163,15 @@ bool FMixerInteractivityModule_InteractiveCpp2::MoveParticipantToGroup(FName Gro
 		return false;
 	}
 
-	TSharedPtr<FMixerRemoteUser> Participant = GetCachedUser(ParticipantId);
-	if (!Participant.IsValid())
+	FMixerParticipantHandle Participant = FindCachedUser(ParticipantId);
+	if (!Participant.IsSet())
 	{
 		return false;
 	}
 
 	return interactive_set_participant_group(
 		InteractiveSession,
-		TCHAR_TO_UTF8(*Participant->SessionGuid.ToString(EGuidFormats::DigitsWithHyphens).ToLower()),
+		TCHAR_TO_UTF8(*GetCachedUsers().GetSessionGuid(Participant).ToString(EGuidFormats::DigitsWithHyphens).ToLower()),
 		GroupName.GetPlainANSIString()) == MIXER_OK;
 }
 
@@ -196,6 +196,15 @@ void FMixerInteractivityModule_InteractiveCpp2::CallRemoteMethod(const FString&
 	}
 }
 
+void FMixerInteractivityModule_InteractiveCpp2::CallRemoteMethodWithJsonParams(const FString& MethodName, const ANSICHAR* Utf8ParamsJson, int32 Length)
+{
+	if (InteractiveSession != nullptr)
+	{
+		uint32 MessageId = 0;
+		interactive_send_method(InteractiveSession, TCHAR_TO_UTF8(*MethodName), Utf8ParamsJson, true, &MessageId);
+	}
+}
+
 bool FMixerInteractivityModule_InteractiveCpp2::StartInteractiveConnection()
 {
 	if (GetInteractiveConnectionAuthState() != EMixerLoginState::Not_Logged_In)
@@ -313,15 +322,19 @@ void FMixerInteractivityModule_InteractiveCpp2::OnSessionInput(void* Context, in
 {
 	FMixerInteractivityModule_InteractiveCpp2& InteractiveModule = static_cast<FMixerInteractivityModule_InteractiveCpp2&>(IMixerInteractivityModule::Get());
 
-	FGuid ParticipantGuid;
-	if (!FGuid::Parse(Input->participantId, ParticipantGuid))
+	// Known participants are found from the id text recorded when they joined
+	FMixerParticipantHandle ButtonUser = InteractiveModule.FindCachedUser(Input->participantId, static_cast<int32>(Input->participantIdLength));
+	if (!ButtonUser.IsSet())
 	{
-		UE_LOG(LogMixerInteractivity, Error, TEXT("Participant id %hs was not in the expected format (guid)"), Input->participantId);
-		return;
+		FGuid ParticipantGuid;
+		if (!FGuid::Parse(Input->participantId, ParticipantGuid))
+		{
+			UE_LOG(LogMixerInteractivity, Error, TEXT("Participant id %hs was not in the expected format (guid)"), Input->participantId);
+			return;
+		}
+		ButtonUser = InteractiveModule.FindCachedUser(ParticipantGuid);
 	}
 
-	TSharedPtr<FMixerRemoteUser> ButtonUser = InteractiveModule.GetCachedUser(ParticipantGuid);
-
 	switch (Input->type)
 	{
 	case input_type_click:
@@ -339,79 +352,44 @@ void FMixerInteractivityModule_InteractiveCpp2::OnSessionInput(void* Context, in
 	}
 }
 
-void FMixerInteractivityModule_InteractiveCpp2::OnSessionButtonInput(TSharedPtr<const FMixerRemoteUser> User, const interactive_input* Input)
+void FMixerInteractivityModule_InteractiveCpp2::OnSessionButtonInput(FMixerParticipantHandle User, const interactive_input* Input)
 {
-	FMixerButtonPropertiesCached* CachedProps = GetButton(FName(Input->control.id));
+	const FMixerControlDirectoryEntry Control = FindControl(Input->control.id, static_cast<int32>(Input->control.idLength));
+	if (Control.Kind != EMixerControlKind::Button)
+	{
+		return;
+	}
+
+	const bool bPressed = Input->buttonData.action == interactive_button_action_down;
+	const FMixerButtonHandle Button(Control.Index);
+	FMixerButtonPropertiesCached* CachedProps = ProcessButtonInput(Button, User, bPressed);
 	if (CachedProps != nullptr)
 	{
 		FMixerButtonEventDetails ButtonEventDetails;
-		ButtonEventDetails.Pressed = Input->buttonData.action == interactive_button_action_down;
+		ButtonEventDetails.Pressed = bPressed;
 		ButtonEventDetails.TransactionId = Input->transactionId;
 		ButtonEventDetails.SparkCost = CachedProps->Desc.SparkCost;
-		if (ButtonEventDetails.Pressed)
-		{
-			CachedProps->State.DownCount += 1;
-			if (CachePerParticipantState())
-			{
-				CachedProps->HoldingParticipants.Add(User->Id);
-				CachedProps->State.PressCount = CachedProps->HoldingParticipants.Num();
-			}
-		}
-		else
-		{
-			CachedProps->State.UpCount += 1;
-			if (CachePerParticipantState())
-			{
-				CachedProps->HoldingParticipants.Remove(User->Id);
-				CachedProps->State.PressCount = CachedProps->HoldingParticipants.Num();
-			}
-		}
 
-		OnButtonEvent().Broadcast(Input->control.id, User, ButtonEventDetails);
+		DispatchButtonEvent(Button, User, ButtonEventDetails);
 	}
 }
 
-void FMixerInteractivityModule_InteractiveCpp2::OnSessionCoordinateInput(TSharedPtr<const FMixerRemoteUser> User, const interactive_input* Input)
+void FMixerInteractivityModule_InteractiveCpp2::OnSessionCoordinateInput(FMixerParticipantHandle User, const interactive_input* Input)
 {
-	if (CachePerParticipantState())
+	const FMixerControlDirectoryEntry Control = FindControl(Input->control.id, static_cast<int32>(Input->control.idLength));
+	if (Control.Kind != EMixerControlKind::Stick)
 	{
-		FMixerStickPropertiesCached* CachedProps = GetStick(FName(Input->control.id));
-		if (CachedProps != nullptr)
-		{
-			if (Input->coordinateData.x != 0 || Input->coordinateData.y != 0)
-			{
-				CachedProps->State.Axes *= CachedProps->PerParticipantStickValue.Num();
-				FVector2D& PerUserStickValue = CachedProps->PerParticipantStickValue.FindOrAdd(User->Id);
-				CachedProps->State.Axes -= PerUserStickValue;
-				PerUserStickValue = FVector2D(Input->coordinateData.x, Input->coordinateData.y);
-				CachedProps->State.Axes += PerUserStickValue;
-				CachedProps->State.Axes /= CachedProps->PerParticipantStickValue.Num();
-			}
-			else
-			{
-				FVector2D* OldPerUserStickValue = CachedProps->PerParticipantStickValue.Find(User->Id);
-				if (OldPerUserStickValue != nullptr)
-				{
-					CachedProps->State.Axes *= CachedProps->PerParticipantStickValue.Num();
-					CachedProps->State.Axes -= *OldPerUserStickValue;
-					CachedProps->PerParticipantStickValue.Remove(User->Id);
-					if (CachedProps->PerParticipantStickValue.Num() > 0)
-					{
-						CachedProps->State.Axes /= CachedProps->PerParticipantStickValue.Num();
-					}
-					else
-					{
-						CachedProps->State.Axes = FVector2D(0, 0);
-					}
-				}
-			}
-		}
+		return;
 	}
 
-	OnStickEvent().Broadcast(Input->control.id, User, FVector2D(Input->coordinateData.x, Input->coordinateData.y));
+	const FMixerStickHandle Stick(Control.Index);
+	FVector2D Position = FVector2D(Input->coordinateData.x, Input->coordinateData.y);
+	ProcessStickInput(Stick, User, Position);
+
+	DispatchStickEvent(Stick, User, Position);
 }
 
-bool FMixerInteractivityModule_InteractiveCpp2::OnSessionCustomInput(TSharedPtr<const FMixerRemoteUser> User, const interactive_input* Input)
+bool FMixerInteractivityModule_InteractiveCpp2::OnSessionCustomInput(FMixerParticipantHandle User, const interactive_input* Input)
 {
 	TSharedRef<TJsonReader<>> JsonReader = TJsonReaderFactory<>::Create(FString(UTF8_TO_TCHAR(Input->jsonData)));
 	TSharedPtr<FJsonObject> FullParamsJson;
@@ -429,11 +407,12 @@ bool FMixerInteractivityModule_InteractiveCpp2::OnSessionCustomInput(TSharedPtr<
 	GET_JSON_STRING_RETURN_FAILURE(ControlId, ControlIdRaw);
 	GET_JSON_STRING_RETURN_FAILURE(Event, EventType);
 
-	FName ControlId = *ControlIdRaw;
+	const FMixerControlDirectoryEntry Control = FindControl(ControlIdRaw);
 	bool bHandled = false;
-	if (EventType == MixerStringConstants::EventTypes::Submit)
+	if (Control.Kind == EMixerControlKind::Textbox && EventType == MixerStringConstants::EventTypes::Submit)
 	{
-		FMixerTextboxPropertiesCached* Textbox = GetTextbox(ControlId);
+		const FMixerTextboxHandle TextboxHandle(Control.Index);
+		FMixerTextboxPropertiesCached* Textbox = GetTextbox(TextboxHandle);
 		if (Textbox != nullptr)
 		{
 			GET_JSON_STRING_RETURN_FAILURE(Value, Value);
@@ -452,14 +431,14 @@ bool FMixerInteractivityModule_InteractiveCpp2::OnSessionCustomInput(TSharedPtr<
 				EventDetails.SparkCost = 0;
 			}
 
-			OnTextboxSubmitEvent().Broadcast(ControlId, User, EventDetails);
+			DispatchTextboxSubmitEvent(TextboxHandle, User, EventDetails);
 			bHandled = true;
 		}
 	}
 
 	if (!bHandled)
 	{
-		OnCustomControlInput().Broadcast(ControlId, *EventType, User, InputObj->ToSharedRef());
+		OnCustomControlInput().Broadcast(*ControlIdRaw, *EventType, GetCachedUserView(User), InputObj->ToSharedRef());
 	}
 
 	return true;
@@ -480,18 +459,18 @@ void FMixerInteractivityModule_InteractiveCpp2::OnSessionParticipantsChanged(voi
 	{
 	case participant_join:
 		{
-			TSharedPtr<FMixerRemoteUser> CachedParticipant = MakeShared<FMixerRemoteUser>();
-			CachedParticipant->Id = Participant->userId;
-			CachedParticipant->SessionGuid = SessionGuid;
-			CachedParticipant->Name = UTF8_TO_TCHAR(Participant->userName);
-			CachedParticipant->Level = Participant->level;
-			CachedParticipant->Group = Participant->groupId;
-			CachedParticipant->InputEnabled = !Participant->disabled;
+			FMixerRemoteUser CachedParticipant;
+			CachedParticipant.Id = Participant->userId;
+			CachedParticipant.SessionGuid = SessionGuid;
+			CachedParticipant.Name = UTF8_TO_TCHAR(Participant->userName);
+			CachedParticipant.Level = Participant->level;
+			CachedParticipant.Group = Participant->groupId;
+			CachedParticipant.InputEnabled = !Participant->disabled;
 			// Timestamps are in ms since January 1 1970
-			CachedParticipant->ConnectedAt = FDateTime::FromUnixTimestamp(static_cast<int64>(Participant->connectedAtMs / 1000.0));
-			CachedParticipant->InputAt = FDateTime::FromUnixTimestamp(static_cast<int64>(Participant->lastInputAtMs / 1000.0));
+			CachedParticipant.ConnectedAt = FDateTime::FromUnixTimestamp(static_cast<int64>(Participant->connectedAtMs / 1000.0));
+			CachedParticipant.InputAt = FDateTime::FromUnixTimestamp(static_cast<int64>(Participant->lastInputAtMs / 1000.0));
 
-			InteractiveModule.AddUser(CachedParticipant);
+			InteractiveModule.AddUser(CachedParticipant, Participant->id, static_cast<int32>(Participant->idLength));
 		}
 		break;
 
@@ -501,14 +480,17 @@ void FMixerInteractivityModule_InteractiveCpp2::OnSessionParticipantsChanged(voi
 
 	case participant_update:
 		{
-			TSharedPtr<FMixerRemoteUser> CachedParticipant = InteractiveModule.GetCachedUser(SessionGuid);
-			check(CachedParticipant.IsValid());
-			check(CachedParticipant->Id == Participant->userId);
-			CachedParticipant->Name = UTF8_TO_TCHAR(Participant->userName);
-			CachedParticipant->Level = Participant->level;
-			CachedParticipant->Group = Participant->groupId;
-			CachedParticipant->InputAt = FDateTime::FromUnixTimestamp(static_cast<int64>(Participant->lastInputAtMs / 1000.0));
-			CachedParticipant->InputEnabled = !Participant->disabled;
+			FMixerParticipantHandle CachedHandle = InteractiveModule.FindCachedUser(SessionGuid);
+			check(CachedHandle.IsSet());
+			FMixerRemoteUser CachedParticipant;
+			InteractiveModule.GetCachedUsers().GetUser(CachedHandle, CachedParticipant);
+			check(CachedParticipant.Id == Participant->userId);
+			CachedParticipant.Name = UTF8_TO_TCHAR(Participant->userName);
+			CachedParticipant.Level = Participant->level;
+			CachedParticipant.Group = Participant->groupId;
+			CachedParticipant.InputAt = FDateTime::FromUnixTimestamp(static_cast<int64>(Participant->lastInputAtMs / 1000.0));
+			CachedParticipant.InputEnabled = !Participant->disabled;
+			InteractiveModule.UpdateUser(CachedHandle, CachedParticipant);
 	}
 		break;
 
@@ -590,14 +572,14 @@ void FMixerInteractivityModule_InteractiveCpp2::OnEnumerateControlsForInit(void*
 
 		CachedProps.SceneId = Scene->id;
 
-		InteractiveModule.AddButton(FName(Control->id), CachedProps);
+		InteractiveModule.AddButton(UTF8_TO_TCHAR(Control->id), CachedProps);
 	}
 	else if (FPlatformString::Strcmp(Control->kind, "joystick") == 0)
 	{
 		FMixerStickPropertiesCached CachedProps;
 		CachedProps.State.Enabled = true;
 
-		InteractiveModule.AddStick(FName(Control->id), CachedProps);
+		InteractiveModule.AddStick(UTF8_TO_TCHAR(Control->id), CachedProps);
 	}
 	else if (FPlatformString::Strcmp(Control->kind, "label") == 0)
 	{
@@ -610,7 +592,7 @@ void FMixerInteractivityModule_InteractiveCpp2::OnEnumerateControlsForInit(void*
 
 		CachedProps.SceneId = Scene->id;
 
-		InteractiveModule.AddLabel(FName(Control->id), CachedProps);
+		InteractiveModule.AddLabel(UTF8_TO_TCHAR(Control->id), CachedProps);
 	}
 	else if (FPlatformString::Strcmp(Control->kind, "textbox") == 0)
 	{
@@ -621,7 +603,7 @@ void FMixerInteractivityModule_InteractiveCpp2::OnEnumerateControlsForInit(void*
 		GetControlPropertyHelper(Session, Control->id, "multiline", Textbox.Desc.Multiline);
 		GetControlPropertyHelper(Session, Control->id, "submitText", Textbox.Desc.SubmitText);
 
-		InteractiveModule.AddTextbox(FName(Control->id), Textbox);
+		InteractiveModule.AddTextbox(UTF8_TO_TCHAR(Control->id), Textbox);
 	}
 }
 
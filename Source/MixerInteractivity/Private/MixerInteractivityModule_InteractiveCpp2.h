@@ -36,6 +36,7 @@ public:
 protected:
 	virtual bool StartInteractiveConnection();
 	virtual void StopInteractiveConnection();
+	virtual void CallRemoteMethodWithJsonParams(const FString& MethodName, const ANSICHAR* Utf8ParamsJson, int32 Length) override;
 
 private:
 
@@ -46,9 +47,9 @@ private:
 	static void OnUnhandledMethod(void* Context, interactive_session Session, const char* MethodJson, size_t MethodJsonLength);
 	static void OnTransactionComplete(void *Context, interactive_session Session, const char* TransactionId, size_t TransactionIdLength, unsigned int ErrorCode, const char* ErrorMessage, size_t ErrorMessageLength);
 
-	void OnSessionButtonInput(TSharedPtr<const FMixerRemoteUser> User, const interactive_input* Input);
-	void OnSessionCoordinateInput(TSharedPtr<const FMixerRemoteUser> User, const interactive_input* Input);
-	bool OnSessionCustomInput(TSharedPtr<const FMixerRemoteUser> User, const interactive_input* Input);
+	void OnSessionButtonInput(FMixerParticipantHandle User, const interactive_input* Input);
+	void OnSessionCoordinateInput(FMixerParticipantHandle User, const interactive_input* Input);
+	bool OnSessionCustomInput(FMixerParticipantHandle User, const interactive_input* Input);
 
 	struct FGetCurrentSceneEnumContext
 	{
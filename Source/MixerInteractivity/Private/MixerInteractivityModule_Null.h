@@ -24,15 +24,30 @@ public:
 	virtual bool GetButtonDescription(FName Button, FMixerButtonDescription& OutDesc) { return false; }
 	virtual bool GetButtonState(FName Button, FMixerButtonState& OutState) { return false; }
 	virtual bool GetButtonState(FName Button, uint32 ParticipantId, FMixerButtonState& OutState) { return false; }
+	virtual bool GetButtonStateForGroup(FName Button, FName GroupName, FMixerButtonState& OutState) { return false; }
+	virtual bool GetButtonPressHistogram(FName Button, FMixerButtonPressHistogram& OutHistogram) { return false; }
+	virtual bool GetParticipantsHoldingButtons(const TArray<FName>& ButtonNames, TArray<uint32>& OutParticipantIds) { return false; }
 	virtual bool GetStickDescription(FName Stick, FMixerStickDescription& OutDesc) { return false; }
 	virtual bool GetStickState(FName Stick, FMixerStickState& OutState) { return false; }
 	virtual bool GetStickState(FName Stick, uint32 ParticipantId, FMixerStickState& OutState) { return false; }
+	virtual bool GetStickStateForGroup(FName Stick, FName GroupName, FMixerStickState& OutState) { return false; }
 	virtual void SetLabelText(FName Label, const FText& DisplayText) {}
 	virtual bool GetLabelDescription(FName Label, FMixerLabelDescription& OutDesc) { return false; }
 	virtual bool GetTextboxDescription(FName Textbox, FMixerTextboxDescription& OutDesc) { return false; }
+	virtual FMixerButtonHandle ResolveButton(FName Button) { return FMixerButtonHandle(); }
+	virtual bool GetButtonDescription(FMixerButtonHandle Button, FMixerButtonDescription& OutDesc) { return false; }
+	virtual bool GetButtonState(FMixerButtonHandle Button, FMixerButtonState& OutState) { return false; }
+	virtual FMixerStickHandle ResolveStick(FName Stick) { return FMixerStickHandle(); }
+	virtual bool GetStickState(FMixerStickHandle Stick, FMixerStickState& OutState) { return false; }
+	virtual FMixerLabelHandle ResolveLabel(FName Label) { return FMixerLabelHandle(); }
+	virtual bool GetLabelDescription(FMixerLabelHandle Label, FMixerLabelDescription& OutDesc) { return false; }
+	virtual FMixerTextboxHandle ResolveTextbox(FName Textbox) { return FMixerTextboxHandle(); }
+	virtual bool GetTextboxDescription(FMixerTextboxHandle Textbox, FMixerTextboxDescription& OutDesc) { return false; }
 	virtual TSharedPtr<const FMixerRemoteUser> GetParticipant(uint32 ParticipantId) { return nullptr; }
 	virtual bool CreateGroup(FName GroupName, FName InitialScene = NAME_None) { return false; }
 	virtual bool GetParticipantsInGroup(FName GroupName, TArray<TSharedPtr<const FMixerRemoteUser>>& OutParticipants) { return false; }
+	virtual bool GetParticipantIdsInGroup(FName GroupName, TArray<uint32>& OutParticipantIds) { return false; }
+	virtual int32 GetParticipantCountInGroup(FName GroupName) { return 0; }
 	virtual bool MoveParticipantToGroup(FName GroupName, uint32 ParticipantId) { return false; }
 	virtual void CaptureSparkTransaction(const FString& TransactionId) {}
 	virtual void CallRemoteMethod(const FString& MethodName, const TSharedRef<FJsonObject> MethodParams) {}
@@ -40,6 +55,7 @@ public:
 protected:
 	virtual bool StartInteractiveConnection() { return false; }
 	virtual void StopInteractiveConnection() {}
+	virtual void CallRemoteMethodWithJsonParams(const FString& MethodName, const ANSICHAR* Utf8ParamsJson, int32 Length) {}
 };
 
 #endif // MIXER_BACKEND_NULL
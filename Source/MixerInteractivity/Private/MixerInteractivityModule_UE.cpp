@@ -28,73 +28,86 @@
 
 IMPLEMENT_MODULE(FMixerInteractivityModule_UE, MixerInteractivity);
 
-struct FMixerReadyMessageParams : public FJsonSerializable
+struct FMixerReadyMessageParams
 {
 public:
 	bool bReady;
 public:
-	BEGIN_JSON_SERIALIZER
-		JSON_SERIALIZE("isReady", bReady);
-	END_JSON_SERIALIZER
+	template <class WriterType>
+	void WriteJsonFields(WriterType& Writer) const
+	{
+		Writer.WriteField("isReady", bReady);
+	}
 };
 
-struct FMixerUpdateGroupMessageParamsEntry : public FJsonSerializable
+struct FMixerUpdateGroupMessageParamsEntry
 {
 public:
 	FString GroupId;
 	FString SceneId;
 public:
-	BEGIN_JSON_SERIALIZER
-		JSON_SERIALIZE("groupID", GroupId);
-		JSON_SERIALIZE("sceneID", SceneId);
-	END_JSON_SERIALIZER
+	template <class WriterType>
+	void WriteJsonFields(WriterType& Writer) const
+	{
+		Writer.WriteField("groupID", GroupId);
+		Writer.WriteField("sceneID", SceneId);
+	}
 };
 
-struct FMixerUpdateGroupMessageParams : public FJsonSerializable
+struct FMixerUpdateGroupMessageParams
 {
 public:
 	TArray<FMixerUpdateGroupMessageParamsEntry> Groups;
 public:
-	BEGIN_JSON_SERIALIZER
-		JSON_SERIALIZE_ARRAY_SERIALIZABLE("groups", Groups, FMixerUpdateGroupMessageParamsEntry);
-	END_JSON_SERIALIZER
+	template <class WriterType>
+	void WriteJsonFields(WriterType& Writer) const
+	{
+		Writer.WriteField("groups", Groups);
+	}
 };
 
-struct FMixerUpdateParticipantGroupParamsEntry : public FJsonSerializable
+struct FMixerUpdateParticipantGroupParamsEntry
 {
 public:
 	FString ParticipantSessionGuid;
 	FString GroupId;
 public:
-	BEGIN_JSON_SERIALIZER
-		JSON_SERIALIZE("sessionID", ParticipantSessionGuid);
-		JSON_SERIALIZE("groupID", GroupId);
-	END_JSON_SERIALIZER
+	template <class WriterType>
+	void WriteJsonFields(WriterType& Writer) const
+	{
+		Writer.WriteField("sessionID", ParticipantSessionGuid);
+		Writer.WriteField("groupID", GroupId);
+	}
 };
 
-struct FMixerUpdateParticipantGroupParams : public FJsonSerializable
+struct FMixerUpdateParticipantGroupParams
 {
 public:
 	TArray<FMixerUpdateParticipantGroupParamsEntry> Participants;
 public:
-	BEGIN_JSON_SERIALIZER
-		JSON_SERIALIZE_ARRAY_SERIALIZABLE("participants", Participants, FMixerUpdateParticipantGroupParamsEntry);
-	END_JSON_SERIALIZER
+	template <class WriterType>
+	void WriteJsonFields(WriterType& Writer) const
+	{
+		Writer.WriteField("participants", Participants);
+	}
 };
 
-struct FMixerCaptureTransactionParams : public FJsonSerializable
+struct FMixerCaptureTransactionParams
 {
 public:
 	FString TransactionId;
 public:
-	BEGIN_JSON_SERIALIZER
-		JSON_SERIALIZE("transactionID", TransactionId);
-	END_JSON_SERIALIZER
+	template <class WriterType>
+	void WriteJsonFields(WriterType& Writer) const
+	{
+		Writer.WriteField("transactionID", TransactionId);
+	}
 };
 
-
 FMixerInteractivityModule_UE::FMixerInteractivityModule_UE()
-	: TMixerWebSocketOwnerBase<FMixerInteractivityModule_UE>(MixerStringConstants::MessageTypes::Method, MixerStringConstants::FieldNames::Method, MixerStringConstants::FieldNames::Params)
+	: TMixerWebSocketOwnerBase<FMixerInteractivityModule_UE>(MixerStringConstants::MessageTypes::Method, MixerStringConstants::FieldNames::Method, MixerStringConstants::FieldNames::Params, EMixerJsonDispatchMode::Streaming)
+	, GetScenesRetries(0)
+	, ReadyRetries(0)
 {
 }
 
@@ -108,6 +121,7 @@ void FMixerInteractivityModule_UE::StartInteractivity()
 		{
 			FMixerReadyMessageParams Params;
 			Params.bReady = true;
+			ReadyRetries = 0;
 			SendMethodMessageObjectParams(MixerStringConstants::MethodNames::Ready, nullptr, Params);
 			SetInteractivityState(EMixerInteractivityState::Interactivity_Starting);
 		}
@@ -128,6 +142,7 @@ void FMixerInteractivityModule_UE::StopInteractivity()
 		{
 			FMixerReadyMessageParams Params;
 			Params.bReady = false;
+			ReadyRetries = 0;
 			SendMethodMessageObjectParams(MixerStringConstants::MethodNames::Ready, nullptr, Params);
 			SetInteractivityState(EMixerInteractivityState::Interactivity_Stopping);
 		}
@@ -168,14 +183,14 @@ bool FMixerInteractivityModule_UE::MoveParticipantToGroup(FName GroupName, uint3
 		return false;
 	}
 
-	TSharedPtr<FMixerRemoteUser> ExistingUser = GetCachedUser(ParticipantId);
-	if (!ExistingUser.IsValid())
+	FMixerParticipantHandle ExistingUser = FindCachedUser(ParticipantId);
+	if (!ExistingUser.IsSet())
 	{
 		return false;
 	}
 
 	FMixerUpdateParticipantGroupParamsEntry ParamEntry;
-	ParamEntry.ParticipantSessionGuid = ExistingUser->SessionGuid.ToString(EGuidFormats::DigitsWithHyphens).ToLower();
+	ParamEntry.ParticipantSessionGuid = GetCachedUsers().GetSessionGuid(ExistingUser).ToString(EGuidFormats::DigitsWithHyphens).ToLower();
 	// Special case - 'default' is used all over the place as a name, but with 'D'
 	ParamEntry.GroupId = GroupName != NAME_DefaultMixerParticipantGroup ? GroupName.ToString() : TEXT("default");
 
@@ -201,6 +216,43 @@ void FMixerInteractivityModule_UE::CallRemoteMethod(const FString& MethodName, c
 	SendMethodMessageObjectParams(MethodName, nullptr, MethodParams);
 }
 
+void FMixerInteractivityModule_UE::CallRemoteMethodWithJsonParams(const FString& MethodName, const ANSICHAR* Utf8ParamsJson, int32 Length)
+{
+	SendMethodMessageJsonParams(MethodName, nullptr, Utf8ParamsJson, Length, GetOutgoingMessagePriority(MethodName));
+}
+
+void FMixerInteractivityModule_UE::SendControlUpdates(const ANSICHAR* Utf8ParamsJson, int32 Length, bool bUrgent)
+{
+	const FString& MethodName = MixerStringConstants::MethodNames::UpdateControls;
+	SendMethodMessageJsonParams(MethodName, nullptr, Utf8ParamsJson, Length, bUrgent ? EMixerMessagePriority::Urgent : GetOutgoingMessagePriority(MethodName));
+}
+
+bool FMixerInteractivityModule_UE::IsReadyForControlUpdates() const
+{
+	// Updates held back here are merged per property, which beats leaving them to pile up in the send queue
+	return !HasQueuedMessages(GetOutgoingMessagePriority(MixerStringConstants::MethodNames::UpdateControls));
+}
+
+bool FMixerInteractivityModule_UE::Tick(float DeltaTime)
+{
+	bool bResult = FMixerInteractivityModule_WithSessionState::Tick(DeltaTime);
+
+	// Input is handled after the base tick has started a new interval, as it is when it arrives straight
+	// from the socket, so that button counts survive until game code polls them.
+	const UMixerInteractivitySettings* Settings = GetDefault<UMixerInteractivitySettings>();
+	ProcessDecodedMessages(Settings->MessageHandlingBudgetMs / 1000.0);
+
+	// Base tick has just queued this frame's control updates
+	FlushSendQueue();
+	return bResult;
+}
+
+bool FMixerInteractivityModule_UE::GetOutgoingMessageStats(FMixerOutgoingMessageStats& OutStats)
+{
+	TMixerWebSocketOwnerBase<FMixerInteractivityModule_UE>::GetOutgoingMessageStats(OutStats);
+	return true;
+}
+
 bool FMixerInteractivityModule_UE::StartInteractiveConnection()
 {
 	if (GetInteractiveConnectionAuthState() != EMixerLoginState::Not_Logged_In)
@@ -209,6 +261,17 @@ bool FMixerInteractivityModule_UE::StartInteractiveConnection()
 	}
 
 	Endpoints.Empty();
+
+	const UMixerInteractivitySettings* Settings = GetDefault<UMixerInteractivitySettings>();
+	if (!Settings->InteractiveEndpointOverride.IsEmpty())
+	{
+		// No host discovery - go straight to the configured endpoint
+		Endpoints.Add(Settings->InteractiveEndpointOverride);
+		SetInteractiveConnectionAuthState(EMixerLoginState::Logging_In);
+		OpenWebSocket();
+		return true;
+	}
+
 	TSharedRef<IHttpRequest> HostsRequest = FHttpModule::Get().CreateRequest();
 	HostsRequest->SetVerb(TEXT("GET"));
 	HostsRequest->SetURL(TEXT("https://mixer.com/api/v1/interactive/hosts"));
@@ -294,6 +357,11 @@ void FMixerInteractivityModule_UE::OpenWebSocket()
 	UE_LOG(LogMixerInteractivity, Verbose, TEXT("Opening web socket to %s for interactivity"), *EndpointToUse);
 
 	Endpoints.RemoveAtSwap(0);
+	GetScenesRetries = 0;
+	SetDecodeOnWorkerThread(Settings->bDecodeMessagesOffGameThread);
+	SetSendBudget(Settings->OutgoingBytesPerSecondLimit);
+	SetReplyTimeout(Settings->ReplyTimeoutSeconds);
+	SetTrafficCaptureName(TEXT("interactive"));
 	InitConnection(EndpointToUse, UpgradeHeaders);
 }
 
@@ -331,6 +399,50 @@ void FMixerInteractivityModule_UE::HandleSocketClosed( bool bWasClean)
 	OpenWebSocket();
 }
 
+void FMixerInteractivityModule_UE::HandleReplyTimeout(const FString& MethodName, int32 TimedOutMessageId, FServerMessageHandler Handler)
+{
+	TMixerWebSocketOwnerBase<FMixerInteractivityModule_UE>::HandleReplyTimeout(MethodName, TimedOutMessageId, Handler);
+
+	const int32 MaxRetries = 2;
+	if (MethodName == MixerStringConstants::MethodNames::GetScenes)
+	{
+		// Login can't complete without the scenes
+		if (GetScenesRetries < MaxRetries)
+		{
+			++GetScenesRetries;
+			SendMethodMessageNoParams(MixerStringConstants::MethodNames::GetScenes, Handler);
+		}
+		else
+		{
+			UE_LOG(LogMixerInteractivity, Error, TEXT("Giving up on %s after %d attempts; trying the next endpoint."), *MethodName, GetScenesRetries + 1);
+			CleanupConnection();
+			OpenWebSocket();
+		}
+	}
+	else if (MethodName == MixerStringConstants::MethodNames::Ready)
+	{
+		// Only worth repeating while still waiting on the service to confirm the change
+		const EMixerInteractivityState State = GetInteractivityState();
+		if (State != EMixerInteractivityState::Interactivity_Starting && State != EMixerInteractivityState::Interactivity_Stopping)
+		{
+			return;
+		}
+
+		if (ReadyRetries < MaxRetries)
+		{
+			++ReadyRetries;
+			FMixerReadyMessageParams Params;
+			Params.bReady = State == EMixerInteractivityState::Interactivity_Starting;
+			SendMethodMessageObjectParams(MixerStringConstants::MethodNames::Ready, nullptr, Params);
+		}
+		else
+		{
+			UE_LOG(LogMixerInteractivity, Error, TEXT("Giving up on %s after %d attempts."), *MethodName, ReadyRetries + 1);
+			SetInteractivityState(EMixerInteractivityState::Not_Interactive);
+		}
+	}
+}
+
 void FMixerInteractivityModule_UE::RegisterAllServerMessageHandlers()
 {
 	RegisterServerMessageHandler(TEXT("hello"), &FMixerInteractivityModule_UE::HandleHello);
@@ -351,92 +463,134 @@ bool FMixerInteractivityModule_UE::OnUnhandledServerMessage(const FString& Messa
 	return true;
 }
 
-bool FMixerInteractivityModule_UE::HandleHello(FJsonObject* JsonObj)
+EMixerMessagePriority FMixerInteractivityModule_UE::GetOutgoingMessagePriority(const FString& MethodName) const
+{
+	if (MethodName == MixerStringConstants::MethodNames::Capture || MethodName == MixerStringConstants::MethodNames::Ready)
+	{
+		return EMixerMessagePriority::Urgent;
+	}
+	else if (MethodName == MixerStringConstants::MethodNames::UpdateControls)
+	{
+		// Changes to urgent properties (disabled, cooldown by default) are flagged as such by the control update buffer
+		return EMixerMessagePriority::Cosmetic;
+	}
+
+	return EMixerMessagePriority::Normal;
+}
+
+
+bool FMixerInteractivityModule_UE::HandleHello(FMixerJsonMessageView& Params)
 {
 	SendMethodMessageNoParams(MixerStringConstants::MethodNames::GetScenes, &FMixerInteractivityModule_UE::HandleGetScenesReply);
 	return true;
 }
 
-bool FMixerInteractivityModule_UE::HandleGiveInput(FJsonObject* JsonObj)
+bool FMixerInteractivityModule_UE::HandleGiveInput(FMixerJsonMessageView& Params)
 {
-	GET_JSON_STRING_RETURN_FAILURE(ParticipantId, ParticipantGuidString);
-
-	FGuid ParticipantGuid;
-	if (!FGuid::Parse(ParticipantGuidString, ParticipantGuid))
+	FString ParticipantIdScratch;
+	FMixerJsonSpan ParticipantId;
+	if (!Params.TryGetStringSpan(MixerStringConstants::FieldNames::ParticipantId, ParticipantId, ParticipantIdScratch))
 	{
-		UE_LOG(LogMixerInteractivity, Error, TEXT("%s field %s for input event was not in the expected format (guid)"), *MixerStringConstants::FieldNames::ParticipantId, *ParticipantGuidString);
+		UE_LOG(LogMixerInteractivity, Error, TEXT("Missing required %s field in json payload"), *MixerStringConstants::FieldNames::ParticipantId);
 		return false;
 	}
 
-	GET_JSON_OBJECT_RETURN_FAILURE(Input, InputObj);
+	// Known participants are found from the id text recorded when they joined, read in place from the message
+	FMixerParticipantHandle Participant = FindCachedUser(ParticipantId.Start, ParticipantId.Length);
+	if (!Participant.IsSet())
+	{
+		const FString ParticipantGuidString = ParticipantId.ToString();
+		FGuid ParticipantGuid;
+		if (!FGuid::Parse(ParticipantGuidString, ParticipantGuid))
+		{
+			UE_LOG(LogMixerInteractivity, Error, TEXT("%s field %s for input event was not in the expected format (guid)"), *MixerStringConstants::FieldNames::ParticipantId, *ParticipantGuidString);
+			return false;
+		}
+		Participant = FindCachedUser(ParticipantGuid);
+	}
 
-	TSharedPtr<FMixerRemoteUser> RemoteUser = GetCachedUser(ParticipantGuid);
-	return HandleGiveInput(RemoteUser, JsonObj, InputObj->ToSharedRef());
+	FMixerJsonMessageView Input;
+	if (!Params.TryGetObjectView(MixerStringConstants::FieldNames::Input, Input))
+	{
+		UE_LOG(LogMixerInteractivity, Error, TEXT("Missing required %s field in json payload"), *MixerStringConstants::FieldNames::Input);
+		return false;
+	}
+
+	return HandleGiveInput(Participant, Params, Input);
 }
 
-bool FMixerInteractivityModule_UE::HandleParticipantJoin(FJsonObject* JsonObj)
+bool FMixerInteractivityModule_UE::HandleParticipantJoin(FMixerJsonMessageView& Params)
 {
-	return HandleParticipantEvent(JsonObj, EMixerInteractivityParticipantState::Joined);
+	return HandleParticipantEvent(Params, EMixerInteractivityParticipantState::Joined);
 }
 
-bool FMixerInteractivityModule_UE::HandleParticipantLeave(FJsonObject* JsonObj)
+bool FMixerInteractivityModule_UE::HandleParticipantLeave(FMixerJsonMessageView& Params)
 {
-	return HandleParticipantEvent(JsonObj, EMixerInteractivityParticipantState::Left);
+	return HandleParticipantEvent(Params, EMixerInteractivityParticipantState::Left);
 }
 
-bool FMixerInteractivityModule_UE::HandleParticipantUpdate(FJsonObject* JsonObj)
+bool FMixerInteractivityModule_UE::HandleParticipantUpdate(FMixerJsonMessageView& Params)
 {
-	return HandleParticipantEvent(JsonObj, EMixerInteractivityParticipantState::Input_Disabled);
+	return HandleParticipantEvent(Params, EMixerInteractivityParticipantState::Input_Disabled);
 }
 
-bool FMixerInteractivityModule_UE::HandleReadyStateChange(FJsonObject* JsonObj)
+bool FMixerInteractivityModule_UE::HandleReadyStateChange(FMixerJsonMessageView& Params)
 {
+	// Alias so macros work - isReady is read straight from the raw message
+	FMixerJsonMessageView* JsonObj = &Params;
 	GET_JSON_BOOL_RETURN_FAILURE(IsReady, bIsReady);
 	SetInteractivityState(bIsReady ? EMixerInteractivityState::Interactive : EMixerInteractivityState::Not_Interactive);
 	return true;
 }
 
-bool FMixerInteractivityModule_UE::HandleGroupCreate(FJsonObject* JsonObj)
+bool FMixerInteractivityModule_UE::HandleGroupCreate(FMixerJsonMessageView& Params)
 {
-	GET_JSON_ARRAY_RETURN_FAILURE(Groups, Groups);
-
-	for (const TSharedPtr<FJsonValue>& Group : *Groups)
+	const bool bFoundGroups = Params.VisitObjectArrayField(MixerStringConstants::FieldNames::Groups, [this](FMixerJsonMessageView& Group)
 	{
 		FString GroupId;
 		FString SceneId;
-		TSharedPtr<FJsonObject> GroupObj = Group->AsObject();
-		if (GroupObj.IsValid()
-			&& GroupObj->TryGetStringField(MixerStringConstants::FieldNames::GroupId, GroupId)
-			&& GroupObj->TryGetStringField(MixerStringConstants::FieldNames::SceneId, SceneId))
+		if (Group.TryGetStringField(MixerStringConstants::FieldNames::GroupId, GroupId)
+			&& Group.TryGetStringField(MixerStringConstants::FieldNames::SceneId, SceneId))
 		{
 			ScenesByGroup.Add(*GroupId, *SceneId);
 		}
+	});
+
+	if (!bFoundGroups)
+	{
+		UE_LOG(LogMixerInteractivity, Error, TEXT("Missing required %s field in json payload"), *MixerStringConstants::FieldNames::Groups);
+		return false;
 	}
 
 	return true;
 }
 
-bool FMixerInteractivityModule_UE::HandleGroupUpdate(FJsonObject* JsonObj)
+bool FMixerInteractivityModule_UE::HandleGroupUpdate(FMixerJsonMessageView& Params)
 {
-	GET_JSON_ARRAY_RETURN_FAILURE(Groups, Groups);
-	for (const TSharedPtr<FJsonValue>& Group : *Groups)
+	const bool bFoundGroups = Params.VisitObjectArrayField(MixerStringConstants::FieldNames::Groups, [this](FMixerJsonMessageView& Group)
 	{
 		FString GroupId;
 		FString SceneId;
-		TSharedPtr<FJsonObject> GroupObj = Group->AsObject();
-		if (GroupObj.IsValid()
-			&& GroupObj->TryGetStringField(MixerStringConstants::FieldNames::GroupId, GroupId)
-			&& GroupObj->TryGetStringField(MixerStringConstants::FieldNames::SceneId, SceneId))
+		if (Group.TryGetStringField(MixerStringConstants::FieldNames::GroupId, GroupId)
+			&& Group.TryGetStringField(MixerStringConstants::FieldNames::SceneId, SceneId))
 		{
 			ScenesByGroup.FindChecked(*GroupId) = *SceneId;
 		}
+	});
+
+	if (!bFoundGroups)
+	{
+		UE_LOG(LogMixerInteractivity, Error, TEXT("Missing required %s field in json payload"), *MixerStringConstants::FieldNames::Groups);
+		return false;
 	}
 
 	return true;
 }
 
-bool FMixerInteractivityModule_UE::HandleGroupDelete(FJsonObject* JsonObj)
+bool FMixerInteractivityModule_UE::HandleGroupDelete(FMixerJsonMessageView& Params)
 {
+	// Alias so macros work
+	FMixerJsonMessageView* JsonObj = &Params;
 	GET_JSON_STRING_RETURN_FAILURE(GroupId, GroupIdRaw);
 	GET_JSON_STRING_RETURN_FAILURE(ReassignGroupId, ReassignGroupIdRaw);
 
@@ -456,39 +610,54 @@ bool FMixerInteractivityModule_UE::HandleGetScenesReply(FJsonObject* JsonObj)
 	return true;
 }
 
-bool FMixerInteractivityModule_UE::HandleGiveInput(TSharedPtr<FMixerRemoteUser> Participant, FJsonObject* FullParamsJson, const TSharedRef<FJsonObject> InputObjJson)
+bool FMixerInteractivityModule_UE::HandleGiveInput(FMixerParticipantHandle ParticipantHandle, const FMixerJsonMessageView& FullParams, FMixerJsonMessageView& Input)
 {
 	// Alias so macros work
-	const FJsonObject* JsonObj = &InputObjJson.Get();
+	const FMixerJsonMessageView* JsonObj = &Input;
+
+	FString ControlIdScratch;
+	FMixerJsonSpan ControlId;
+	if (!Input.TryGetStringSpan(MixerStringConstants::FieldNames::ControlId, ControlId, ControlIdScratch))
+	{
+		UE_LOG(LogMixerInteractivity, Error, TEXT("Missing required %s field in json payload"), *MixerStringConstants::FieldNames::ControlId);
+		return false;
+	}
 
-	GET_JSON_STRING_RETURN_FAILURE(ControlId, ControlIdRaw);
-	GET_JSON_STRING_RETURN_FAILURE(Event, EventType);
+	FString EventTypeScratch;
+	FMixerJsonSpan EventType;
+	if (!Input.TryGetStringSpan(MixerStringConstants::FieldNames::Event, EventType, EventTypeScratch))
+	{
+		UE_LOG(LogMixerInteractivity, Error, TEXT("Missing required %s field in json payload"), *MixerStringConstants::FieldNames::Event);
+		return false;
+	}
 
 	bool bHandled = false;
-	FName ControlId = *ControlIdRaw;
-	if (EventType == MixerStringConstants::EventTypes::MouseDown)
+	const FMixerControlDirectoryEntry Control = FindControl(ControlId.Start, ControlId.Length);
+	if (Control.Kind == EMixerControlKind::Button && EventType.Equals(MixerStringConstants::EventTypes::MouseDown))
 	{
-		FMixerButtonPropertiesCached* ButtonProps = GetButton(ControlId);
+		const FMixerButtonHandle Button(Control.Index);
+		FMixerButtonPropertiesCached* ButtonProps = ProcessButtonInput(Button, ParticipantHandle, true);
 		if (ButtonProps != nullptr)
 		{
 			FMixerButtonEventDetails EventDetails;
 			EventDetails.Pressed = true;
 			if (ButtonProps->Desc.SparkCost > 0)
 			{
-				FullParamsJson->TryGetStringField(MixerStringConstants::FieldNames::TransactionId, EventDetails.TransactionId);
+				FullParams.TryGetStringField(MixerStringConstants::FieldNames::TransactionId, EventDetails.TransactionId);
 				EventDetails.SparkCost = ButtonProps->Desc.SparkCost;
 			}
 			else
 			{
 				EventDetails.SparkCost = 0;
 			}
-			OnButtonEvent().Broadcast(ControlId, Participant, EventDetails);
+			DispatchButtonEvent(Button, ParticipantHandle, EventDetails);
 			bHandled = true;
 		}
 	}
-	else if (EventType == MixerStringConstants::EventTypes::MouseUp)
+	else if (Control.Kind == EMixerControlKind::Button && EventType.Equals(MixerStringConstants::EventTypes::MouseUp))
 	{
-		FMixerButtonPropertiesCached* ButtonProps = GetButton(ControlId);
+		const FMixerButtonHandle Button(Control.Index);
+		FMixerButtonPropertiesCached* ButtonProps = ProcessButtonInput(Button, ParticipantHandle, false);
 		if (ButtonProps != nullptr)
 		{
 			FMixerButtonEventDetails EventDetails;
@@ -496,25 +665,25 @@ bool FMixerInteractivityModule_UE::HandleGiveInput(TSharedPtr<FMixerRemoteUser>
 			// Button mouseup doesn't support charging
 			EventDetails.SparkCost = 0;
 
-			OnButtonEvent().Broadcast(ControlId, Participant, EventDetails);
+			DispatchButtonEvent(Button, ParticipantHandle, EventDetails);
 			bHandled = true;
 		}
 	}
-	else if (EventType == MixerStringConstants::EventTypes::Move)
+	else if (Control.Kind == EMixerControlKind::Stick && EventType.Equals(MixerStringConstants::EventTypes::Move))
 	{
-		FMixerStickPropertiesCached* Stick = GetStick(ControlId);
-		if (Stick != nullptr)
-		{
-			GET_JSON_DOUBLE_RETURN_FAILURE(X, X);
-			GET_JSON_DOUBLE_RETURN_FAILURE(Y, Y);
+		GET_JSON_DOUBLE_RETURN_FAILURE(X, X);
+		GET_JSON_DOUBLE_RETURN_FAILURE(Y, Y);
 
-			OnStickEvent().Broadcast(ControlId, Participant, FVector2D(static_cast<float>(X), static_cast<float>(Y)));
-			bHandled = true;
-		}
+		const FMixerStickHandle Stick(Control.Index);
+		FVector2D Position = FVector2D(static_cast<float>(X), static_cast<float>(Y));
+		ProcessStickInput(Stick, ParticipantHandle, Position);
+		DispatchStickEvent(Stick, ParticipantHandle, Position);
+		bHandled = true;
 	}
-	else if (EventType == MixerStringConstants::EventTypes::Submit)
+	else if (Control.Kind == EMixerControlKind::Textbox && EventType.Equals(MixerStringConstants::EventTypes::Submit))
 	{
-		FMixerTextboxPropertiesCached* Textbox = GetTextbox(ControlId);
+		const FMixerTextboxHandle TextboxHandle(Control.Index);
+		FMixerTextboxPropertiesCached* Textbox = GetTextbox(TextboxHandle);
 		if (Textbox != nullptr)
 		{
 			GET_JSON_STRING_RETURN_FAILURE(Value, Value);
@@ -523,7 +692,7 @@ bool FMixerInteractivityModule_UE::HandleGiveInput(TSharedPtr<FMixerRemoteUser>
 			EventDetails.SubmittedText = FText::FromString(Value);
 			if (Textbox->Desc.SparkCost > 0)
 			{
-				if (FullParamsJson->TryGetStringField(MixerStringConstants::FieldNames::TransactionId, EventDetails.TransactionId))
+				if (FullParams.TryGetStringField(MixerStringConstants::FieldNames::TransactionId, EventDetails.TransactionId))
 				{
 					EventDetails.SparkCost = Textbox->Desc.SparkCost;
 				}
@@ -533,33 +702,46 @@ bool FMixerInteractivityModule_UE::HandleGiveInput(TSharedPtr<FMixerRemoteUser>
 				EventDetails.SparkCost = 0;
 			}
 
-			OnTextboxSubmitEvent().Broadcast(ControlId, Participant, EventDetails);
+			DispatchTextboxSubmitEvent(TextboxHandle, ParticipantHandle, EventDetails);
 			bHandled = true;
 		}
 	}
 
 	if (!bHandled)
 	{
-		OnCustomControlInput().Broadcast(ControlId, *EventType, Participant, InputObjJson);
+		// Custom controls get the whole input object, so only they pay for building it
+		TSharedPtr<FJsonObject> InputObj = Input.GetSharedObject();
+		if (InputObj.IsValid())
+		{
+			OnCustomControlInput().Broadcast(*ControlId.ToString(), *EventType.ToString(), GetCachedUserView(ParticipantHandle), InputObj.ToSharedRef());
+		}
 	}
 
 	return true;
 }
 
-bool FMixerInteractivityModule_UE::HandleParticipantEvent(FJsonObject* JsonObj, EMixerInteractivityParticipantState EventType)
+bool FMixerInteractivityModule_UE::HandleParticipantEvent(const FMixerJsonMessageView& Params, EMixerInteractivityParticipantState EventType)
 {
-	GET_JSON_ARRAY_RETURN_FAILURE(Participants, ChangingParticipants);
-
 	bool bHandled = true;
-	for (const TSharedPtr<FJsonValue>& Participant : *ChangingParticipants)
+	const bool bFoundParticipants = Params.VisitObjectArrayField(MixerStringConstants::FieldNames::Participants, [this, EventType, &bHandled](FMixerJsonMessageView& Participant)
 	{
-		bHandled &= HandleSingleParticipantChange(Participant->AsObject().Get(), EventType);
+		bHandled &= HandleSingleParticipantChange(Participant, EventType);
+	});
+
+	if (!bFoundParticipants)
+	{
+		UE_LOG(LogMixerInteractivity, Error, TEXT("Missing required %s field in json payload"), *MixerStringConstants::FieldNames::Participants);
+		return false;
 	}
+
 	return bHandled;
 }
 
-bool FMixerInteractivityModule_UE::HandleSingleParticipantChange(const FJsonObject* JsonObj, EMixerInteractivityParticipantState EventType)
+bool FMixerInteractivityModule_UE::HandleSingleParticipantChange(const FMixerJsonMessageView& Participant, EMixerInteractivityParticipantState EventType)
 {
+	// Alias so macros work
+	const FMixerJsonMessageView* JsonObj = &Participant;
+
 	GET_JSON_STRING_RETURN_FAILURE(UserNameNoUnderscore, Username);
 	GET_JSON_INT_RETURN_FAILURE(UserIdNoUnderscore, UserId);
 	GET_JSON_INT_RETURN_FAILURE(Level, UserLevel);
@@ -575,40 +757,52 @@ bool FMixerInteractivityModule_UE::HandleSingleParticipantChange(const FJsonObje
 		return false;
 	}
 
-	TSharedPtr<FMixerRemoteUser> RemoteUser = GetCachedUser(UserId);
+	FMixerParticipantHandle CachedUser = FindCachedUser(static_cast<uint32>(UserId));
+	FMixerRemoteUser RemoteUser;
 	bool bOldInputEnabled = false;
-	bool bExistingUser = false;
-	if (RemoteUser.IsValid())
+	const bool bExistingUser = CachedUser.IsSet();
+	if (bExistingUser)
 	{
-		bExistingUser = true;
-		bOldInputEnabled = RemoteUser->InputEnabled;
+		GetCachedUsers().GetUser(CachedUser, RemoteUser);
+		bOldInputEnabled = RemoteUser.InputEnabled;
 	}
 	else
 	{
-		RemoteUser = MakeShared<FMixerRemoteUser>();
-		RemoteUser->Id = UserId;
-		RemoteUser->SessionGuid = SessionGuid;
-		RemoteUser->ConnectedAt = FDateTime::FromUnixTimestamp(static_cast<int64>(ConnectedAtDouble / 1000.0));
-
-		if (EventType != EMixerInteractivityParticipantState::Left)
-		{
-			AddUser(RemoteUser);
-		}
+		RemoteUser.Id = UserId;
+		RemoteUser.SessionGuid = SessionGuid;
+		RemoteUser.ConnectedAt = FDateTime::FromUnixTimestamp(static_cast<int64>(ConnectedAtDouble / 1000.0));
 	}
 
-	RemoteUser->Name = Username;
-	RemoteUser->Level = UserLevel;
-	RemoteUser->InputAt = FDateTime::FromUnixTimestamp(static_cast<int64>(LastInputAtDouble / 1000.0));
-	RemoteUser->Group = *GroupId;
+	RemoteUser.Name = Username;
+	RemoteUser.Level = UserLevel;
+	RemoteUser.InputAt = FDateTime::FromUnixTimestamp(static_cast<int64>(LastInputAtDouble / 1000.0));
+	RemoteUser.Group = *GroupId;
+
+	TSharedPtr<const FMixerRemoteUser> RemoteUserView;
+	if (bExistingUser)
+	{
+		UpdateUser(CachedUser, RemoteUser);
+		RemoteUserView = GetCachedUserView(CachedUser);
+	}
+	else if (EventType != EMixerInteractivityParticipantState::Left)
+	{
+		FTCHARToUTF8 Utf8SessionId(*SessionGuidString, SessionGuidString.Len());
+		RemoteUserView = GetCachedUserView(AddUser(RemoteUser, reinterpret_cast<const ANSICHAR*>(Utf8SessionId.Get()), Utf8SessionId.Length()));
+	}
+	else
+	{
+		// Never seen joining, so there's nothing cached to share
+		RemoteUserView = MakeShared<FMixerRemoteUser>(RemoteUser);
+	}
 
-	if (EventType != EMixerInteractivityParticipantState::Input_Disabled || bOldInputEnabled != RemoteUser->InputEnabled)
+	if (EventType != EMixerInteractivityParticipantState::Input_Disabled || bOldInputEnabled != RemoteUser.InputEnabled)
 	{
-		OnParticipantStateChanged().Broadcast(RemoteUser, EventType);
+		OnParticipantStateChanged().Broadcast(RemoteUserView, EventType);
 	}
 
 	if (bExistingUser && EventType == EMixerInteractivityParticipantState::Left)
 	{
-		RemoveUser(RemoteUser);
+		RemoveUser(CachedUser);
 	}
 
 	return true;
@@ -679,13 +873,13 @@ bool FMixerInteractivityModule_UE::ParsePropertiesFromSingleControl(FName SceneI
 		Button.State.Progress = 0.0f;
 		Button.SceneId = SceneId;
 
-		AddButton(*ControlId, Button);
+		AddButton(ControlId, Button);
 	}
 	else if (ControlKind == FMixerInteractiveControl::JoystickKind)
 	{
 		FMixerStickPropertiesCached Stick;
 		Stick.State.Enabled = true;
-		AddStick(*ControlId, Stick);
+		AddStick(ControlId, Stick);
 	}
 	else if (ControlKind == FMixerInteractiveControl::LabelKind)
 	{
@@ -716,7 +910,7 @@ bool FMixerInteractivityModule_UE::ParsePropertiesFromSingleControl(FName SceneI
 		JsonObj->TryGetBoolField(MixerStringConstants::FieldNames::Italic, Label.Desc.Italic);
 
 		Label.SceneId = SceneId;
-		AddLabel(*ControlId, Label);
+		AddLabel(ControlId, Label);
 	}
 	else if (ControlKind == FMixerInteractiveControl::TextboxKind)
 	{
@@ -733,7 +927,7 @@ bool FMixerInteractivityModule_UE::ParsePropertiesFromSingleControl(FName SceneI
 		{
 			Textbox.Desc.SubmitText = FText::FromString(FieldValueScratch);
 		}
-		AddTextbox(*ControlId, Textbox);
+		AddTextbox(ControlId, Textbox);
 	}
 	else
 	{
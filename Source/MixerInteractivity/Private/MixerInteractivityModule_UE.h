@@ -31,18 +31,27 @@ public:
 	virtual bool MoveParticipantToGroup(FName GroupName, uint32 ParticipantId);
 	virtual void CaptureSparkTransaction(const FString& TransactionId);
 	virtual void CallRemoteMethod(const FString& MethodName, const TSharedRef<FJsonObject> MethodParams);
+	virtual bool GetOutgoingMessageStats(FMixerOutgoingMessageStats& OutStats);
+
+public:
+	virtual bool Tick(float DeltaTime) override;
 
 protected:
 	virtual bool StartInteractiveConnection();
 	virtual void StopInteractiveConnection();
+	virtual void CallRemoteMethodWithJsonParams(const FString& MethodName, const ANSICHAR* Utf8ParamsJson, int32 Length) override;
+	virtual void SendControlUpdates(const ANSICHAR* Utf8ParamsJson, int32 Length, bool bUrgent) override;
+	virtual bool IsReadyForControlUpdates() const override;
 
 protected:
 	virtual void RegisterAllServerMessageHandlers();
 	virtual bool OnUnhandledServerMessage(const FString& MessageType, const TSharedPtr<FJsonObject> Params);
+	virtual EMixerMessagePriority GetOutgoingMessagePriority(const FString& MethodName) const;
 
 	virtual void HandleSocketConnected();
 	virtual void HandleSocketConnectionError();
 	virtual void HandleSocketClosed(bool bWasClean);
+	virtual void HandleReplyTimeout(const FString& MethodName, int32 TimedOutMessageId, FServerMessageHandler Handler);
 
 private:
 	void OnHostsRequestComplete(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded);
@@ -51,21 +60,22 @@ private:
 
 	bool CreateOrUpdateGroup(const FString& MethodName, FName Scene, FName GroupName);
 
-	bool HandleHello(FJsonObject* JsonObj);
-	bool HandleGiveInput(FJsonObject* JsonObj);
-	bool HandleParticipantJoin(FJsonObject* JsonObj);
-	bool HandleParticipantLeave(FJsonObject* JsonObj);
-	bool HandleParticipantUpdate(FJsonObject* JsonObj);
-	bool HandleReadyStateChange(FJsonObject* JsonObj);
-	bool HandleGroupCreate(FJsonObject* JsonObj);
-	bool HandleGroupUpdate(FJsonObject* JsonObj);
-	bool HandleGroupDelete(FJsonObject* JsonObj);
+	/** Input, participant and group messages are read straight from the raw text rather than as FJsonObjects. */
+	bool HandleHello(FMixerJsonMessageView& Params);
+	bool HandleGiveInput(FMixerJsonMessageView& Params);
+	bool HandleParticipantJoin(FMixerJsonMessageView& Params);
+	bool HandleParticipantLeave(FMixerJsonMessageView& Params);
+	bool HandleParticipantUpdate(FMixerJsonMessageView& Params);
+	bool HandleReadyStateChange(FMixerJsonMessageView& Params);
+	bool HandleGroupCreate(FMixerJsonMessageView& Params);
+	bool HandleGroupUpdate(FMixerJsonMessageView& Params);
+	bool HandleGroupDelete(FMixerJsonMessageView& Params);
 
 	bool HandleGetScenesReply(FJsonObject* JsonObj);
 
-	bool HandleGiveInput(TSharedPtr<FMixerRemoteUser> Participant, FJsonObject* FullParamsJson, const TSharedRef<FJsonObject> InputObjJson);
-	bool HandleParticipantEvent(FJsonObject* JsonObj, EMixerInteractivityParticipantState EventType);
-	bool HandleSingleParticipantChange(const FJsonObject* JsonObj, EMixerInteractivityParticipantState EventType);
+	bool HandleGiveInput(FMixerParticipantHandle ParticipantHandle, const FMixerJsonMessageView& FullParams, FMixerJsonMessageView& Input);
+	bool HandleParticipantEvent(const FMixerJsonMessageView& Params, EMixerInteractivityParticipantState EventType);
+	bool HandleSingleParticipantChange(const FMixerJsonMessageView& Participant, EMixerInteractivityParticipantState EventType);
 
 	bool ParsePropertiesFromGetScenesResult(FJsonObject *JsonObj);
 	bool ParsePropertiesFromSingleScene(FJsonObject* JsonObj);
@@ -74,6 +84,8 @@ private:
 private:
 	TArray<FString> Endpoints;
 	TMap<FName, FName> ScenesByGroup;
+	int32 GetScenesRetries;
+	int32 ReadyRetries;
 };
 
 #endif
@@ -11,6 +11,166 @@
 #include "MixerInteractivityModule_WithSessionState.h"
 #include "MixerJsonHelpers.h"
 #include "MixerInteractivityLog.h"
+#include "MixerInteractivitySettings.h"
+
+namespace
+{
+	/**
+	* Partially reorder Values[First, Last) so that Values[Nth] is the element that would be there if
+	* the range were sorted, everything before it is no greater and everything after it no smaller.
+	* Expected linear time (quickselect with a median of three pivot).
+	*/
+	void SelectNth(float* Values, int32 First, int32 Nth, int32 Last)
+	{
+		while (Last - First > 1)
+		{
+			const int32 Mid = First + (Last - First) / 2;
+			if (Values[Mid] < Values[First]) { Swap(Values[Mid], Values[First]); }
+			if (Values[Last - 1] < Values[First]) { Swap(Values[Last - 1], Values[First]); }
+			if (Values[Last - 1] < Values[Mid]) { Swap(Values[Last - 1], Values[Mid]); }
+			const float Pivot = Values[Mid];
+
+			int32 Lo = First;
+			int32 Hi = Last - 1;
+			while (Lo <= Hi)
+			{
+				while (Values[Lo] < Pivot) { ++Lo; }
+				while (Pivot < Values[Hi]) { --Hi; }
+				if (Lo <= Hi)
+				{
+					Swap(Values[Lo], Values[Hi]);
+					++Lo;
+					--Hi;
+				}
+			}
+
+			// [First, Hi] <= Pivot <= [Lo, Last), and anything in between equals Pivot
+			if (Nth <= Hi)
+			{
+				Last = Hi + 1;
+			}
+			else if (Nth >= Lo)
+			{
+				First = Lo;
+			}
+			else
+			{
+				return;
+			}
+		}
+	}
+
+	/**
+	* Median and trimmed mean of Values, which are reordered in the process.  Selection rather than
+	* sorting keeps this linear in the number of contributors.
+	*/
+	void ComputeOrderStatistics(TArray<float>& Values, double Sum, int32 TrimCount, double& OutMedian, double& OutTrimmedMean)
+	{
+		float* Data = Values.GetData();
+		const int32 Count = Values.Num();
+
+		// Move the TrimCount smallest to the front and the TrimCount largest to the back
+		double TrimmedSum = Sum;
+		if (TrimCount > 0)
+		{
+			SelectNth(Data, 0, TrimCount - 1, Count);
+			SelectNth(Data, TrimCount, Count - TrimCount, Count);
+			for (int32 i = 0; i < TrimCount; ++i)
+			{
+				TrimmedSum -= Data[i];
+				TrimmedSum -= Data[Count - 1 - i];
+			}
+		}
+		OutTrimmedMean = TrimmedSum / (Count - 2 * TrimCount);
+
+		// TrimCount is under half the count, so the median lies within the untrimmed middle
+		const int32 Mid = Count / 2;
+		SelectNth(Data, TrimCount, Mid, Count - TrimCount);
+		if (Count % 2 != 0)
+		{
+			OutMedian = Data[Mid];
+		}
+		else
+		{
+			float Below = Data[TrimCount];
+			for (int32 i = TrimCount + 1; i < Mid; ++i)
+			{
+				Below = FMath::Max(Below, Data[i]);
+			}
+			OutMedian = 0.5 * (static_cast<double>(Below) + Data[Mid]);
+		}
+	}
+
+	/**
+	* Compute every aggregate in OutState except Enabled over the given slots of a stick.
+	* Always recomputed from the raw positions so error can't accumulate between updates.
+	*/
+	void ComputeStickAggregates(const FMixerStickPropertiesCached& Stick, const FMixerParticipantSlotSet& Slots, const FMixerParticipantTable& Participants, FMixerStickAggregateScratch& Scratch, FMixerStickState& OutState)
+	{
+		const int32 Count = Slots.Num();
+		OutState.ParticipantCount = Count;
+		if (Count == 0)
+		{
+			OutState.Axes = FVector2D(0, 0);
+			OutState.AxesVariance = FVector2D(0, 0);
+			OutState.LevelWeightedAxes = FVector2D(0, 0);
+			OutState.MedianAxes = FVector2D(0, 0);
+			OutState.TrimmedMeanAxes = FVector2D(0, 0);
+			return;
+		}
+
+		// Gather into contiguous arrays so the reductions below are straight-line loops
+		TArray<float>& X = Scratch.X;
+		TArray<float>& Y = Scratch.Y;
+		TArray<float>& Weights = Scratch.Weights;
+		X.Reset(Count);
+		Y.Reset(Count);
+		Weights.Reset(Count);
+		Slots.ForEachSlot([&](int32 Slot)
+		{
+			X.Add(Stick.ValuesX[Slot]);
+			Y.Add(Stick.ValuesY[Slot]);
+			Weights.Add(static_cast<float>(FMath::Max(Participants.GetLevel(Participants.GetHandleAtSlot(Slot)), 1)));
+		});
+
+		double SumX = 0, SumY = 0, WeightedSumX = 0, WeightedSumY = 0, SumWeights = 0;
+		for (int32 i = 0; i < Count; ++i)
+		{
+			SumX += X[i];
+			SumY += Y[i];
+			WeightedSumX += Weights[i] * X[i];
+			WeightedSumY += Weights[i] * Y[i];
+			SumWeights += Weights[i];
+		}
+		const double MeanX = SumX / Count;
+		const double MeanY = SumY / Count;
+
+		double SumSquaredDeviationX = 0, SumSquaredDeviationY = 0;
+		for (int32 i = 0; i < Count; ++i)
+		{
+			SumSquaredDeviationX += (X[i] - MeanX) * (X[i] - MeanX);
+			SumSquaredDeviationY += (Y[i] - MeanY) * (Y[i] - MeanY);
+		}
+
+		OutState.Axes = FVector2D(static_cast<float>(MeanX), static_cast<float>(MeanY));
+		OutState.AxesVariance = FVector2D(static_cast<float>(SumSquaredDeviationX / Count), static_cast<float>(SumSquaredDeviationY / Count));
+		OutState.LevelWeightedAxes = FVector2D(static_cast<float>(WeightedSumX / SumWeights), static_cast<float>(WeightedSumY / SumWeights));
+
+		const float TrimFraction = FMath::Clamp(GetDefault<UMixerInteractivitySettings>()->StickTrimFraction, 0.0f, 0.49f);
+		const int32 TrimCount = FMath::FloorToInt(Count * TrimFraction);
+		double MedianX, MedianY, TrimmedMeanX, TrimmedMeanY;
+		ComputeOrderStatistics(X, SumX, TrimCount, MedianX, TrimmedMeanX);
+		ComputeOrderStatistics(Y, SumY, TrimCount, MedianY, TrimmedMeanY);
+		OutState.MedianAxes = FVector2D(static_cast<float>(MedianX), static_cast<float>(MedianY));
+		OutState.TrimmedMeanAxes = FVector2D(static_cast<float>(TrimmedMeanX), static_cast<float>(TrimmedMeanY));
+	}
+}
+
+FMixerInteractivityModule_WithSessionState::FMixerInteractivityModule_WithSessionState()
+	: InputEpoch(1)
+	, bPerParticipantState(false)
+{
+}
 
 void FMixerInteractivityModule_WithSessionState::TriggerButtonCooldown(FName Button, FTimespan CooldownTime)
 {
@@ -26,7 +186,12 @@ void FMixerInteractivityModule_WithSessionState::TriggerButtonCooldown(FName But
 
 bool FMixerInteractivityModule_WithSessionState::GetButtonDescription(FName Button, FMixerButtonDescription& OutDesc)
 {
-	FMixerButtonPropertiesCached* CachedProps = Buttons.Find(Button);
+	return GetButtonDescription(FMixerButtonHandle(Buttons.FindIndex(Button)), OutDesc);
+}
+
+bool FMixerInteractivityModule_WithSessionState::GetButtonDescription(FMixerButtonHandle Button, FMixerButtonDescription& OutDesc)
+{
+	FMixerButtonPropertiesCached* CachedProps = Buttons.Get(Button.Index);
 	if (CachedProps != nullptr)
 	{
 		OutDesc = CachedProps->Desc;
@@ -40,10 +205,15 @@ bool FMixerInteractivityModule_WithSessionState::GetButtonDescription(FName Butt
 
 bool FMixerInteractivityModule_WithSessionState::GetButtonState(FName Button, FMixerButtonState& OutState)
 {
-	FMixerButtonPropertiesCached* CachedProps = Buttons.Find(Button);
+	return GetButtonState(FMixerButtonHandle(Buttons.FindIndex(Button)), OutState);
+}
+
+bool FMixerInteractivityModule_WithSessionState::GetButtonState(FMixerButtonHandle Button, FMixerButtonState& OutState)
+{
+	FMixerButtonPropertiesCached* CachedProps = Buttons.Get(Button.Index);
 	if (CachedProps != nullptr)
 	{
-		OutState = CachedProps->State;
+		ReadButtonState(*CachedProps, OutState);
 		if (!bPerParticipantState)
 		{
 			OutState.PressCount = 0;
@@ -65,12 +235,13 @@ bool FMixerInteractivityModule_WithSessionState::GetButtonState(FName Button, ui
 		FMixerButtonPropertiesCached* CachedProps = Buttons.Find(Button);
 		if (CachedProps != nullptr)
 		{
-			OutState = CachedProps->State;
+			ReadButtonState(*CachedProps, OutState);
 
 			// Even with per-participant tracking on we don't maintain these.  
 			OutState.DownCount = 0;
 			OutState.UpCount = 0;
-			OutState.PressCount = CachedProps->HoldingParticipants.Contains(ParticipantId) ? 1 : 0;
+			FMixerParticipantHandle Participant = RemoteParticipants.FindByUserId(ParticipantId);
+			OutState.PressCount = Participant.IsSet() && CachedProps->HoldingParticipants.Contains(Participant.Slot) ? 1 : 0;
 
 			return true;
 		}
@@ -89,6 +260,91 @@ bool FMixerInteractivityModule_WithSessionState::GetButtonState(FName Button, ui
 	}
 }
 
+bool FMixerInteractivityModule_WithSessionState::GetButtonStateForGroup(FName Button, FName GroupName, FMixerButtonState& OutState)
+{
+	FMixerButtonPropertiesCached* CachedProps = Buttons.Find(Button);
+	if (CachedProps != nullptr)
+	{
+		ReadButtonState(*CachedProps, OutState);
+
+		const FMixerButtonGroupTally* Tally = CachedProps->CountsEpoch == InputEpoch ? CachedProps->TallyByGroup.Find(GroupName) : nullptr;
+		OutState.DownCount = Tally != nullptr ? Tally->DownCount : 0;
+		OutState.UpCount = Tally != nullptr ? Tally->UpCount : 0;
+
+		OutState.PressCount = 0;
+		if (bPerParticipantState)
+		{
+			FMixerParticipantSlotSet GroupSlots;
+			RemoteParticipants.GetSlotsInGroup(GroupName, GroupSlots);
+			OutState.PressCount = CachedProps->HoldingParticipants.CountIntersection(GroupSlots);
+		}
+		return true;
+	}
+	else
+	{
+		return false;
+	}
+}
+
+bool FMixerInteractivityModule_WithSessionState::GetButtonPressHistogram(FName Button, FMixerButtonPressHistogram& OutHistogram)
+{
+	FMixerButtonPropertiesCached* CachedProps = Buttons.Find(Button);
+	if (CachedProps != nullptr)
+	{
+		OutHistogram = CachedProps->PressHistogram;
+		if (CachedProps->CountsEpoch != InputEpoch)
+		{
+			// Counts for an interval that has ended are only folded in by the next press
+			OutHistogram.AddInterval(CachedProps->State.DownCount);
+		}
+		return true;
+	}
+	else
+	{
+		return false;
+	}
+}
+
+bool FMixerInteractivityModule_WithSessionState::GetParticipantsHoldingButtons(const TArray<FName>& ButtonNames, TArray<uint32>& OutParticipantIds)
+{
+	if (bPerParticipantState)
+	{
+		FMixerParticipantSlotSet Holding;
+		for (int32 i = 0; i < ButtonNames.Num(); ++i)
+		{
+			FMixerButtonPropertiesCached* CachedProps = Buttons.Find(ButtonNames[i]);
+			if (CachedProps == nullptr)
+			{
+				return false;
+			}
+
+			if (i == 0)
+			{
+				Holding = CachedProps->HoldingParticipants;
+			}
+			else
+			{
+				Holding.IntersectWith(CachedProps->HoldingParticipants);
+			}
+		}
+
+		OutParticipantIds.Reserve(OutParticipantIds.Num() + Holding.Num());
+		Holding.ForEachSlot([this, &OutParticipantIds](int32 Slot)
+		{
+			OutParticipantIds.Add(RemoteParticipants.GetUserId(RemoteParticipants.GetHandleAtSlot(Slot)));
+		});
+		return true;
+	}
+	else
+	{
+		if (GetInteractiveConnectionAuthState() != EMixerLoginState::Not_Logged_In)
+		{
+			UE_LOG(LogMixerInteractivity, Error, TEXT("Querying which participants are holding buttons requires that per-participant state caching is enabled."));
+		}
+		return false;
+	}
+}
+
 bool FMixerInteractivityModule_WithSessionState::GetStickDescription(FName Stick, FMixerStickDescription& OutDesc)
 {
 	// No supported properties
@@ -96,12 +352,22 @@ bool FMixerInteractivityModule_WithSessionState::GetStickDescription(FName Stick
 }
 
 bool FMixerInteractivityModule_WithSessionState::GetStickState(FName Stick, FMixerStickState& OutState)
+{
+	return GetStickState(FMixerStickHandle(Sticks.FindIndex(Stick)), OutState);
+}
+
+bool FMixerInteractivityModule_WithSessionState::GetStickState(FMixerStickHandle Stick, FMixerStickState& OutState)
 {
 	if (bPerParticipantState)
 	{
-		FMixerStickPropertiesCached* CachedProps = Sticks.Find(Stick);
+		FMixerStickPropertiesCached* CachedProps = Sticks.Get(Stick.Index);
 		if (CachedProps != nullptr)
 		{
+			if (CachedProps->bAggregatesDirty)
+			{
+				ComputeStickAggregates(*CachedProps, CachedProps->Deflected, RemoteParticipants, StickScratch, CachedProps->State);
+				CachedProps->bAggregatesDirty = false;
+			}
 			OutState = CachedProps->State;
 
 			return true;
@@ -130,8 +396,14 @@ bool FMixerInteractivityModule_WithSessionState::GetStickState(FName Stick, uint
 		{
 			OutState.Enabled = CachedProps->State.Enabled;
 
-			FVector2D* PerParticipantState = CachedProps->PerParticipantStickValue.Find(ParticipantId);
-			OutState.Axes = (PerParticipantState != nullptr) ? *PerParticipantState : FVector2D(0, 0);
+			FMixerParticipantHandle Participant = RemoteParticipants.FindByUserId(ParticipantId);
+			const bool bDeflected = Participant.IsSet() && CachedProps->Deflected.Contains(Participant.Slot);
+			OutState.Axes = bDeflected ? FVector2D(CachedProps->ValuesX[Participant.Slot], CachedProps->ValuesY[Participant.Slot]) : FVector2D(0, 0);
+			OutState.AxesVariance = FVector2D(0, 0);
+			OutState.LevelWeightedAxes = OutState.Axes;
+			OutState.MedianAxes = OutState.Axes;
+			OutState.TrimmedMeanAxes = OutState.Axes;
+			OutState.ParticipantCount = bDeflected ? 1 : 0;
 			return true;
 		}
 		else
@@ -149,6 +421,36 @@ bool FMixerInteractivityModule_WithSessionState::GetStickState(FName Stick, uint
 	}
 }
 
+bool FMixerInteractivityModule_WithSessionState::GetStickStateForGroup(FName Stick, FName GroupName, FMixerStickState& OutState)
+{
+	if (bPerParticipantState)
+	{
+		FMixerStickPropertiesCached* CachedProps = Sticks.Find(Stick);
+		if (CachedProps != nullptr)
+		{
+			FMixerParticipantSlotSet GroupSlots;
+			RemoteParticipants.GetSlotsInGroup(GroupName, GroupSlots);
+			GroupSlots.IntersectWith(CachedProps->Deflected);
+
+			OutState.Enabled = CachedProps->State.Enabled;
+			ComputeStickAggregates(*CachedProps, GroupSlots, RemoteParticipants, StickScratch, OutState);
+			return true;
+		}
+		else
+		{
+			return false;
+		}
+	}
+	else
+	{
+		if (GetInteractiveConnectionAuthState() != EMixerLoginState::Not_Logged_In)
+		{
+			UE_LOG(LogMixerInteractivity, Error, TEXT("Polling per-group stick state requires that per-participant state caching is enabled."));
+		}
+		return false;
+	}
+}
+
 
 void FMixerInteractivityModule_WithSessionState::SetLabelText(FName Label, const FText& DisplayText)
 {
@@ -163,7 +465,12 @@ void FMixerInteractivityModule_WithSessionState::SetLabelText(FName Label, const
 
 bool FMixerInteractivityModule_WithSessionState::GetLabelDescription(FName Label, FMixerLabelDescription& OutDesc)
 {
-	FMixerLabelPropertiesCached* CachedProps = Labels.Find(Label);
+	return GetLabelDescription(FMixerLabelHandle(Labels.FindIndex(Label)), OutDesc);
+}
+
+bool FMixerInteractivityModule_WithSessionState::GetLabelDescription(FMixerLabelHandle Label, FMixerLabelDescription& OutDesc)
+{
+	FMixerLabelPropertiesCached* CachedProps = Labels.Get(Label.Index);
 	if (CachedProps != nullptr)
 	{
 		OutDesc = CachedProps->Desc;
@@ -177,7 +484,12 @@ bool FMixerInteractivityModule_WithSessionState::GetLabelDescription(FName Label
 
 bool FMixerInteractivityModule_WithSessionState::GetTextboxDescription(FName Textbox, FMixerTextboxDescription& OutDesc)
 {
-	FMixerTextboxPropertiesCached* CachedProps = Textboxes.Find(Textbox);
+	return GetTextboxDescription(FMixerTextboxHandle(Textboxes.FindIndex(Textbox)), OutDesc);
+}
+
+bool FMixerInteractivityModule_WithSessionState::GetTextboxDescription(FMixerTextboxHandle Textbox, FMixerTextboxDescription& OutDesc)
+{
+	FMixerTextboxPropertiesCached* CachedProps = Textboxes.Get(Textbox.Index);
 	if (CachedProps != nullptr)
 	{
 		OutDesc = CachedProps->Desc;
@@ -189,39 +501,62 @@ bool FMixerInteractivityModule_WithSessionState::GetTextboxDescription(FName Tex
 	}
 }
 
+FMixerButtonHandle FMixerInteractivityModule_WithSessionState::ResolveButton(FName Button)
+{
+	return FMixerButtonHandle(Buttons.Resolve(Button));
+}
+
+FMixerStickHandle FMixerInteractivityModule_WithSessionState::ResolveStick(FName Stick)
+{
+	return FMixerStickHandle(Sticks.Resolve(Stick));
+}
+
+FMixerLabelHandle FMixerInteractivityModule_WithSessionState::ResolveLabel(FName Label)
+{
+	return FMixerLabelHandle(Labels.Resolve(Label));
+}
+
+FMixerTextboxHandle FMixerInteractivityModule_WithSessionState::ResolveTextbox(FName Textbox)
+{
+	return FMixerTextboxHandle(Textboxes.Resolve(Textbox));
+}
+
 TSharedPtr<const FMixerRemoteUser> FMixerInteractivityModule_WithSessionState::GetParticipant(uint32 ParticipantId)
 {
-	TSharedPtr<FMixerRemoteUser>* FoundUser = RemoteParticipantCacheByUint.Find(ParticipantId);
-	return FoundUser ? *FoundUser : TSharedPtr<const FMixerRemoteUser>();
+	return RemoteParticipants.GetView(RemoteParticipants.FindByUserId(ParticipantId));
 }
 
 bool FMixerInteractivityModule_WithSessionState::GetParticipantsInGroup(FName GroupName, TArray<TSharedPtr<const FMixerRemoteUser>>& OutParticipants)
 {
-	for (TMap<uint32, TSharedPtr<FMixerRemoteUser>>::TConstIterator It(RemoteParticipantCacheByUint); It; ++It)
-	{
-		if (It->Value->Group == GroupName)
-		{
-			OutParticipants.Add(It->Value);
-		}
-	}
+	RemoteParticipants.GetViewsInGroup(GroupName, OutParticipants);
+	return true;
+}
 
+bool FMixerInteractivityModule_WithSessionState::GetParticipantIdsInGroup(FName GroupName, TArray<uint32>& OutParticipantIds)
+{
+	RemoteParticipants.GetUserIdsInGroup(GroupName, OutParticipantIds);
 	return true;
 }
 
+int32 FMixerInteractivityModule_WithSessionState::GetParticipantCountInGroup(FName GroupName)
+{
+	return RemoteParticipants.GetNumInGroup(GroupName);
+}
+
 bool FMixerInteractivityModule_WithSessionState::Tick(float DeltaTime)
 {
 	FMixerInteractivityModule::Tick(DeltaTime);
 
-	FTimespan CooldownDecrement = FTimespan::FromSeconds(DeltaTime);
-	for (TMap<FName, FMixerButtonPropertiesCached>::TIterator It(Buttons); It; ++It)
+	// Deliver before resetting counts so listeners can poll state consistent with the frame.
+	// Sent even when empty, since listeners may report state that changes without new input.
+	if (OnInputFrame().IsBound())
 	{
-		It->Value.State.RemainingCooldown = FMath::Max(It->Value.State.RemainingCooldown - CooldownDecrement, FTimespan::Zero());
-
-		It->Value.State.DownCount = 0;
-		It->Value.State.UpCount = 0;
-
-		// Leave PressCount alone
+		OnInputFrame().Broadcast(PendingInputFrame);
 	}
+	PendingInputFrame.Reset();
+
+	// Resets every button's per-interval counts without visiting them.  PressCount carries over.
+	++InputEpoch;
 
 	return true;
 }
@@ -237,11 +572,11 @@ bool FMixerInteractivityModule_WithSessionState::HandleSingleControlUpdate(FName
 			uint64 TimeNowInMixerUnits = FDateTime::UtcNow().ToUnixTimestamp() * 1000;
 			if (Cooldown > TimeNowInMixerUnits)
 			{
-				ButtonProps->State.RemainingCooldown = FTimespan::FromMilliseconds(static_cast<double>(static_cast<uint64>(Cooldown) - TimeNowInMixerUnits));
+				ButtonProps->CooldownEnd = FDateTime::UtcNow() + FTimespan::FromMilliseconds(static_cast<double>(static_cast<uint64>(Cooldown) - TimeNowInMixerUnits));
 			}
 			else
 			{
-				ButtonProps->State.RemainingCooldown = FTimespan::Zero();
+				ButtonProps->CooldownEnd = FDateTime(0);
 			}
 		}
 
@@ -299,8 +634,8 @@ void FMixerInteractivityModule_WithSessionState::StartSession(bool bCachePerPart
 	check(Sticks.Num() == 0);
 	check(Labels.Num() == 0);
 	check(Textboxes.Num() == 0);
-	check(RemoteParticipantCacheByGuid.Num() == 0);
-	check(RemoteParticipantCacheByUint.Num() == 0);
+	check(ControlDirectory.Num() == 0);
+	check(RemoteParticipants.Num() == 0);
 	bPerParticipantState = bCachePerParticipantState;
 }
 
@@ -310,8 +645,9 @@ void FMixerInteractivityModule_WithSessionState::EndSession()
 	Sticks.Empty();
 	Labels.Empty();
 	Textboxes.Empty();
-	RemoteParticipantCacheByGuid.Empty();
-	RemoteParticipantCacheByUint.Empty();
+	ControlDirectory.Empty();
+	RemoteParticipants.Empty();
+	PendingInputFrame.Reset();
 }
 
 bool FMixerInteractivityModule_WithSessionState::CachePerParticipantState()
@@ -319,9 +655,10 @@ bool FMixerInteractivityModule_WithSessionState::CachePerParticipantState()
 	return bPerParticipantState;
 }
 
-void FMixerInteractivityModule_WithSessionState::AddButton(FName ControlId, const FMixerButtonPropertiesCached& Props)
+void FMixerInteractivityModule_WithSessionState::AddButton(const FString& ControlId, const FMixerButtonPropertiesCached& Props)
 {
-	Buttons.Add(ControlId, Props);
+	const int32 Index = Buttons.Add(*ControlId, Props);
+	ControlDirectory.Add(ControlId, EMixerControlKind::Button, Index);
 }
 
 FMixerButtonPropertiesCached* FMixerInteractivityModule_WithSessionState::GetButton(FName ControlId)
@@ -329,9 +666,10 @@ FMixerButtonPropertiesCached* FMixerInteractivityModule_WithSessionState::GetBut
 	return Buttons.Find(ControlId);
 }
 
-void FMixerInteractivityModule_WithSessionState::AddStick(FName ControlId, const FMixerStickPropertiesCached& Props)
+void FMixerInteractivityModule_WithSessionState::AddStick(const FString& ControlId, const FMixerStickPropertiesCached& Props)
 {
-	Sticks.Add(ControlId, Props);
+	const int32 Index = Sticks.Add(*ControlId, Props);
+	ControlDirectory.Add(ControlId, EMixerControlKind::Stick, Index);
 }
 
 FMixerStickPropertiesCached* FMixerInteractivityModule_WithSessionState::GetStick(FName ControlId)
@@ -339,9 +677,107 @@ FMixerStickPropertiesCached* FMixerInteractivityModule_WithSessionState::GetStic
 	return Sticks.Find(ControlId);
 }
 
-void FMixerInteractivityModule_WithSessionState::AddLabel(FName ControlId, const FMixerLabelPropertiesCached& Props)
+FMixerButtonPropertiesCached* FMixerInteractivityModule_WithSessionState::ProcessButtonInput(FMixerButtonHandle Button, FMixerParticipantHandle Participant, bool bPressed)
+{
+	FMixerButtonPropertiesCached* CachedProps = Buttons.Get(Button.Index);
+	if (CachedProps != nullptr)
+	{
+		// Input from a participant we haven't heard about still counts towards the totals
+		TouchButtonCounts(*CachedProps);
+
+		const bool bKnownParticipant = RemoteParticipants.IsValid(Participant);
+		FMixerButtonGroupTally* GroupTally = bKnownParticipant ? &CachedProps->TallyByGroup.FindOrAdd(RemoteParticipants.GetGroup(Participant)) : nullptr;
+		if (bPressed)
+		{
+			CachedProps->State.DownCount += 1;
+			if (GroupTally != nullptr)
+			{
+				GroupTally->DownCount += 1;
+			}
+			if (bPerParticipantState && bKnownParticipant)
+			{
+				CachedProps->HoldingParticipants.Add(Participant.Slot);
+				CachedProps->State.PressCount = CachedProps->HoldingParticipants.Num();
+			}
+		}
+		else
+		{
+			CachedProps->State.UpCount += 1;
+			if (GroupTally != nullptr)
+			{
+				GroupTally->UpCount += 1;
+			}
+			if (bPerParticipantState && bKnownParticipant)
+			{
+				CachedProps->HoldingParticipants.Remove(Participant.Slot);
+				CachedProps->State.PressCount = CachedProps->HoldingParticipants.Num();
+			}
+		}
+	}
+	return CachedProps;
+}
+
+void FMixerInteractivityModule_WithSessionState::ReadButtonState(const FMixerButtonPropertiesCached& Button, FMixerButtonState& OutState) const
 {
-	Labels.Add(ControlId, Props);
+	OutState = Button.State;
+
+	if (Button.CountsEpoch != InputEpoch)
+	{
+		OutState.DownCount = 0;
+		OutState.UpCount = 0;
+	}
+
+	const FDateTime Now = FDateTime::UtcNow();
+	OutState.RemainingCooldown = Button.CooldownEnd > Now ? Button.CooldownEnd - Now : FTimespan::Zero();
+}
+
+void FMixerInteractivityModule_WithSessionState::TouchButtonCounts(FMixerButtonPropertiesCached& Button)
+{
+	if (Button.CountsEpoch != InputEpoch)
+	{
+		// The interval the counts belonged to is over
+		Button.PressHistogram.AddInterval(Button.State.DownCount);
+		Button.State.DownCount = 0;
+		Button.State.UpCount = 0;
+		Button.TallyByGroup.Reset();
+		Button.CountsEpoch = InputEpoch;
+	}
+}
+
+FMixerStickPropertiesCached* FMixerInteractivityModule_WithSessionState::ProcessStickInput(FMixerStickHandle Stick, FMixerParticipantHandle Participant, FVector2D Position)
+{
+	FMixerStickPropertiesCached* CachedProps = Sticks.Get(Stick.Index);
+	if (CachedProps != nullptr && bPerParticipantState && RemoteParticipants.IsValid(Participant))
+	{
+		const int32 Slot = Participant.Slot;
+		if (Slot >= CachedProps->ValuesX.Num())
+		{
+			CachedProps->ValuesX.SetNumZeroed(Slot + 1);
+			CachedProps->ValuesY.SetNumZeroed(Slot + 1);
+		}
+
+		CachedProps->ValuesX[Slot] = Position.X;
+		CachedProps->ValuesY[Slot] = Position.Y;
+		if (!Position.IsZero())
+		{
+			CachedProps->Deflected.Add(Slot);
+		}
+		else
+		{
+			CachedProps->Deflected.Remove(Slot);
+		}
+
+		// Aggregates are only recomputed if somebody polls for them
+		CachedProps->State.ParticipantCount = CachedProps->Deflected.Num();
+		CachedProps->bAggregatesDirty = true;
+	}
+	return CachedProps;
+}
+
+void FMixerInteractivityModule_WithSessionState::AddLabel(const FString& ControlId, const FMixerLabelPropertiesCached& Props)
+{
+	const int32 Index = Labels.Add(*ControlId, Props);
+	ControlDirectory.Add(ControlId, EMixerControlKind::Label, Index);
 }
 
 FMixerLabelPropertiesCached* FMixerInteractivityModule_WithSessionState::GetLabel(FName ControlId)
@@ -349,9 +785,10 @@ FMixerLabelPropertiesCached* FMixerInteractivityModule_WithSessionState::GetLabe
 	return Labels.Find(ControlId);
 }
 
-void FMixerInteractivityModule_WithSessionState::AddTextbox(FName ControlId, const FMixerTextboxPropertiesCached& Props)
+void FMixerInteractivityModule_WithSessionState::AddTextbox(const FString& ControlId, const FMixerTextboxPropertiesCached& Props)
 {
-	Textboxes.Add(ControlId, Props);
+	const int32 Index = Textboxes.Add(*ControlId, Props);
+	ControlDirectory.Add(ControlId, EMixerControlKind::Textbox, Index);
 }
 
 FMixerTextboxPropertiesCached* FMixerInteractivityModule_WithSessionState::GetTextbox(FName ControlId)
@@ -359,43 +796,144 @@ FMixerTextboxPropertiesCached* FMixerInteractivityModule_WithSessionState::GetTe
 	return Textboxes.Find(ControlId);
 }
 
-void FMixerInteractivityModule_WithSessionState::AddUser(TSharedPtr<FMixerRemoteUser> User)
+FMixerTextboxPropertiesCached* FMixerInteractivityModule_WithSessionState::GetTextbox(FMixerTextboxHandle Textbox)
+{
+	return Textboxes.Get(Textbox.Index);
+}
+
+FMixerParticipantHandle FMixerInteractivityModule_WithSessionState::AddUser(const FMixerRemoteUser& User, const ANSICHAR* Utf8SessionId, int32 SessionIdLength)
 {
-	RemoteParticipantCacheByGuid.Add(User->SessionGuid, User);
-	RemoteParticipantCacheByUint.Add(User->Id, User);
+	// A viewer rejoining from elsewhere replaces their old session.  Remove it here rather than
+	// leaving it to the table so that the old session's per-slot state is released too.
+	FMixerParticipantHandle StaleUser = RemoteParticipants.FindByUserId(User.Id);
+	if (StaleUser.IsSet() && RemoteParticipants.GetSessionGuid(StaleUser) != User.SessionGuid)
+	{
+		RemoveUser(StaleUser);
+	}
+
+	FMixerParticipantHandle Added = RemoteParticipants.Add(User);
+	RemoteParticipants.SetSessionIdText(Added, Utf8SessionId, SessionIdLength);
+	return Added;
 }
 
-void FMixerInteractivityModule_WithSessionState::RemoveUser(TSharedPtr<FMixerRemoteUser> User)
+void FMixerInteractivityModule_WithSessionState::UpdateUser(FMixerParticipantHandle User, const FMixerRemoteUser& UpdatedUser)
 {
-	RemoteParticipantCacheByGuid.Remove(User->SessionGuid);
-	RemoteParticipantCacheByUint.Remove(User->Id);
+	RemoteParticipants.Update(User, UpdatedUser);
+}
+
+void FMixerInteractivityModule_WithSessionState::RemoveUser(FMixerParticipantHandle User)
+{
+	if (RemoteParticipants.IsValid(User))
+	{
+		// The slot may be reused by the next participant to join
+		Buttons.ForEach([&User](FMixerButtonPropertiesCached& Button)
+		{
+			if (Button.HoldingParticipants.Remove(User.Slot))
+			{
+				Button.State.PressCount = Button.HoldingParticipants.Num();
+			}
+		});
+
+		Sticks.ForEach([&User](FMixerStickPropertiesCached& Stick)
+		{
+			if (Stick.Deflected.Remove(User.Slot))
+			{
+				Stick.ValuesX[User.Slot] = 0;
+				Stick.ValuesY[User.Slot] = 0;
+				Stick.State.ParticipantCount = Stick.Deflected.Num();
+				Stick.bAggregatesDirty = true;
+			}
+		});
+
+		RemoteParticipants.Remove(User);
+	}
 }
 
 void FMixerInteractivityModule_WithSessionState::RemoveUser(FGuid ParticipantSessionId)
 {
-	TSharedPtr<FMixerRemoteUser> RemovedUser = RemoteParticipantCacheByGuid.FindAndRemoveChecked(ParticipantSessionId);
-	RemoteParticipantCacheByUint.Remove(RemovedUser->Id);
+	FMixerParticipantHandle User = RemoteParticipants.FindBySessionGuid(ParticipantSessionId);
+	verify(RemoteParticipants.IsValid(User));
+	RemoveUser(User);
 }
 
-TSharedPtr<FMixerRemoteUser> FMixerInteractivityModule_WithSessionState::GetCachedUser(uint32 ParticipantId)
+FMixerParticipantHandle FMixerInteractivityModule_WithSessionState::FindCachedUser(uint32 ParticipantId) const
 {
-	TSharedPtr<FMixerRemoteUser>* User = RemoteParticipantCacheByUint.Find(ParticipantId);
-	return User != nullptr ? *User : nullptr;
+	return RemoteParticipants.FindByUserId(ParticipantId);
 }
 
-TSharedPtr<FMixerRemoteUser> FMixerInteractivityModule_WithSessionState::GetCachedUser(FGuid ParticipantSessionId)
+FMixerParticipantHandle FMixerInteractivityModule_WithSessionState::FindCachedUser(FGuid ParticipantSessionId) const
 {
-	TSharedPtr<FMixerRemoteUser>* User = RemoteParticipantCacheByGuid.Find(ParticipantSessionId);
-	return User != nullptr ? *User : nullptr;
+	return RemoteParticipants.FindBySessionGuid(ParticipantSessionId);
+}
+
+FMixerParticipantHandle FMixerInteractivityModule_WithSessionState::FindCachedUser(const ANSICHAR* Utf8SessionId, int32 SessionIdLength) const
+{
+	return RemoteParticipants.FindBySessionIdText(Utf8SessionId, SessionIdLength);
+}
+
+FMixerParticipantHandle FMixerInteractivityModule_WithSessionState::FindCachedUser(const TCHAR* SessionId, int32 SessionIdLength) const
+{
+	return RemoteParticipants.FindBySessionIdText(SessionId, SessionIdLength);
+}
+
+TSharedPtr<const FMixerRemoteUser> FMixerInteractivityModule_WithSessionState::GetCachedUserView(FMixerParticipantHandle User)
+{
+	return RemoteParticipants.GetView(User);
 }
 
 void FMixerInteractivityModule_WithSessionState::ReassignUsers(FName FromGroup, FName ToGroup)
 {
-	for (TMap<uint32, TSharedPtr<FMixerRemoteUser>>::TConstIterator It(RemoteParticipantCacheByUint); It; ++It)
+	RemoteParticipants.ReassignGroup(FromGroup, ToGroup);
+}
+
+void FMixerInteractivityModule_WithSessionState::DispatchButtonEvent(FMixerButtonHandle Button, FMixerParticipantHandle Participant, const FMixerButtonEventDetails& Details)
+{
+	if (OnInputFrame().IsBound())
 	{
-		if (It->Value->Group == FromGroup)
-		{
-			It->Value->Group = ToGroup;
-		}
+		FMixerButtonInput& Input = PendingInputFrame.Buttons[PendingInputFrame.Buttons.AddUninitialized()];
+		Input.Button = Button;
+		Input.ParticipantId = RemoteParticipants.IsValid(Participant) ? RemoteParticipants.GetUserId(Participant) : 0;
+		Input.SparkCost = Details.SparkCost;
+		Input.TransactionIndex = Details.TransactionId.IsEmpty() ? INDEX_NONE : PendingInputFrame.TransactionIds.Add(Details.TransactionId);
+		Input.Pressed = Details.Pressed;
+	}
+
+	if (OnButtonEvent().IsBound())
+	{
+		OnButtonEvent().Broadcast(Buttons.GetName(Button.Index), RemoteParticipants.GetView(Participant), Details);
 	}
-}
\ No newline at end of file
+}
+
+void FMixerInteractivityModule_WithSessionState::DispatchStickEvent(FMixerStickHandle Stick, FMixerParticipantHandle Participant, FVector2D Position)
+{
+	if (OnInputFrame().IsBound())
+	{
+		FMixerStickInput& Input = PendingInputFrame.Sticks[PendingInputFrame.Sticks.AddUninitialized()];
+		Input.Stick = Stick;
+		Input.ParticipantId = RemoteParticipants.IsValid(Participant) ? RemoteParticipants.GetUserId(Participant) : 0;
+		Input.Axes = Position;
+	}
+
+	if (OnStickEvent().IsBound())
+	{
+		OnStickEvent().Broadcast(Sticks.GetName(Stick.Index), RemoteParticipants.GetView(Participant), Position);
+	}
+}
+
+void FMixerInteractivityModule_WithSessionState::DispatchTextboxSubmitEvent(FMixerTextboxHandle Textbox, FMixerParticipantHandle Participant, const FMixerTextboxEventDetails& Details)
+{
+	if (OnInputFrame().IsBound())
+	{
+		FMixerTextboxInput& Input = PendingInputFrame.TextboxSubmits[PendingInputFrame.TextboxSubmits.AddUninitialized()];
+		Input.Textbox = Textbox;
+		Input.ParticipantId = RemoteParticipants.IsValid(Participant) ? RemoteParticipants.GetUserId(Participant) : 0;
+		Input.SparkCost = Details.SparkCost;
+		Input.TransactionIndex = Details.TransactionId.IsEmpty() ? INDEX_NONE : PendingInputFrame.TransactionIds.Add(Details.TransactionId);
+		Input.TextIndex = PendingInputFrame.SubmittedTexts.Add(Details.SubmittedText);
+	}
+
+	if (OnTextboxSubmitEvent().IsBound())
+	{
+		OnTextboxSubmitEvent().Broadcast(Textboxes.GetName(Textbox.Index), RemoteParticipants.GetView(Participant), Details);
+	}
+}
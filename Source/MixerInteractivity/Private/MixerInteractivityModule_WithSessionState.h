@@ -10,20 +10,79 @@
 #pragma once
 
 #include "MixerInteractivityModulePrivate.h"
+#include "MixerParticipantTable.h"
+#include "MixerControlTable.h"
+#include "MixerControlDirectory.h"
+
+/** Button events from a single group over the current interval. */
+struct FMixerButtonGroupTally
+{
+	uint32 DownCount;
+	uint32 UpCount;
+
+	FMixerButtonGroupTally()
+		: DownCount(0)
+		, UpCount(0)
+	{
+	}
+};
 
 struct FMixerButtonPropertiesCached
 {
 	FMixerButtonDescription Desc;
 	FMixerButtonState State;
-	TSet<uint32> HoldingParticipants;
+	/** Slots in the participant table of the remote users holding the button down. */
+	FMixerParticipantSlotSet HoldingParticipants;
+	TMap<FName, FMixerButtonGroupTally> TallyByGroup;
 	FName SceneId;
+
+	/** Interval in which State.DownCount, State.UpCount and TallyByGroup were last written.  They read as zero in any other. */
+	uint64 CountsEpoch;
+
+	/** When the button comes off cooldown.  State.RemainingCooldown is derived from this when read. */
+	FDateTime CooldownEnd;
+
+	/** Presses per interval for every interval before CountsEpoch.  CountsEpoch's own is added once it has ended. */
+	FMixerButtonPressHistogram PressHistogram;
+
+	FMixerButtonPropertiesCached()
+		: CountsEpoch(0)
+		, CooldownEnd(0)
+	{
+	}
 };
 
 struct FMixerStickPropertiesCached
 {
 	FMixerStickDescription Desc;
 	FMixerStickState State;
-	TMap<uint32, FVector2D> PerParticipantStickValue;
+
+	/** Each remote user's joystick position, indexed by participant table slot.  Zero outside Deflected. */
+	TArray<float> ValuesX;
+	TArray<float> ValuesY;
+	FMixerParticipantSlotSet Deflected;
+
+	/** Set when the values change; the aggregates in State are recomputed from scratch when next read. */
+	bool bAggregatesDirty;
+
+	FMixerStickPropertiesCached()
+		: bAggregatesDirty(false)
+	{
+		State.Axes = FVector2D(0, 0);
+		State.AxesVariance = FVector2D(0, 0);
+		State.LevelWeightedAxes = FVector2D(0, 0);
+		State.MedianAxes = FVector2D(0, 0);
+		State.TrimmedMeanAxes = FVector2D(0, 0);
+		State.ParticipantCount = 0;
+	}
+};
+
+/** Working space for recomputing stick aggregates, kept between calls so polling doesn't allocate. */
+struct FMixerStickAggregateScratch
+{
+	TArray<float> X;
+	TArray<float> Y;
+	TArray<float> Weights;
 };
 
 struct FMixerLabelPropertiesCached
@@ -40,18 +99,35 @@ struct FMixerTextboxPropertiesCached
 class FMixerInteractivityModule_WithSessionState : public FMixerInteractivityModule
 {
 public:
+	FMixerInteractivityModule_WithSessionState();
+
 	virtual void TriggerButtonCooldown(FName Button, FTimespan CooldownTime);
 	virtual bool GetButtonDescription(FName Button, FMixerButtonDescription& OutDesc);
 	virtual bool GetButtonState(FName Button, FMixerButtonState& OutState);
 	virtual bool GetButtonState(FName Button, uint32 ParticipantId, FMixerButtonState& OutState);
+	virtual bool GetButtonStateForGroup(FName Button, FName GroupName, FMixerButtonState& OutState);
+	virtual bool GetButtonPressHistogram(FName Button, FMixerButtonPressHistogram& OutHistogram);
+	virtual bool GetParticipantsHoldingButtons(const TArray<FName>& ButtonNames, TArray<uint32>& OutParticipantIds);
 	virtual bool GetStickDescription(FName Stick, FMixerStickDescription& OutDesc);
 	virtual bool GetStickState(FName Stick, FMixerStickState& OutState);
 	virtual bool GetStickState(FName Stick, uint32 ParticipantId, FMixerStickState& OutState);
+	virtual bool GetStickStateForGroup(FName Stick, FName GroupName, FMixerStickState& OutState);
 	virtual void SetLabelText(FName Label, const FText& DisplayText);
 	virtual bool GetLabelDescription(FName Label, FMixerLabelDescription& OutDesc);
 	virtual bool GetTextboxDescription(FName Textbox, FMixerTextboxDescription& OutDesc);
+	virtual FMixerButtonHandle ResolveButton(FName Button);
+	virtual bool GetButtonDescription(FMixerButtonHandle Button, FMixerButtonDescription& OutDesc);
+	virtual bool GetButtonState(FMixerButtonHandle Button, FMixerButtonState& OutState);
+	virtual FMixerStickHandle ResolveStick(FName Stick);
+	virtual bool GetStickState(FMixerStickHandle Stick, FMixerStickState& OutState);
+	virtual FMixerLabelHandle ResolveLabel(FName Label);
+	virtual bool GetLabelDescription(FMixerLabelHandle Label, FMixerLabelDescription& OutDesc);
+	virtual FMixerTextboxHandle ResolveTextbox(FName Textbox);
+	virtual bool GetTextboxDescription(FMixerTextboxHandle Textbox, FMixerTextboxDescription& OutDesc);
 	virtual TSharedPtr<const FMixerRemoteUser> GetParticipant(uint32 ParticipantId);
 	virtual bool GetParticipantsInGroup(FName GroupName, TArray<TSharedPtr<const FMixerRemoteUser>>& OutParticipants);
+	virtual bool GetParticipantIdsInGroup(FName GroupName, TArray<uint32>& OutParticipantIds);
+	virtual int32 GetParticipantCountInGroup(FName GroupName);
 
 public:
 	virtual bool Tick(float DeltaTime) override;
@@ -65,33 +141,99 @@ protected:
 
 	bool CachePerParticipantState();
 
-	void AddButton(FName ControlId, const FMixerButtonPropertiesCached& Props);
+	/**
+	* Control adders take the id exactly as the scene reported it.  The directory that routes input
+	* matches ids byte for byte, and an FName may come back with different casing.
+	*/
+	void AddButton(const FString& ControlId, const FMixerButtonPropertiesCached& Props);
 	FMixerButtonPropertiesCached* GetButton(FName ControlId);
 
-	void AddStick(FName ControlId, const FMixerStickPropertiesCached& Props);
+	void AddStick(const FString& ControlId, const FMixerStickPropertiesCached& Props);
 	FMixerStickPropertiesCached* GetStick(FName ControlId);
 
-	void AddLabel(FName ControlId, const FMixerLabelPropertiesCached& Props);
+	/**
+	* Find the control that input refers to from its id as it appears on the wire,
+	* without going through the name table.  Pass the raw message text, UTF-8 or
+	* TCHAR, rather than converting it first.
+	*/
+	FMixerControlDirectoryEntry FindControl(const ANSICHAR* Utf8ControlId, int32 Length) const { return ControlDirectory.Find(Utf8ControlId, Length); }
+	FMixerControlDirectoryEntry FindControl(const TCHAR* ControlId, int32 Length) const { return ControlDirectory.Find(ControlId, Length); }
+	FMixerControlDirectoryEntry FindControl(const FString& ControlId) const { return ControlDirectory.Find(ControlId); }
+
+	/**
+	* Fold a raw button event into the cached aggregates for the button.  Every
+	* backend should route button input through here so polled state is consistent.
+	*
+	* @Return	The cached button, or nullptr if it isn't known.
+	*/
+	FMixerButtonPropertiesCached* ProcessButtonInput(FMixerButtonHandle Button, FMixerParticipantHandle Participant, bool bPressed);
+
+	/**
+	* Fold a raw joystick position into the cached aggregates for the stick.
+	* A position of (0,0) means the participant has let go.
+	*
+	* @Return	The cached stick, or nullptr if it isn't known.
+	*/
+	FMixerStickPropertiesCached* ProcessStickInput(FMixerStickHandle Stick, FMixerParticipantHandle Participant, FVector2D Position);
+
+	/**
+	* Hand input to game code.  It is added to the pending input frame while OnInputFrame
+	* is bound and broadcast individually while the matching per-event delegate is bound.
+	*/
+	void DispatchButtonEvent(FMixerButtonHandle Button, FMixerParticipantHandle Participant, const FMixerButtonEventDetails& Details);
+	void DispatchStickEvent(FMixerStickHandle Stick, FMixerParticipantHandle Participant, FVector2D Position);
+	void DispatchTextboxSubmitEvent(FMixerTextboxHandle Textbox, FMixerParticipantHandle Participant, const FMixerTextboxEventDetails& Details);
+
+	void AddLabel(const FString& ControlId, const FMixerLabelPropertiesCached& Props);
 	FMixerLabelPropertiesCached* GetLabel(FName ControlId);
 
-	void AddTextbox(FName ControlId, const FMixerTextboxPropertiesCached& Props);
+	void AddTextbox(const FString& ControlId, const FMixerTextboxPropertiesCached& Props);
 	FMixerTextboxPropertiesCached* GetTextbox(FName ControlId);
-
-	void AddUser(TSharedPtr<FMixerRemoteUser> User);
-	void RemoveUser(TSharedPtr<FMixerRemoteUser> User);
+	FMixerTextboxPropertiesCached* GetTextbox(FMixerTextboxHandle Textbox);
+
+	/**
+	* Adds the participant, or updates them if their session is already known.
+	* The session id text is what the service sends with their input, as UTF-8.
+	*/
+	FMixerParticipantHandle AddUser(const FMixerRemoteUser& User, const ANSICHAR* Utf8SessionId, int32 SessionIdLength);
+	void UpdateUser(FMixerParticipantHandle User, const FMixerRemoteUser& UpdatedUser);
+	void RemoveUser(FMixerParticipantHandle User);
 	void RemoveUser(FGuid ParticipantSessionId);
-	TSharedPtr<FMixerRemoteUser> GetCachedUser(uint32 ParticipantId);
-	TSharedPtr<FMixerRemoteUser> GetCachedUser(FGuid ParticipantSessionId);
+	FMixerParticipantHandle FindCachedUser(uint32 ParticipantId) const;
+	FMixerParticipantHandle FindCachedUser(FGuid ParticipantSessionId) const;
+	/** Look a participant up by the session id text given to AddUser, without parsing it. */
+	FMixerParticipantHandle FindCachedUser(const ANSICHAR* Utf8SessionId, int32 SessionIdLength) const;
+	FMixerParticipantHandle FindCachedUser(const TCHAR* SessionId, int32 SessionIdLength) const;
+	TSharedPtr<const FMixerRemoteUser> GetCachedUserView(FMixerParticipantHandle User);
+	const FMixerParticipantTable& GetCachedUsers() const { return RemoteParticipants; }
 	void ReassignUsers(FName FromGroup, FName ToGroup);
 
 private:
-	TMap<FGuid, TSharedPtr<FMixerRemoteUser>> RemoteParticipantCacheByGuid;
-	TMap<uint32, TSharedPtr<FMixerRemoteUser>> RemoteParticipantCacheByUint;
+	/** Copy out button state, bringing the parts that expire with time up to date. */
+	void ReadButtonState(const FMixerButtonPropertiesCached& Button, FMixerButtonState& OutState) const;
+
+	/** Prepare the per-interval counts of a button to be incremented. */
+	void TouchButtonCounts(FMixerButtonPropertiesCached& Button);
+
+private:
+	FMixerParticipantTable RemoteParticipants;
+
+	/** Indexed by the handles given out by Resolve*, which outlive the session. */
+	TMixerControlTable<FMixerButtonPropertiesCached> Buttons;
+	TMixerControlTable<FMixerStickPropertiesCached> Sticks;
+	TMixerControlTable<FMixerLabelPropertiesCached> Labels;
+	TMixerControlTable<FMixerTextboxPropertiesCached> Textboxes;
+
+	FMixerStickAggregateScratch StickScratch;
+
+	/** Routes input for controls of every kind in the current session. */
+	FMixerControlDirectory ControlDirectory;
+
+	/** Input received since the last tick, if anybody is listening for it. */
+	FMixerInputFrame PendingInputFrame;
 
-	TMap<FName, FMixerButtonPropertiesCached> Buttons;
-	TMap<FName, FMixerStickPropertiesCached> Sticks;
-	TMap<FName, FMixerLabelPropertiesCached> Labels;
-	TMap<FName, FMixerTextboxPropertiesCached> Textboxes;
+	/** Advanced every tick, ending the interval that button counts cover. */
+	uint64 InputEpoch;
 
 	bool bPerParticipantState;
 };
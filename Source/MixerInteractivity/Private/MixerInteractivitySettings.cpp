@@ -14,8 +14,18 @@
 
 UMixerInteractivitySettings::UMixerInteractivitySettings()
 	: bPerParticipantStateCaching(true)
+	, StickTrimFraction(0.1f)
+	, bDecodeMessagesOffGameThread(false)
+	, MessageHandlingBudgetMs(2.0f)
+	, OutgoingBytesPerSecondLimit(0)
+	, MaxSceneUpdatesPerSecond(0.0f)
+	, MaxControlUpdatesPerSecond(0.0f)
+	, ControlUpdateBytesPerSecondLimit(0)
+	, ReplyTimeoutSeconds(30.0f)
 {
-
+	ControlPropertyUpdateRules.Add(FMixerControlPropertyUpdateRule(TEXT("progress"), 0.01f, false));
+	ControlPropertyUpdateRules.Add(FMixerControlPropertyUpdateRule(TEXT("disabled"), 0.0f, true));
+	ControlPropertyUpdateRules.Add(FMixerControlPropertyUpdateRule(TEXT("cooldown"), 0.0f, true));
 }
 
 #if WITH_EDITORONLY_DATA
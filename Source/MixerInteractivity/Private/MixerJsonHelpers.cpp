@@ -33,6 +33,7 @@ namespace MixerStringConstants
 		const FString UpdateParticipants = TEXT("updateParticipants");
 		const FString Capture = TEXT("capture");
 		const FString GetScenes = TEXT("getScenes");
+		const FString UpdateControls = TEXT("updateControls");
 	}
 
 	namespace EventTypes
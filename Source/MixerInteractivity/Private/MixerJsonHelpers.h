@@ -38,6 +38,7 @@ namespace MixerStringConstants
 		extern const FString UpdateParticipants;
 		extern const FString Capture;
 		extern const FString GetScenes;
+		extern const FString UpdateControls;
 	}
 
 	namespace EventTypes
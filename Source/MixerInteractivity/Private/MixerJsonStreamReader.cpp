@@ -0,0 +1,696 @@
+//*********************************************************
+//
+// Copyright (c) Microsoft. All rights reserved.
+// THIS CODE IS PROVIDED *AS IS* WITHOUT WARRANTY OF
+// ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING ANY
+// IMPLIED WARRANTIES OF FITNESS FOR A PARTICULAR
+// PURPOSE, MERCHANTABILITY, OR NON-INFRINGEMENT.
+//
+//*********************************************************
+#include "MixerJsonStreamReader.h"
+#include "MixerJsonHelpers.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Misc/Parse.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+
+bool FMixerJsonSpan::Equals(const FString& Other) const
+{
+	if (!IsSet())
+	{
+		return false;
+	}
+
+	if (bHasEscapes)
+	{
+		return ToString() == Other;
+	}
+
+	return Other.Len() == Length && FCString::Strnicmp(Start, *Other, Length) == 0;
+}
+
+FString FMixerJsonSpan::ToString() const
+{
+	if (!IsSet())
+	{
+		return FString();
+	}
+
+	if (!bHasEscapes)
+	{
+		return FString(Length, Start);
+	}
+
+	FString Result;
+	Result.Reserve(Length);
+	const TCHAR* SpanEnd = Start + Length;
+	for (const TCHAR* Char = Start; Char < SpanEnd; ++Char)
+	{
+		if (*Char != TEXT('\\') || Char + 1 >= SpanEnd)
+		{
+			Result.AppendChar(*Char);
+			continue;
+		}
+
+		++Char;
+		switch (*Char)
+		{
+		case TEXT('b'):		Result.AppendChar(TEXT('\b')); break;
+		case TEXT('f'):		Result.AppendChar(TEXT('\f')); break;
+		case TEXT('n'):		Result.AppendChar(TEXT('\n')); break;
+		case TEXT('r'):		Result.AppendChar(TEXT('\r')); break;
+		case TEXT('t'):		Result.AppendChar(TEXT('\t')); break;
+		case TEXT('u'):
+			if (Char + 4 < SpanEnd)
+			{
+				uint32 CodeUnit = 0;
+				for (int32 i = 1; i <= 4; ++i)
+				{
+					CodeUnit = (CodeUnit << 4) | FParse::HexDigit(Char[i]);
+				}
+				Result.AppendChar(static_cast<TCHAR>(CodeUnit));
+				Char += 4;
+			}
+			break;
+		default:
+			// Covers \" \\ and \/
+			Result.AppendChar(*Char);
+			break;
+		}
+	}
+
+	return Result;
+}
+
+bool FMixerJsonSpan::ToInt(int32& OutValue) const
+{
+	if (Kind != EMixerJsonValueKind::Number || Length == 0)
+	{
+		return false;
+	}
+
+	const TCHAR* Char = Start;
+	const TCHAR* SpanEnd = Start + Length;
+	bool bNegative = false;
+	if (*Char == TEXT('-'))
+	{
+		bNegative = true;
+		++Char;
+	}
+
+	int64 Value = 0;
+	for (; Char < SpanEnd && FChar::IsDigit(*Char); ++Char)
+	{
+		Value = Value * 10 + (*Char - TEXT('0'));
+	}
+
+	// Match FJsonObject::TryGetNumberField(int32) which truncates fractional values
+	if (Char < SpanEnd)
+	{
+		double AsDouble;
+		if (!ToDouble(AsDouble))
+		{
+			return false;
+		}
+		OutValue = static_cast<int32>(AsDouble);
+		return true;
+	}
+
+	OutValue = static_cast<int32>(bNegative ? -Value : Value);
+	return true;
+}
+
+bool FMixerJsonSpan::ToDouble(double& OutValue) const
+{
+	if (Kind != EMixerJsonValueKind::Number || Length == 0)
+	{
+		return false;
+	}
+
+	TCHAR Buffer[64];
+	if (Length >= ARRAY_COUNT(Buffer))
+	{
+		OutValue = FCString::Atod(*ToString());
+	}
+	else
+	{
+		FMemory::Memcpy(Buffer, Start, Length * sizeof(TCHAR));
+		Buffer[Length] = 0;
+		OutValue = FCString::Atod(Buffer);
+	}
+	return true;
+}
+
+bool FMixerJsonSpan::ToBool(bool& OutValue) const
+{
+	if (Kind != EMixerJsonValueKind::Boolean)
+	{
+		return false;
+	}
+
+	OutValue = *Start == TEXT('t');
+	return true;
+}
+
+FMixerJsonStreamReader::FMixerJsonStreamReader(const TCHAR* InJson, int32 InLength)
+	: Cursor(InJson)
+	, End(InJson + InLength)
+	, bStarted(false)
+	, bFinished(false)
+	, bError(false)
+{
+}
+
+void FMixerJsonStreamReader::SkipWhitespace()
+{
+	while (Cursor < End && FChar::IsWhitespace(*Cursor))
+	{
+		++Cursor;
+	}
+}
+
+bool FMixerJsonStreamReader::ReadString(FMixerJsonSpan& OutString)
+{
+	check(Cursor < End && *Cursor == TEXT('"'));
+	++Cursor;
+
+	OutString.Start = Cursor;
+	OutString.Kind = EMixerJsonValueKind::String;
+	OutString.bHasEscapes = false;
+	while (Cursor < End)
+	{
+		if (*Cursor == TEXT('\\'))
+		{
+			OutString.bHasEscapes = true;
+			Cursor += 2;
+		}
+		else if (*Cursor == TEXT('"'))
+		{
+			OutString.Length = static_cast<int32>(Cursor - OutString.Start);
+			++Cursor;
+			return true;
+		}
+		else
+		{
+			++Cursor;
+		}
+	}
+
+	return false;
+}
+
+bool FMixerJsonStreamReader::SkipContainer()
+{
+	int32 Depth = 0;
+	while (Cursor < End)
+	{
+		switch (*Cursor)
+		{
+		case TEXT('"'):
+		{
+			FMixerJsonSpan Ignored;
+			if (!ReadString(Ignored))
+			{
+				return false;
+			}
+			continue;
+		}
+
+		case TEXT('{'):
+		case TEXT('['):
+			++Depth;
+			break;
+
+		case TEXT('}'):
+		case TEXT(']'):
+			if (--Depth == 0)
+			{
+				++Cursor;
+				return true;
+			}
+			break;
+
+		default:
+			break;
+		}
+		++Cursor;
+	}
+
+	return false;
+}
+
+bool FMixerJsonStreamReader::ReadValue(FMixerJsonSpan& OutValue)
+{
+	SkipWhitespace();
+	if (Cursor >= End)
+	{
+		return false;
+	}
+
+	const TCHAR* ValueStart = Cursor;
+	switch (*Cursor)
+	{
+	case TEXT('"'):
+		return ReadString(OutValue);
+
+	case TEXT('{'):
+	case TEXT('['):
+		OutValue.Kind = *Cursor == TEXT('{') ? EMixerJsonValueKind::Object : EMixerJsonValueKind::Array;
+		if (!SkipContainer())
+		{
+			return false;
+		}
+		break;
+
+	default:
+		while (Cursor < End && *Cursor != TEXT(',') && *Cursor != TEXT('}') && *Cursor != TEXT(']') && !FChar::IsWhitespace(*Cursor))
+		{
+			++Cursor;
+		}
+
+		switch (*ValueStart)
+		{
+		case TEXT('n'):	OutValue.Kind = EMixerJsonValueKind::Null; break;
+		case TEXT('t'):
+		case TEXT('f'):	OutValue.Kind = EMixerJsonValueKind::Boolean; break;
+		default:		OutValue.Kind = EMixerJsonValueKind::Number; break;
+		}
+		break;
+	}
+
+	OutValue.Start = ValueStart;
+	OutValue.Length = static_cast<int32>(Cursor - ValueStart);
+	OutValue.bHasEscapes = false;
+	return OutValue.Length > 0;
+}
+
+bool FMixerJsonStreamReader::NextField(FMixerJsonSpan& OutKey, FMixerJsonSpan& OutValue)
+{
+	if (bFinished || bError)
+	{
+		return false;
+	}
+
+	SkipWhitespace();
+	if (!bStarted)
+	{
+		if (Cursor >= End || *Cursor != TEXT('{'))
+		{
+			bError = true;
+			return false;
+		}
+		++Cursor;
+		bStarted = true;
+		SkipWhitespace();
+	}
+	else if (Cursor < End && *Cursor == TEXT(','))
+	{
+		++Cursor;
+		SkipWhitespace();
+	}
+
+	if (Cursor < End && *Cursor == TEXT('}'))
+	{
+		++Cursor;
+		bFinished = true;
+		return false;
+	}
+
+	if (Cursor >= End || *Cursor != TEXT('"') || !ReadString(OutKey))
+	{
+		bError = true;
+		return false;
+	}
+
+	SkipWhitespace();
+	if (Cursor >= End || *Cursor != TEXT(':'))
+	{
+		bError = true;
+		return false;
+	}
+	++Cursor;
+
+	if (!ReadValue(OutValue))
+	{
+		bError = true;
+		return false;
+	}
+
+	SkipWhitespace();
+	return true;
+}
+
+bool FMixerJsonStreamReader::NextElement(FMixerJsonSpan& OutValue)
+{
+	if (bFinished || bError)
+	{
+		return false;
+	}
+
+	SkipWhitespace();
+	if (!bStarted)
+	{
+		if (Cursor >= End || *Cursor != TEXT('['))
+		{
+			bError = true;
+			return false;
+		}
+		++Cursor;
+		bStarted = true;
+		SkipWhitespace();
+	}
+	else if (Cursor < End && *Cursor == TEXT(','))
+	{
+		++Cursor;
+		SkipWhitespace();
+	}
+
+	if (Cursor < End && *Cursor == TEXT(']'))
+	{
+		++Cursor;
+		bFinished = true;
+		return false;
+	}
+
+	if (!ReadValue(OutValue))
+	{
+		bError = true;
+		return false;
+	}
+
+	SkipWhitespace();
+	return true;
+}
+
+bool FMixerJsonMessageEnvelope::Scan(const FString& Message, const FString& SubtypeName, const FString& ParamsName, FMixerJsonMessageEnvelope& OutEnvelope)
+{
+	FMixerJsonStreamReader Reader(*Message, Message.Len());
+	FMixerJsonSpan Key;
+	FMixerJsonSpan Value;
+	while (Reader.NextField(Key, Value))
+	{
+		if (Key.Equals(MixerStringConstants::FieldNames::Type))
+		{
+			OutEnvelope.Type = Value;
+		}
+		else if (Key.Equals(MixerStringConstants::FieldNames::Id))
+		{
+			OutEnvelope.Id = Value;
+		}
+		else if (Key.Equals(SubtypeName))
+		{
+			OutEnvelope.Subtype = Value;
+		}
+		else if (Key.Equals(ParamsName))
+		{
+			OutEnvelope.Params = Value;
+		}
+	}
+
+	return !Reader.HasError() && OutEnvelope.Type.Kind == EMixerJsonValueKind::String;
+}
+
+FMixerJsonMessageView::FMixerJsonMessageView()
+	: bMaterializeAttempted(false)
+{
+}
+
+FMixerJsonMessageView::FMixerJsonMessageView(const FMixerJsonSpan& InSpan)
+	: Span(InSpan)
+	, bMaterializeAttempted(false)
+{
+}
+
+FMixerJsonMessageView::FMixerJsonMessageView(TSharedPtr<FJsonObject> InMaterialized)
+	: Materialized(InMaterialized)
+	, bMaterializeAttempted(true)
+{
+}
+
+bool FMixerJsonMessageView::IsNull() const
+{
+	return bMaterializeAttempted ? !Materialized.IsValid() : Span.Kind != EMixerJsonValueKind::Object;
+}
+
+FJsonObject* FMixerJsonMessageView::GetObject()
+{
+	return GetSharedObject().Get();
+}
+
+TSharedPtr<FJsonObject> FMixerJsonMessageView::GetSharedObject()
+{
+	if (!bMaterializeAttempted)
+	{
+		bMaterializeAttempted = true;
+		if (Span.Kind == EMixerJsonValueKind::Object)
+		{
+			TSharedRef<TJsonReader<>> JsonReader = TJsonReaderFactory<>::Create(FString(Span.Length, Span.Start));
+			FJsonSerializer::Deserialize(JsonReader, Materialized);
+		}
+	}
+
+	return Materialized;
+}
+
+bool FMixerJsonMessageView::FindRawField(const FString& FieldName, FMixerJsonSpan& OutValue) const
+{
+	if (Span.Kind != EMixerJsonValueKind::Object)
+	{
+		return false;
+	}
+
+	FMixerJsonStreamReader Reader(Span.Start, Span.Length);
+	FMixerJsonSpan Key;
+	while (Reader.NextField(Key, OutValue))
+	{
+		if (Key.Equals(FieldName))
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+bool FMixerJsonMessageView::TryGetStringField(const FString& FieldName, FString& OutValue) const
+{
+	if (bMaterializeAttempted)
+	{
+		return Materialized.IsValid() && Materialized->TryGetStringField(FieldName, OutValue);
+	}
+
+	FMixerJsonSpan Value;
+	if (!FindRawField(FieldName, Value) || Value.Kind != EMixerJsonValueKind::String)
+	{
+		return false;
+	}
+
+	OutValue = Value.ToString();
+	return true;
+}
+
+bool FMixerJsonMessageView::TryGetNumberField(const FString& FieldName, int32& OutValue) const
+{
+	if (bMaterializeAttempted)
+	{
+		return Materialized.IsValid() && Materialized->TryGetNumberField(FieldName, OutValue);
+	}
+
+	FMixerJsonSpan Value;
+	return FindRawField(FieldName, Value) && Value.ToInt(OutValue);
+}
+
+bool FMixerJsonMessageView::TryGetNumberField(const FString& FieldName, double& OutValue) const
+{
+	if (bMaterializeAttempted)
+	{
+		return Materialized.IsValid() && Materialized->TryGetNumberField(FieldName, OutValue);
+	}
+
+	FMixerJsonSpan Value;
+	return FindRawField(FieldName, Value) && Value.ToDouble(OutValue);
+}
+
+bool FMixerJsonMessageView::TryGetBoolField(const FString& FieldName, bool& OutValue) const
+{
+	if (bMaterializeAttempted)
+	{
+		return Materialized.IsValid() && Materialized->TryGetBoolField(FieldName, OutValue);
+	}
+
+	FMixerJsonSpan Value;
+	return FindRawField(FieldName, Value) && Value.ToBool(OutValue);
+}
+
+bool FMixerJsonMessageView::TryGetObjectField(const FString& FieldName, const TSharedPtr<FJsonObject>*& OutValue)
+{
+	FJsonObject* Object = GetObject();
+	return Object != nullptr && Object->TryGetObjectField(FieldName, OutValue);
+}
+
+bool FMixerJsonMessageView::TryGetArrayField(const FString& FieldName, const TArray<TSharedPtr<FJsonValue>>*& OutValue)
+{
+	FJsonObject* Object = GetObject();
+	return Object != nullptr && Object->TryGetArrayField(FieldName, OutValue);
+}
+
+bool FMixerJsonMessageView::TryGetStringSpan(const FString& FieldName, FMixerJsonSpan& OutValue, FString& Scratch) const
+{
+	if (bMaterializeAttempted)
+	{
+		if (!Materialized.IsValid() || !Materialized->TryGetStringField(FieldName, Scratch))
+		{
+			return false;
+		}
+
+		OutValue = FMixerJsonSpan::FromString(Scratch);
+		return true;
+	}
+
+	if (!FindRawField(FieldName, OutValue) || OutValue.Kind != EMixerJsonValueKind::String)
+	{
+		return false;
+	}
+
+	if (OutValue.bHasEscapes)
+	{
+		Scratch = OutValue.ToString();
+		OutValue = FMixerJsonSpan::FromString(Scratch);
+	}
+	return true;
+}
+
+bool FMixerJsonMessageView::TryGetObjectView(const FString& FieldName, FMixerJsonMessageView& OutView) const
+{
+	if (bMaterializeAttempted)
+	{
+		const TSharedPtr<FJsonObject>* Object;
+		if (!Materialized.IsValid() || !Materialized->TryGetObjectField(FieldName, Object))
+		{
+			return false;
+		}
+
+		OutView = FMixerJsonMessageView(*Object);
+		return true;
+	}
+
+	FMixerJsonSpan Value;
+	if (!FindRawField(FieldName, Value) || Value.Kind != EMixerJsonValueKind::Object)
+	{
+		return false;
+	}
+
+	OutView = FMixerJsonMessageView(Value);
+	return true;
+}
+
+bool FMixerJsonMessageView::VisitObjectArrayField(const FString& FieldName, TFunctionRef<void(FMixerJsonMessageView&)> Visitor) const
+{
+	if (bMaterializeAttempted)
+	{
+		const TArray<TSharedPtr<FJsonValue>>* Elements;
+		if (!Materialized.IsValid() || !Materialized->TryGetArrayField(FieldName, Elements))
+		{
+			return false;
+		}
+
+		for (const TSharedPtr<FJsonValue>& Element : *Elements)
+		{
+			const TSharedPtr<FJsonObject>* Object;
+			if (Element.IsValid() && Element->TryGetObject(Object))
+			{
+				FMixerJsonMessageView ElementView(*Object);
+				Visitor(ElementView);
+			}
+		}
+		return true;
+	}
+
+	FMixerJsonSpan Value;
+	if (!FindRawField(FieldName, Value) || Value.Kind != EMixerJsonValueKind::Array)
+	{
+		return false;
+	}
+
+	FMixerJsonStreamReader Reader(Value.Start, Value.Length);
+	FMixerJsonSpan Element;
+	while (Reader.NextElement(Element))
+	{
+		if (Element.Kind == EMixerJsonValueKind::Object)
+		{
+			FMixerJsonMessageView ElementView(Element);
+			Visitor(ElementView);
+		}
+	}
+	return !Reader.HasError();
+}
+
+#if !UE_BUILD_SHIPPING
+
+namespace
+{
+	/**
+	* Game thread cost of a giveInput message once the decode worker has located its params:
+	* building the params tree (what an FJsonObject handler costs) against reading the same
+	* fields through a view.
+	*/
+	void BenchmarkInputDecode(const TArray<FString>& Args)
+	{
+		const int32 Iterations = Args.Num() > 0 ? FMath::Max(FCString::Atoi(*Args[0]), 1) : 100000;
+
+		const FString Params = TEXT("{\"participantID\":\"3f0e6c2a-5b1d-4c8e-9a7f-0d2b4e6f8a1c\",\"input\":{\"controlID\":\"jump\",\"event\":\"mousedown\",\"button\":0},\"transactionID\":\"\"}");
+
+		int64 TreeChecksum = 0;
+		const double TreeStart = FPlatformTime::Seconds();
+		for (int32 i = 0; i < Iterations; ++i)
+		{
+			TSharedPtr<FJsonObject> ParamsObj;
+			TSharedRef<TJsonReader<>> JsonReader = TJsonReaderFactory<>::Create(Params);
+			if (FJsonSerializer::Deserialize(JsonReader, ParamsObj) && ParamsObj.IsValid())
+			{
+				const TSharedPtr<FJsonObject>* InputObj;
+				if (ParamsObj->TryGetObjectField(MixerStringConstants::FieldNames::Input, InputObj))
+				{
+					TreeChecksum += ParamsObj->GetStringField(MixerStringConstants::FieldNames::ParticipantId).Len();
+					TreeChecksum += (*InputObj)->GetStringField(MixerStringConstants::FieldNames::ControlId).Len();
+					TreeChecksum += (*InputObj)->GetStringField(MixerStringConstants::FieldNames::Event).Len();
+				}
+			}
+		}
+		const double TreeSeconds = FPlatformTime::Seconds() - TreeStart;
+
+		FMixerJsonSpan ParamsSpan = FMixerJsonSpan::FromString(Params);
+		ParamsSpan.Kind = EMixerJsonValueKind::Object;
+		int64 ViewChecksum = 0;
+		const double ViewStart = FPlatformTime::Seconds();
+		for (int32 i = 0; i < Iterations; ++i)
+		{
+			FMixerJsonMessageView ParamsView(ParamsSpan);
+			FMixerJsonMessageView InputView;
+			FString Scratch;
+			FMixerJsonSpan Field;
+			if (ParamsView.TryGetObjectView(MixerStringConstants::FieldNames::Input, InputView))
+			{
+				ViewChecksum += ParamsView.TryGetStringSpan(MixerStringConstants::FieldNames::ParticipantId, Field, Scratch) ? Field.Length : 0;
+				ViewChecksum += InputView.TryGetStringSpan(MixerStringConstants::FieldNames::ControlId, Field, Scratch) ? Field.Length : 0;
+				ViewChecksum += InputView.TryGetStringSpan(MixerStringConstants::FieldNames::Event, Field, Scratch) ? Field.Length : 0;
+			}
+		}
+		const double ViewSeconds = FPlatformTime::Seconds() - ViewStart;
+
+		UE_LOG(LogMixerInteractivity, Display, TEXT("Input decode x%d: params tree %.2fms (%.1fus/input), view %.2fms (%.1fus/input), speedup %.1fx%s"),
+			Iterations,
+			TreeSeconds * 1000.0, TreeSeconds * 1.0e6 / Iterations,
+			ViewSeconds * 1000.0, ViewSeconds * 1.0e6 / Iterations,
+			ViewSeconds > 0.0 ? TreeSeconds / ViewSeconds : 0.0,
+			TreeChecksum == ViewChecksum ? TEXT("") : TEXT(" (RESULTS DIFFER)"));
+	}
+
+	FAutoConsoleCommand BenchmarkInputDecodeCommand(
+		TEXT("Mixer.BenchmarkInputDecode"),
+		TEXT("Time the game thread's share of handling a giveInput message through a view against building its params tree.  Optional argument: iteration count."),
+		FConsoleCommandWithArgsDelegate::CreateStatic(&BenchmarkInputDecode));
+}
+
+#endif
@@ -0,0 +1,166 @@
+//*********************************************************
+//
+// Copyright (c) Microsoft. All rights reserved.
+// THIS CODE IS PROVIDED *AS IS* WITHOUT WARRANTY OF
+// ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING ANY
+// IMPLIED WARRANTIES OF FITNESS FOR A PARTICULAR
+// PURPOSE, MERCHANTABILITY, OR NON-INFRINGEMENT.
+//
+//*********************************************************
+#pragma once
+
+#include "Containers/UnrealString.h"
+#include "Dom/JsonValue.h"
+#include "Dom/JsonObject.h"
+#include "Templates/Function.h"
+
+enum class EMixerJsonValueKind : uint8
+{
+	None,
+	Null,
+	String,
+	Number,
+	Boolean,
+	Object,
+	Array,
+};
+
+/**
+* A run of characters inside a raw message, referenced without copying.
+* For strings the span excludes the surrounding quotes.
+*/
+struct FMixerJsonSpan
+{
+public:
+	FMixerJsonSpan()
+		: Start(nullptr)
+		, Length(0)
+		, Kind(EMixerJsonValueKind::None)
+		, bHasEscapes(false)
+	{
+	}
+
+	/** Span covering the whole of String, which must outlive it. */
+	static FMixerJsonSpan FromString(const FString& String)
+	{
+		FMixerJsonSpan Span;
+		Span.Start = *String;
+		Span.Length = String.Len();
+		Span.Kind = EMixerJsonValueKind::String;
+		return Span;
+	}
+
+	bool IsSet() const { return Start != nullptr; }
+
+	/** Compare against an unescaped string using the same (case-insensitive) rules as FString::operator== */
+	bool Equals(const FString& Other) const;
+
+	/** Copy the contents out, resolving escape sequences for strings. */
+	FString ToString() const;
+
+	bool ToInt(int32& OutValue) const;
+	bool ToDouble(double& OutValue) const;
+	bool ToBool(bool& OutValue) const;
+
+public:
+	const TCHAR* Start;
+	int32 Length;
+	EMixerJsonValueKind Kind;
+	bool bHasEscapes;
+};
+
+/**
+* Forward-only reader over the top level of a JSON object or array.  Nested objects
+* and arrays are skipped rather than parsed so that routing information can be
+* pulled out of a message without building an FJsonObject tree.
+*/
+class FMixerJsonStreamReader
+{
+public:
+	FMixerJsonStreamReader(const TCHAR* InJson, int32 InLength);
+
+	/** Read the next key/value pair of the top level object.  Returns false at the end of the object or on malformed input. */
+	bool NextField(FMixerJsonSpan& OutKey, FMixerJsonSpan& OutValue);
+
+	/** Read the next element of the top level array.  Returns false at the end of the array or on malformed input. */
+	bool NextElement(FMixerJsonSpan& OutValue);
+
+	bool HasError() const { return bError; }
+
+private:
+	void SkipWhitespace();
+	bool ReadString(FMixerJsonSpan& OutString);
+	bool ReadValue(FMixerJsonSpan& OutValue);
+	bool SkipContainer();
+
+	const TCHAR* Cursor;
+	const TCHAR* End;
+	bool bStarted;
+	bool bFinished;
+	bool bError;
+};
+
+/** Fields needed to route a websocket message, pulled from the top level of the payload in a single pass. */
+struct FMixerJsonMessageEnvelope
+{
+public:
+	FMixerJsonSpan Type;
+	FMixerJsonSpan Id;
+	FMixerJsonSpan Subtype;
+	FMixerJsonSpan Params;
+
+public:
+	static bool Scan(const FString& Message, const FString& SubtypeName, const FString& ParamsName, FMixerJsonMessageEnvelope& OutEnvelope);
+};
+
+/**
+* Read-only view of a message (or an object nested in one) that defers building
+* an FJsonObject until a handler actually asks for it.  Top level scalar fields
+* are read straight from the raw text.  Exposes the same TryGet*Field signatures
+* as FJsonObject so the GET_JSON_*_RETURN_FAILURE macros work against it.
+*
+* Views reference the raw message text and are only valid for the duration of
+* the handler call they are passed to.
+*/
+class FMixerJsonMessageView
+{
+public:
+	FMixerJsonMessageView();
+	explicit FMixerJsonMessageView(const FMixerJsonSpan& InSpan);
+	explicit FMixerJsonMessageView(TSharedPtr<FJsonObject> InMaterialized);
+
+	bool IsNull() const;
+
+	/** Build (once) and return the full object.  May return nullptr for null or malformed payloads. */
+	FJsonObject* GetObject();
+	TSharedPtr<FJsonObject> GetSharedObject();
+
+	bool TryGetStringField(const FString& FieldName, FString& OutValue) const;
+	bool TryGetNumberField(const FString& FieldName, int32& OutValue) const;
+	bool TryGetNumberField(const FString& FieldName, double& OutValue) const;
+	bool TryGetBoolField(const FString& FieldName, bool& OutValue) const;
+
+	/**
+	* Read a string field without copying it out of the raw message where possible.  The
+	* text goes in Scratch instead if it has escapes or the view is already materialized,
+	* so Scratch must outlive the span.  The span never has escapes.
+	*/
+	bool TryGetStringSpan(const FString& FieldName, FMixerJsonSpan& OutValue, FString& Scratch) const;
+
+	/** View of a nested object that leaves this one unmaterialized.  Valid for as long as this view is. */
+	bool TryGetObjectView(const FString& FieldName, FMixerJsonMessageView& OutView) const;
+
+	/** Call Visitor with a view of each object in an array field.  Elements that aren't objects are skipped. */
+	bool VisitObjectArrayField(const FString& FieldName, TFunctionRef<void(FMixerJsonMessageView&)> Visitor) const;
+
+	/** Nested values are only available after materialization. */
+	bool TryGetObjectField(const FString& FieldName, const TSharedPtr<FJsonObject>*& OutValue);
+	bool TryGetArrayField(const FString& FieldName, const TArray<TSharedPtr<FJsonValue>>*& OutValue);
+
+private:
+	bool FindRawField(const FString& FieldName, FMixerJsonSpan& OutValue) const;
+
+	FMixerJsonSpan Span;
+	TSharedPtr<FJsonObject> Materialized;
+	bool bMaterializeAttempted;
+};
@@ -0,0 +1,160 @@
+//*********************************************************
+//
+// Copyright (c) Microsoft. All rights reserved.
+// THIS CODE IS PROVIDED *AS IS* WITHOUT WARRANTY OF
+// ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING ANY
+// IMPLIED WARRANTIES OF FITNESS FOR A PARTICULAR
+// PURPOSE, MERCHANTABILITY, OR NON-INFRINGEMENT.
+//
+//*********************************************************
+#include "MixerJsonWriter.h"
+#include "Containers/StringConv.h"
+
+void FMixerJsonUtf8Writer::WriteKey(const FString& Name)
+{
+	WriteString(*Name, Name.Len());
+	Buffer.Add(':');
+	bNeedsComma = false;
+}
+
+void FMixerJsonUtf8Writer::WriteValue(bool bValue)
+{
+	BeginValue();
+	if (bValue)
+	{
+		Buffer.Append("true", 4);
+	}
+	else
+	{
+		Buffer.Append("false", 5);
+	}
+}
+
+void FMixerJsonUtf8Writer::WriteValue(int32 Value)
+{
+	WriteValue(static_cast<int64>(Value));
+}
+
+void FMixerJsonUtf8Writer::WriteValue(int64 Value)
+{
+	BeginValue();
+
+	ANSICHAR Digits[24];
+	int32 NumDigits = 0;
+	uint64 Magnitude = Value < 0 ? static_cast<uint64>(-(Value + 1)) + 1 : static_cast<uint64>(Value);
+	do
+	{
+		Digits[NumDigits++] = static_cast<ANSICHAR>('0' + Magnitude % 10);
+		Magnitude /= 10;
+	} while (Magnitude != 0);
+
+	if (Value < 0)
+	{
+		Buffer.Add('-');
+	}
+
+	while (NumDigits > 0)
+	{
+		Buffer.Add(Digits[--NumDigits]);
+	}
+}
+
+void FMixerJsonUtf8Writer::WriteValue(double Value)
+{
+	// JSON has no representation for NaN or infinity, and the service rejects the whole message if it sees one
+	// (FMath::IsFinite only takes floats; x - x is NaN exactly when x is NaN or infinite)
+	if (!(Value - Value == 0.0))
+	{
+		WriteNull();
+		return;
+	}
+
+	// Whole numbers are by far the most common case and don't need printf
+	if (Value == FMath::FloorToDouble(Value) && FMath::Abs(Value) < static_cast<double>(MAX_int64))
+	{
+		WriteValue(static_cast<int64>(Value));
+		return;
+	}
+
+	BeginValue();
+	ANSICHAR Formatted[32];
+	const int32 Length = FCStringAnsi::Snprintf(Formatted, ARRAY_COUNT(Formatted), "%.17g", Value);
+	Buffer.Append(Formatted, FMath::Clamp(Length, 0, static_cast<int32>(ARRAY_COUNT(Formatted)) - 1));
+}
+
+void FMixerJsonUtf8Writer::WriteRawValue(const FString& Json)
+{
+	BeginValue();
+	FTCHARToUTF8 Converted(*Json, Json.Len());
+	Buffer.Append(reinterpret_cast<const ANSICHAR*>(Converted.Get()), Converted.Length());
+}
+
+void FMixerJsonUtf8Writer::WriteString(const TCHAR* Chars, int32 Length)
+{
+	static const ANSICHAR HexDigits[] = "0123456789abcdef";
+
+	BeginValue();
+	Buffer.Reserve(Buffer.Num() + Length + 2);
+	Buffer.Add('"');
+	for (int32 i = 0; i < Length; ++i)
+	{
+		uint32 CodePoint = static_cast<uint32>(Chars[i]);
+		if (CodePoint < 0x80)
+		{
+			switch (CodePoint)
+			{
+			case '"':	Buffer.Append("\\\"", 2); break;
+			case '\\':	Buffer.Append("\\\\", 2); break;
+			case '\b':	Buffer.Append("\\b", 2); break;
+			case '\f':	Buffer.Append("\\f", 2); break;
+			case '\n':	Buffer.Append("\\n", 2); break;
+			case '\r':	Buffer.Append("\\r", 2); break;
+			case '\t':	Buffer.Append("\\t", 2); break;
+			default:
+				if (CodePoint < 0x20)
+				{
+					Buffer.Append("\\u00", 4);
+					Buffer.Add(HexDigits[CodePoint >> 4]);
+					Buffer.Add(HexDigits[CodePoint & 0xF]);
+				}
+				else
+				{
+					Buffer.Add(static_cast<ANSICHAR>(CodePoint));
+				}
+				break;
+			}
+			continue;
+		}
+
+		// Recombine UTF-16 surrogate pairs (no-op where TCHAR is 32 bits wide)
+		if (CodePoint >= 0xD800 && CodePoint <= 0xDBFF && i + 1 < Length)
+		{
+			const uint32 LowSurrogate = static_cast<uint32>(Chars[i + 1]);
+			if (LowSurrogate >= 0xDC00 && LowSurrogate <= 0xDFFF)
+			{
+				CodePoint = 0x10000 + ((CodePoint - 0xD800) << 10) + (LowSurrogate - 0xDC00);
+				++i;
+			}
+		}
+
+		if (CodePoint < 0x800)
+		{
+			Buffer.Add(static_cast<ANSICHAR>(0xC0 | (CodePoint >> 6)));
+			Buffer.Add(static_cast<ANSICHAR>(0x80 | (CodePoint & 0x3F)));
+		}
+		else if (CodePoint < 0x10000)
+		{
+			Buffer.Add(static_cast<ANSICHAR>(0xE0 | (CodePoint >> 12)));
+			Buffer.Add(static_cast<ANSICHAR>(0x80 | ((CodePoint >> 6) & 0x3F)));
+			Buffer.Add(static_cast<ANSICHAR>(0x80 | (CodePoint & 0x3F)));
+		}
+		else
+		{
+			Buffer.Add(static_cast<ANSICHAR>(0xF0 | (CodePoint >> 18)));
+			Buffer.Add(static_cast<ANSICHAR>(0x80 | ((CodePoint >> 12) & 0x3F)));
+			Buffer.Add(static_cast<ANSICHAR>(0x80 | ((CodePoint >> 6) & 0x3F)));
+			Buffer.Add(static_cast<ANSICHAR>(0x80 | (CodePoint & 0x3F)));
+		}
+	}
+	Buffer.Add('"');
+}
@@ -0,0 +1,146 @@
+//*********************************************************
+//
+// Copyright (c) Microsoft. All rights reserved.
+// THIS CODE IS PROVIDED *AS IS* WITHOUT WARRANTY OF
+// ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING ANY
+// IMPLIED WARRANTIES OF FITNESS FOR A PARTICULAR
+// PURPOSE, MERCHANTABILITY, OR NON-INFRINGEMENT.
+//
+//*********************************************************
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+* Condensed JSON writer that appends UTF-8 straight into a caller owned byte
+* buffer, ready to hand to IWebSocket::Send without another conversion.
+*
+* Structs opt in by providing a non-virtual
+*
+*	template <class WriterType> void WriteJsonFields(WriterType& Writer) const
+*
+* that calls WriteField once per member with a string literal name.  Field
+* names are then emitted with a single memcpy of a compile-time length, and
+* nested structs and arrays of structs resolve statically rather than through
+* FJsonSerializable::Serialize.
+*/
+class FMixerJsonUtf8Writer
+{
+public:
+	explicit FMixerJsonUtf8Writer(TArray<ANSICHAR>& InBuffer)
+		: Buffer(InBuffer)
+		, bNeedsComma(false)
+	{
+	}
+
+	void BeginObject()
+	{
+		BeginValue();
+		Buffer.Add('{');
+		bNeedsComma = false;
+	}
+
+	void EndObject()
+	{
+		Buffer.Add('}');
+		bNeedsComma = true;
+	}
+
+	void BeginArray()
+	{
+		BeginValue();
+		Buffer.Add('[');
+		bNeedsComma = false;
+	}
+
+	void EndArray()
+	{
+		Buffer.Add(']');
+		bNeedsComma = true;
+	}
+
+	/** Field names are assumed to be plain ASCII that needs no escaping. */
+	template <int32 NameLength>
+	void WriteKey(const ANSICHAR (&Name)[NameLength])
+	{
+		BeginValue();
+		Buffer.Add('"');
+		Buffer.Append(Name, NameLength - 1);
+		Buffer.Add('"');
+		Buffer.Add(':');
+		bNeedsComma = false;
+	}
+
+	void WriteKey(const FString& Name);
+
+	template <int32 NameLength, typename ValueType>
+	void WriteField(const ANSICHAR (&Name)[NameLength], const ValueType& Value)
+	{
+		WriteKey(Name);
+		WriteValue(Value);
+	}
+
+	template <typename ValueType>
+	void WriteField(const FString& Name, const ValueType& Value)
+	{
+		WriteKey(Name);
+		WriteValue(Value);
+	}
+
+	void WriteNull()
+	{
+		BeginValue();
+		Buffer.Append("null", 4);
+	}
+
+	void WriteValue(bool bValue);
+	void WriteValue(int32 Value);
+	void WriteValue(int64 Value);
+	void WriteValue(float Value) { WriteValue(static_cast<double>(Value)); }
+	/** NaN and infinities have no JSON representation and are written as null. */
+	void WriteValue(double Value);
+	void WriteValue(const FString& Value) { WriteString(*Value, Value.Len()); }
+	void WriteValue(const TCHAR* Value) { WriteString(Value, FCString::Strlen(Value)); }
+
+	template <typename ElementType>
+	void WriteValue(const TArray<ElementType>& Values)
+	{
+		BeginArray();
+		for (const ElementType& Value : Values)
+		{
+			WriteValue(Value);
+		}
+		EndArray();
+	}
+
+	template <typename StructType>
+	void WriteValue(const StructType& Struct)
+	{
+		BeginObject();
+		Struct.WriteJsonFields(*this);
+		EndObject();
+	}
+
+	/** Embed a value that has already been serialized to JSON by other means. */
+	void WriteRawValue(const FString& Json);
+	void WriteRawValue(const ANSICHAR* Utf8Json, int32 Length)
+	{
+		BeginValue();
+		Buffer.Append(Utf8Json, Length);
+	}
+
+private:
+	void BeginValue()
+	{
+		if (bNeedsComma)
+		{
+			Buffer.Add(',');
+		}
+		bNeedsComma = true;
+	}
+
+	void WriteString(const TCHAR* Chars, int32 Length);
+
+	TArray<ANSICHAR>& Buffer;
+	bool bNeedsComma;
+};
@@ -0,0 +1,1140 @@
+//*********************************************************
+//
+// Copyright (c) Microsoft. All rights reserved.
+// THIS CODE IS PROVIDED *AS IS* WITHOUT WARRANTY OF
+// ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING ANY
+// IMPLIED WARRANTIES OF FITNESS FOR A PARTICULAR
+// PURPOSE, MERCHANTABILITY, OR NON-INFRINGEMENT.
+//
+//*********************************************************
+#include "MixerLoopbackWebSocket.h"
+
+#if MIXER_WITH_LOOPBACK_SERVICE
+
+#include "MixerInteractivityLog.h"
+#include "MixerInteractivitySettings.h"
+#include "MixerInteractivityProjectAsset.h"
+#include "MixerInteractivityJsonTypes.h"
+#include "MixerJsonHelpers.h"
+#include "MixerJsonWriter.h"
+#include "MixerTrafficCapture.h"
+#include "Containers/StringConv.h"
+#include "Dom/JsonObject.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/DateTime.h"
+#include "Misc/Paths.h"
+#include "Policies/CondensedJsonPrintPolicy.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+
+static TAutoConsoleVariable<int32> CVarLoopbackParticipants(
+	TEXT("mixer.Loopback.Participants"),
+	10,
+	TEXT("Number of simulated viewers connected to loopback://interactive and chatting on loopback://chat."));
+
+static TAutoConsoleVariable<float> CVarLoopbackInputsPerSecond(
+	TEXT("mixer.Loopback.InputsPerSecond"),
+	20.0f,
+	TEXT("giveInput messages per second sent by loopback://interactive once the game is ready."));
+
+static TAutoConsoleVariable<float> CVarLoopbackChatMessagesPerSecond(
+	TEXT("mixer.Loopback.ChatMessagesPerSecond"),
+	1.0f,
+	TEXT("Chat messages (or poll votes, while a poll is running) per second sent by loopback://chat."));
+
+static TAutoConsoleVariable<int32> CVarLoopbackButtons(
+	TEXT("mixer.Loopback.Buttons"),
+	4,
+	TEXT("Buttons in the scene served by loopback://interactive when the project definition isn't available.  Odd numbered buttons cost a spark."));
+
+static TAutoConsoleVariable<int32> CVarLoopbackJoysticks(
+	TEXT("mixer.Loopback.Joysticks"),
+	1,
+	TEXT("Joysticks in the scene served by loopback://interactive when the project definition isn't available."));
+
+static TAutoConsoleVariable<float> CVarLoopbackLatencyMs(
+	TEXT("mixer.Loopback.LatencyMs"),
+	0.0f,
+	TEXT("Delay in milliseconds applied to every message sent by the simulated services."));
+
+static TAutoConsoleVariable<int32> CVarLoopbackEchoControlUpdates(
+	TEXT("mixer.Loopback.EchoControlUpdates"),
+	0,
+	TEXT("If non-zero loopback://interactive follows each updateControls with an onControlUpdate for the same controls."));
+
+static TAutoConsoleVariable<float> CVarLoopbackReportInterval(
+	TEXT("mixer.Loopback.ReportInterval"),
+	10.0f,
+	TEXT("Seconds between throughput reports from the simulated services.  0 disables them."));
+
+static TAutoConsoleVariable<float> CVarReplaySpeed(
+	TEXT("mixer.Replay.Speed"),
+	1.0f,
+	TEXT("Playback rate for replay:// endpoints.  1 reproduces the captured timing, 0 replays as fast as the client keeps up."));
+
+static TAutoConsoleVariable<float> CVarReplaySyncTimeout(
+	TEXT("mixer.Replay.SyncTimeout"),
+	2.0f,
+	TEXT("When replaying as fast as possible, seconds to wait for the client to send what it sent at the same point in the capture."));
+
+namespace
+{
+	const TCHAR* const LoopbackScheme = TEXT("loopback://");
+	const TCHAR* const ReplayScheme = TEXT("replay://");
+	const TCHAR* const DefaultSceneAndGroup = TEXT("default");
+	const int32 FirstViewerUserId = 1000;
+
+	/** Large audiences join in several messages, as they do on the real service. */
+	const int32 MaxParticipantsPerMessage = 100;
+
+	int64 GetUnixTimeMs()
+	{
+		const FTimespan SinceEpoch = FDateTime::UtcNow() - FDateTime(1970, 1, 1);
+		return static_cast<int64>(SinceEpoch.GetTotalMilliseconds());
+	}
+
+	FString MakeGuidString()
+	{
+		return FGuid::NewGuid().ToString(EGuidFormats::DigitsWithHyphens);
+	}
+
+	FString GetViewerName(int32 UserId)
+	{
+		return FString::Printf(TEXT("Viewer%d"), UserId - FirstViewerUserId);
+	}
+}
+
+/**
+* Protocol independent part of a simulated service: parses what the client sends,
+* frames what goes back and holds it until the simulated latency has passed.
+*/
+class FMixerLoopbackService
+{
+public:
+	FMixerLoopbackService(const FString& InName, const FString& InServerMessageType, const FString& InNameField, const FString& InPayloadField, const FString& InResultField)
+		: Name(InName)
+		, ServerMessageType(InServerMessageType)
+		, NameField(InNameField)
+		, PayloadField(InPayloadField)
+		, ResultField(InResultField)
+		, OutboxHead(0)
+		, ReportTimer(0.0f)
+		, MessagesReceived(0)
+		, BytesReceived(0)
+		, MessagesSent(0)
+		, BytesSent(0)
+	{
+	}
+
+	virtual ~FMixerLoopbackService() {}
+
+	/** The client's socket has just opened. */
+	void Connect()
+	{
+		Outbox.Reset();
+		OutboxHead = 0;
+		HandleConnected();
+	}
+
+	void ReceiveFromClient(const FString& MessageText, int32 NumBytes)
+	{
+		++MessagesReceived;
+		BytesReceived += NumBytes;
+		HandleClientMessage(MessageText);
+	}
+
+	void Tick(float DeltaTime)
+	{
+		TickSimulation(DeltaTime);
+
+		const float ReportInterval = CVarLoopbackReportInterval.GetValueOnGameThread();
+		ReportTimer += DeltaTime;
+		if (ReportInterval <= 0.0f || ReportTimer >= ReportInterval)
+		{
+			UE_CLOG(ReportInterval > 0.0f, LogMixerInteractivity, Log, TEXT("%s received %.1f msg/s (%.1f KB/s), sent %.1f msg/s (%.1f KB/s)"),
+				*Name,
+				MessagesReceived / ReportTimer, BytesReceived / (1024.0f * ReportTimer),
+				MessagesSent / ReportTimer, BytesSent / (1024.0f * ReportTimer));
+
+			ReportTimer = 0.0f;
+			MessagesReceived = 0;
+			BytesReceived = 0;
+			MessagesSent = 0;
+			BytesSent = 0;
+		}
+	}
+
+	/** Hands over the next message for the client, once its simulated latency has passed. */
+	bool PopDeliverable(FString& OutMessage)
+	{
+		if (OutboxHead >= Outbox.Num() || Outbox[OutboxHead].DeliverAt > FPlatformTime::Seconds())
+		{
+			return false;
+		}
+
+		OutMessage = MoveTemp(Outbox[OutboxHead].Text);
+		++OutboxHead;
+		if (OutboxHead == Outbox.Num())
+		{
+			Outbox.Reset();
+			OutboxHead = 0;
+		}
+		else if (OutboxHead >= 1024 && OutboxHead * 2 >= Outbox.Num())
+		{
+			// With simulated latency the outbox may never run dry, so periodically drop delivered entries
+			Outbox.RemoveAt(0, OutboxHead, false);
+			OutboxHead = 0;
+		}
+		return true;
+	}
+
+protected:
+	virtual void HandleConnected() = 0;
+	virtual void HandleMethod(const FString& Method, int32 Id, const FJsonObject& Message) {}
+	virtual void TickSimulation(float DeltaTime) = 0;
+
+	/** Parses what the client sent and hands methods to HandleMethod. */
+	virtual void HandleClientMessage(const FString& MessageText)
+	{
+		TSharedPtr<FJsonObject> Message;
+		TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(MessageText);
+		if (!FJsonSerializer::Deserialize(Reader, Message) || !Message.IsValid())
+		{
+			UE_LOG(LogMixerInteractivity, Warning, TEXT("%s could not parse message from client: %s"), *Name, *MessageText);
+			return;
+		}
+
+		FString MessageType;
+		FString Method;
+		int32 Id;
+		if (!Message->TryGetStringField(MixerStringConstants::FieldNames::Type, MessageType)
+			|| MessageType != MixerStringConstants::MessageTypes::Method
+			|| !Message->TryGetStringField(MixerStringConstants::FieldNames::Method, Method)
+			|| !Message->TryGetNumberField(MixerStringConstants::FieldNames::Id, Id))
+		{
+			UE_LOG(LogMixerInteractivity, Warning, TEXT("%s ignoring unexpected message from client: %s"), *Name, *MessageText);
+			return;
+		}
+
+		HandleMethod(Method, Id, *Message);
+	}
+
+	/** Start a service initiated message.  Write its payload value then call EndMessage. */
+	FMixerJsonUtf8Writer BeginServerMessage(const FString& MessageName)
+	{
+		Scratch.Reset();
+		FMixerJsonUtf8Writer Writer(Scratch);
+		Writer.BeginObject();
+		Writer.WriteField(MixerStringConstants::FieldNames::Type, ServerMessageType);
+		Writer.WriteField(NameField, MessageName);
+		Writer.WriteKey(PayloadField);
+		return Writer;
+	}
+
+	/** Start a successful reply.  Write its result value then call EndMessage. */
+	FMixerJsonUtf8Writer BeginReply(int32 Id)
+	{
+		Scratch.Reset();
+		FMixerJsonUtf8Writer Writer(Scratch);
+		Writer.BeginObject();
+		Writer.WriteField(MixerStringConstants::FieldNames::Type, MixerStringConstants::MessageTypes::Reply);
+		Writer.WriteField(MixerStringConstants::FieldNames::Id, Id);
+		Writer.WriteKey(MixerStringConstants::FieldNames::Error);
+		Writer.WriteNull();
+		Writer.WriteKey(ResultField);
+		return Writer;
+	}
+
+	void SendNullReply(int32 Id)
+	{
+		FMixerJsonUtf8Writer Writer = BeginReply(Id);
+		Writer.WriteNull();
+		EndMessage(Writer);
+	}
+
+	void SendErrorReply(int32 Id, int32 Code, const FString& ErrorMessage)
+	{
+		Scratch.Reset();
+		FMixerJsonUtf8Writer Writer(Scratch);
+		Writer.BeginObject();
+		Writer.WriteField(MixerStringConstants::FieldNames::Type, MixerStringConstants::MessageTypes::Reply);
+		Writer.WriteField(MixerStringConstants::FieldNames::Id, Id);
+		Writer.WriteKey(ResultField);
+		Writer.WriteNull();
+		Writer.WriteKey(MixerStringConstants::FieldNames::Error);
+		Writer.BeginObject();
+		Writer.WriteField("code", Code);
+		Writer.WriteField(MixerStringConstants::FieldNames::Message, ErrorMessage);
+		Writer.EndObject();
+		EndMessage(Writer);
+	}
+
+	void EndMessage(FMixerJsonUtf8Writer& Writer)
+	{
+		Writer.EndObject();
+		SendRaw(Scratch.GetData(), Scratch.Num(), FPlatformTime::Seconds() + FMath::Max(CVarLoopbackLatencyMs.GetValueOnGameThread(), 0.0f) / 1000.0);
+	}
+
+	/** Queue an already framed message for the client.  Messages must be queued in DeliverAt order. */
+	void SendRaw(const ANSICHAR* Utf8Data, int32 Length, double DeliverAt)
+	{
+		++MessagesSent;
+		BytesSent += Length;
+
+		FUTF8ToTCHAR Converted(Utf8Data, Length);
+		FScheduledMessage& Scheduled = Outbox[Outbox.AddDefaulted()];
+		Scheduled.DeliverAt = DeliverAt;
+		Scheduled.Text = FString(Converted.Length(), Converted.Get());
+	}
+
+	static FString ToCondensedJson(const TSharedRef<FJsonObject>& Object)
+	{
+		FString Json;
+		TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> JsonWriter = TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&Json);
+		FJsonSerializer::Serialize(Object, JsonWriter);
+		return Json;
+	}
+
+protected:
+	FString Name;
+
+private:
+	struct FScheduledMessage
+	{
+		double DeliverAt;
+		FString Text;
+	};
+
+	FString ServerMessageType;
+	FString NameField;
+	FString PayloadField;
+	FString ResultField;
+
+	TArray<ANSICHAR> Scratch;
+	TArray<FScheduledMessage> Outbox;
+	int32 OutboxHead;
+
+	float ReportTimer;
+	int32 MessagesReceived;
+	int32 BytesReceived;
+	int32 MessagesSent;
+	int32 BytesSent;
+};
+
+/** Interactive protocol 2.0 as spoken by the service at mixer.com/api/v1/interactive/hosts. */
+class FMixerLoopbackInteractiveService : public FMixerLoopbackService
+{
+public:
+	FMixerLoopbackInteractiveService(const FString& InName)
+		: FMixerLoopbackService(InName, MixerStringConstants::MessageTypes::Method, MixerStringConstants::FieldNames::Method, MixerStringConstants::FieldNames::Params, MixerStringConstants::FieldNames::Result)
+		, PendingInputs(0.0)
+		, bGameReady(false)
+	{
+	}
+
+protected:
+	virtual void HandleConnected() override
+	{
+		Participants.Reset();
+		InputControls.Reset();
+		PendingInputs = 0.0;
+		bGameReady = false;
+
+		FMixerJsonUtf8Writer Writer = BeginServerMessage(TEXT("hello"));
+		Writer.BeginObject();
+		Writer.EndObject();
+		EndMessage(Writer);
+	}
+
+	virtual void HandleMethod(const FString& Method, int32 Id, const FJsonObject& Message) override
+	{
+		const TSharedPtr<FJsonObject>* Params = nullptr;
+		Message.TryGetObjectField(MixerStringConstants::FieldNames::Params, Params);
+
+		if (Method == MixerStringConstants::MethodNames::GetScenes)
+		{
+			FMixerJsonUtf8Writer Writer = BeginReply(Id);
+			Writer.BeginObject();
+			Writer.WriteKey(MixerStringConstants::FieldNames::Scenes);
+			WriteScenes(Writer);
+			Writer.EndObject();
+			EndMessage(Writer);
+		}
+		else if (Method == MixerStringConstants::MethodNames::Ready)
+		{
+			bool bIsReady = false;
+			if (Params != nullptr)
+			{
+				(*Params)->TryGetBoolField(MixerStringConstants::FieldNames::IsReady, bIsReady);
+			}
+			bGameReady = bIsReady;
+			SendNullReply(Id);
+
+			FMixerJsonUtf8Writer Writer = BeginServerMessage(TEXT("onReady"));
+			Writer.BeginObject();
+			Writer.WriteField(MixerStringConstants::FieldNames::IsReady, bGameReady);
+			Writer.EndObject();
+			EndMessage(Writer);
+		}
+		else if (Method == MixerStringConstants::MethodNames::UpdateControls)
+		{
+			SendNullReply(Id);
+
+			if (Params != nullptr && CVarLoopbackEchoControlUpdates.GetValueOnGameThread() != 0)
+			{
+				FMixerJsonUtf8Writer Writer = BeginServerMessage(TEXT("onControlUpdate"));
+				Writer.WriteRawValue(ToCondensedJson(Params->ToSharedRef()));
+				EndMessage(Writer);
+			}
+		}
+		else
+		{
+			// capture, createGroups, updateGroups, updateParticipants and any game specific methods all simply succeed
+			UE_CLOG(Method != MixerStringConstants::MethodNames::Capture, LogMixerInteractivity, Verbose, TEXT("%s accepting %s"), *Name, *Method);
+			SendNullReply(Id);
+		}
+	}
+
+	virtual void TickSimulation(float DeltaTime) override
+	{
+		SyncParticipants();
+
+		const double InputRate = FMath::Max(CVarLoopbackInputsPerSecond.GetValueOnGameThread(), 0.0f);
+		if (!bGameReady || Participants.Num() == 0 || InputControls.Num() == 0)
+		{
+			PendingInputs = 0.0;
+			return;
+		}
+
+		// Don't let a long hitch (e.g. a breakpoint) turn into an enormous burst
+		PendingInputs = FMath::Min(PendingInputs + InputRate * DeltaTime, FMath::Max(InputRate, 1.0));
+		while (PendingInputs >= 1.0)
+		{
+			const FParticipant& Participant = Participants[FMath::RandHelper(Participants.Num())];
+			const FControl& Control = InputControls[FMath::RandHelper(InputControls.Num())];
+			if (Control.bIsButton)
+			{
+				SendInput(Participant, Control, MixerStringConstants::EventTypes::MouseDown);
+				SendInput(Participant, Control, MixerStringConstants::EventTypes::MouseUp);
+				PendingInputs -= 2.0;
+			}
+			else
+			{
+				SendInput(Participant, Control, MixerStringConstants::EventTypes::Move);
+				PendingInputs -= 1.0;
+			}
+		}
+	}
+
+private:
+	struct FParticipant
+	{
+		FString SessionId;
+		int32 UserId;
+		int64 ConnectedAt;
+	};
+
+	struct FControl
+	{
+		FString ControlId;
+		int32 Cost;
+		bool bIsButton;
+	};
+
+	void WriteScenes(FMixerJsonUtf8Writer& Writer)
+	{
+		InputControls.Reset();
+		Writer.BeginArray();
+
+		bool bWroteProjectScenes = false;
+#if WITH_EDITORONLY_DATA
+		// Serve the game's own controls if we can, so that its bindings see input
+		const UMixerInteractivitySettings* Settings = GetDefault<UMixerInteractivitySettings>();
+		UMixerProjectAsset* ProjectAsset = Cast<UMixerProjectAsset>(Settings->ProjectDefinition.TryLoad());
+		if (ProjectAsset != nullptr)
+		{
+			for (const FMixerInteractiveScene& Scene : ProjectAsset->ParsedProjectDefinition.Controls.Scenes)
+			{
+				Writer.BeginObject();
+				Writer.WriteField(MixerStringConstants::FieldNames::SceneId, Scene.Id);
+				Writer.WriteKey(MixerStringConstants::FieldNames::Controls);
+				Writer.BeginArray();
+				for (const FMixerInteractiveControl& Control : Scene.Controls)
+				{
+					Writer.BeginObject();
+					Writer.WriteField(MixerStringConstants::FieldNames::ControlId, Control.Id);
+					Writer.WriteField(MixerStringConstants::FieldNames::Kind, Control.Kind);
+					Writer.EndObject();
+
+					if (Control.IsButton() || Control.IsJoystick())
+					{
+						FControl& InputControl = InputControls[InputControls.AddDefaulted()];
+						InputControl.ControlId = Control.Id;
+						InputControl.Cost = 0;
+						InputControl.bIsButton = Control.IsButton();
+					}
+				}
+				Writer.EndArray();
+				WriteDefaultGroupIfDefaultScene(Writer, Scene.Id);
+				Writer.EndObject();
+				bWroteProjectScenes = true;
+			}
+		}
+#endif
+
+		if (!bWroteProjectScenes)
+		{
+			Writer.BeginObject();
+			Writer.WriteField(MixerStringConstants::FieldNames::SceneId, DefaultSceneAndGroup);
+			Writer.WriteKey(MixerStringConstants::FieldNames::Controls);
+			Writer.BeginArray();
+
+			const int32 NumButtons = FMath::Max(CVarLoopbackButtons.GetValueOnGameThread(), 0);
+			for (int32 i = 0; i < NumButtons; ++i)
+			{
+				FControl& Button = InputControls[InputControls.AddDefaulted()];
+				Button.ControlId = FString::Printf(TEXT("button%d"), i);
+				Button.Cost = i % 2;
+				Button.bIsButton = true;
+
+				Writer.BeginObject();
+				Writer.WriteField(MixerStringConstants::FieldNames::ControlId, Button.ControlId);
+				Writer.WriteField(MixerStringConstants::FieldNames::Kind, FMixerInteractiveControl::ButtonKind);
+				Writer.WriteField(MixerStringConstants::FieldNames::Text, FString::Printf(TEXT("Button %d"), i));
+				Writer.WriteField(MixerStringConstants::FieldNames::Cost, Button.Cost);
+				Writer.EndObject();
+			}
+
+			const int32 NumJoysticks = FMath::Max(CVarLoopbackJoysticks.GetValueOnGameThread(), 0);
+			for (int32 i = 0; i < NumJoysticks; ++i)
+			{
+				FControl& Joystick = InputControls[InputControls.AddDefaulted()];
+				Joystick.ControlId = FString::Printf(TEXT("joystick%d"), i);
+				Joystick.Cost = 0;
+				Joystick.bIsButton = false;
+
+				Writer.BeginObject();
+				Writer.WriteField(MixerStringConstants::FieldNames::ControlId, Joystick.ControlId);
+				Writer.WriteField(MixerStringConstants::FieldNames::Kind, FMixerInteractiveControl::JoystickKind);
+				Writer.EndObject();
+			}
+
+			Writer.EndArray();
+			WriteDefaultGroupIfDefaultScene(Writer, DefaultSceneAndGroup);
+			Writer.EndObject();
+		}
+
+		Writer.EndArray();
+	}
+
+	void WriteDefaultGroupIfDefaultScene(FMixerJsonUtf8Writer& Writer, const FString& SceneId)
+	{
+		if (SceneId == DefaultSceneAndGroup)
+		{
+			Writer.WriteKey(MixerStringConstants::FieldNames::Groups);
+			Writer.BeginArray();
+			Writer.BeginObject();
+			Writer.WriteField(MixerStringConstants::FieldNames::GroupId, DefaultSceneAndGroup);
+			Writer.EndObject();
+			Writer.EndArray();
+		}
+	}
+
+	void WriteParticipant(FMixerJsonUtf8Writer& Writer, const FParticipant& Participant)
+	{
+		Writer.BeginObject();
+		Writer.WriteField(MixerStringConstants::FieldNames::SessionId, Participant.SessionId);
+		Writer.WriteField(MixerStringConstants::FieldNames::UserIdNoUnderscore, Participant.UserId);
+		Writer.WriteField(MixerStringConstants::FieldNames::UserNameNoUnderscore, GetViewerName(Participant.UserId));
+		Writer.WriteField(MixerStringConstants::FieldNames::Level, 1 + Participant.UserId % 100);
+		Writer.WriteField(MixerStringConstants::FieldNames::LastInputAt, Participant.ConnectedAt);
+		Writer.WriteField(MixerStringConstants::FieldNames::ConnectedAt, Participant.ConnectedAt);
+		Writer.WriteField(MixerStringConstants::FieldNames::Disabled, false);
+		Writer.WriteField(MixerStringConstants::FieldNames::GroupId, DefaultSceneAndGroup);
+		Writer.EndObject();
+	}
+
+	/** Join or remove one batch of participants to move towards mixer.Loopback.Participants. */
+	void SyncParticipants()
+	{
+		const int32 TargetParticipants = FMath::Max(CVarLoopbackParticipants.GetValueOnGameThread(), 0);
+		if (TargetParticipants == Participants.Num())
+		{
+			return;
+		}
+
+		const bool bJoining = TargetParticipants > Participants.Num();
+		FMixerJsonUtf8Writer Writer = BeginServerMessage(bJoining ? TEXT("onParticipantJoin") : TEXT("onParticipantLeave"));
+		Writer.BeginObject();
+		Writer.WriteKey(MixerStringConstants::FieldNames::Participants);
+		Writer.BeginArray();
+		if (bJoining)
+		{
+			const int64 Now = GetUnixTimeMs();
+			const int32 NumToJoin = FMath::Min(TargetParticipants - Participants.Num(), MaxParticipantsPerMessage);
+			for (int32 i = 0; i < NumToJoin; ++i)
+			{
+				FParticipant& Participant = Participants[Participants.AddDefaulted()];
+				Participant.SessionId = MakeGuidString();
+				Participant.UserId = FirstViewerUserId + Participants.Num() - 1;
+				Participant.ConnectedAt = Now;
+				WriteParticipant(Writer, Participant);
+			}
+		}
+		else
+		{
+			const int32 NumToLeave = FMath::Min(Participants.Num() - TargetParticipants, MaxParticipantsPerMessage);
+			for (int32 i = Participants.Num() - NumToLeave; i < Participants.Num(); ++i)
+			{
+				WriteParticipant(Writer, Participants[i]);
+			}
+			Participants.RemoveAt(Participants.Num() - NumToLeave, NumToLeave, false);
+		}
+		Writer.EndArray();
+		Writer.EndObject();
+		EndMessage(Writer);
+	}
+
+	void SendInput(const FParticipant& Participant, const FControl& Control, const FString& EventType)
+	{
+		FMixerJsonUtf8Writer Writer = BeginServerMessage(TEXT("giveInput"));
+		Writer.BeginObject();
+		Writer.WriteField(MixerStringConstants::FieldNames::ParticipantId, Participant.SessionId);
+		if (Control.Cost > 0 && EventType == MixerStringConstants::EventTypes::MouseDown)
+		{
+			Writer.WriteField(MixerStringConstants::FieldNames::TransactionId, MakeGuidString());
+		}
+		Writer.WriteKey(MixerStringConstants::FieldNames::Input);
+		Writer.BeginObject();
+		Writer.WriteField(MixerStringConstants::FieldNames::ControlId, Control.ControlId);
+		Writer.WriteField(MixerStringConstants::FieldNames::Event, EventType);
+		if (!Control.bIsButton)
+		{
+			Writer.WriteField(MixerStringConstants::FieldNames::X, FMath::FRandRange(-1.0f, 1.0f));
+			Writer.WriteField(MixerStringConstants::FieldNames::Y, FMath::FRandRange(-1.0f, 1.0f));
+		}
+		Writer.EndObject();
+		Writer.EndObject();
+		EndMessage(Writer);
+	}
+
+	TArray<FParticipant> Participants;
+	TArray<FControl> InputControls;
+	double PendingInputs;
+	bool bGameReady;
+};
+
+/** The chat protocol as spoken by the servers listed at mixer.com/api/v1/chats/<channel>. */
+class FMixerLoopbackChatService : public FMixerLoopbackService
+{
+public:
+	FMixerLoopbackChatService(const FString& InName)
+		: FMixerLoopbackService(InName, MixerStringConstants::MessageTypes::Event, MixerStringConstants::FieldNames::Event, MixerStringConstants::FieldNames::Data, MixerStringConstants::FieldNames::Data)
+		, ChannelId(0)
+		, LocalUserId(0)
+		, PendingMessages(0.0)
+		, bPollActive(false)
+		, bPollChanged(false)
+		, PollEndsAtMs(0)
+		, PollDurationMs(0)
+		, PollEndsAtAppTime(0.0)
+		, PollUpdateTimer(0.0f)
+	{
+	}
+
+protected:
+	virtual void HandleConnected() override
+	{
+		ChannelId = 0;
+		LocalUserId = 0;
+		PendingMessages = 0.0;
+		bPollActive = false;
+
+		FMixerJsonUtf8Writer Writer = BeginServerMessage(MixerStringConstants::EventTypes::Welcome);
+		Writer.BeginObject();
+		Writer.WriteField("server", Name);
+		Writer.EndObject();
+		EndMessage(Writer);
+	}
+
+	virtual void HandleMethod(const FString& Method, int32 Id, const FJsonObject& Message) override
+	{
+		static const TArray<TSharedPtr<FJsonValue>> NoArguments;
+		const TArray<TSharedPtr<FJsonValue>>* ArgumentsPtr = nullptr;
+		const TArray<TSharedPtr<FJsonValue>>& Arguments = Message.TryGetArrayField(MixerStringConstants::FieldNames::Arguments, ArgumentsPtr) ? *ArgumentsPtr : NoArguments;
+
+		if (Method == MixerStringConstants::MethodNames::Auth)
+		{
+			// Any auth key is accepted; without one the connection is anonymous
+			ChannelId = Arguments.Num() > 0 ? static_cast<int32>(Arguments[0]->AsNumber()) : 0;
+			LocalUserId = Arguments.Num() > 2 ? static_cast<int32>(Arguments[1]->AsNumber()) : 0;
+
+			FMixerJsonUtf8Writer Writer = BeginReply(Id);
+			Writer.BeginObject();
+			Writer.WriteField("authenticated", LocalUserId != 0);
+			Writer.WriteKey("roles");
+			Writer.BeginArray();
+			if (LocalUserId != 0)
+			{
+				Writer.WriteValue(TEXT("Owner"));
+			}
+			Writer.EndArray();
+			Writer.EndObject();
+			EndMessage(Writer);
+		}
+		else if (Method == MixerStringConstants::MethodNames::History)
+		{
+			const int32 NumMessages = Arguments.Num() > 0 ? FMath::Clamp(static_cast<int32>(Arguments[0]->AsNumber()), 0, 100) : 0;
+
+			// Oldest first, as the real service reports it
+			FMixerJsonUtf8Writer Writer = BeginReply(Id);
+			Writer.BeginArray();
+			for (int32 i = 0; i < NumMessages; ++i)
+			{
+				const int32 ViewerId = GetRandomViewerId();
+				WriteChatMessage(Writer, ViewerId, GetViewerName(ViewerId), FString::Printf(TEXT("History message %d"), i), false);
+			}
+			Writer.EndArray();
+			EndMessage(Writer);
+		}
+		else if (Method == MixerStringConstants::MethodNames::Msg || Method == MixerStringConstants::MethodNames::Whisper)
+		{
+			const bool bWhisper = Method == MixerStringConstants::MethodNames::Whisper;
+			const int32 TextIndex = bWhisper ? 1 : 0;
+			if (LocalUserId == 0 || Arguments.Num() <= TextIndex)
+			{
+				SendErrorReply(Id, 4000, TEXT("You must be authenticated to send messages."));
+				return;
+			}
+
+			const FString LocalUserName = FString::Printf(TEXT("User%d"), LocalUserId);
+			const FString Text = Arguments[TextIndex]->AsString();
+			FMixerJsonUtf8Writer Writer = BeginReply(Id);
+			WriteChatMessage(Writer, LocalUserId, LocalUserName, Text, bWhisper);
+			EndMessage(Writer);
+
+			// Everyone in the channel, including the sender, sees public messages as events
+			if (!bWhisper)
+			{
+				FMixerJsonUtf8Writer EventWriter = BeginServerMessage(MixerStringConstants::EventTypes::ChatMessage);
+				WriteChatMessage(EventWriter, LocalUserId, LocalUserName, Text, false);
+				EndMessage(EventWriter);
+			}
+		}
+		else if (Method == MixerStringConstants::MethodNames::VoteStart)
+		{
+			const TArray<TSharedPtr<FJsonValue>>* Answers = nullptr;
+			if (bPollActive || Arguments.Num() < 3 || !Arguments[1]->TryGetArray(Answers) || Answers->Num() == 0)
+			{
+				SendErrorReply(Id, 4000, bPollActive ? TEXT("A poll is already in progress.") : TEXT("Invalid poll arguments."));
+				return;
+			}
+
+			bPollActive = true;
+			PollQuestion = Arguments[0]->AsString();
+			PollAnswers.Reset();
+			for (const TSharedPtr<FJsonValue>& Answer : *Answers)
+			{
+				PollAnswers.Add(Answer->AsString());
+			}
+			PollResponses.Init(0, PollAnswers.Num());
+			PollDurationMs = static_cast<int64>(FMath::Max(Arguments[2]->AsNumber(), 1.0) * 1000.0);
+			PollEndsAtMs = GetUnixTimeMs() + PollDurationMs;
+			PollEndsAtAppTime = FPlatformTime::Seconds() + PollDurationMs / 1000.0;
+			PollUpdateTimer = 0.0f;
+			bPollChanged = false;
+
+			SendNullReply(Id);
+			SendPollEvent(MixerStringConstants::EventTypes::PollStart);
+		}
+		else if (Method == MixerStringConstants::MethodNames::VoteChoose)
+		{
+			const int32 AnswerIndex = Arguments.Num() > 0 ? static_cast<int32>(Arguments[0]->AsNumber()) : INDEX_NONE;
+			if (!bPollActive || !PollResponses.IsValidIndex(AnswerIndex))
+			{
+				SendErrorReply(Id, 4000, TEXT("No such poll answer."));
+				return;
+			}
+
+			++PollResponses[AnswerIndex];
+			bPollChanged = true;
+
+			FMixerJsonUtf8Writer Writer = BeginReply(Id);
+			Writer.WriteValue(true);
+			EndMessage(Writer);
+		}
+		else
+		{
+			UE_LOG(LogMixerInteractivity, Verbose, TEXT("%s accepting %s"), *Name, *Method);
+			SendNullReply(Id);
+		}
+	}
+
+	virtual void TickSimulation(float DeltaTime) override
+	{
+		if (ChannelId != 0)
+		{
+			const double MessageRate = FMath::Max(CVarLoopbackChatMessagesPerSecond.GetValueOnGameThread(), 0.0f);
+			PendingMessages = FMath::Min(PendingMessages + MessageRate * DeltaTime, FMath::Max(MessageRate, 1.0));
+			while (PendingMessages >= 1.0)
+			{
+				PendingMessages -= 1.0;
+				if (bPollActive)
+				{
+					++PollResponses[FMath::RandHelper(PollResponses.Num())];
+					bPollChanged = true;
+				}
+				else
+				{
+					const int32 ViewerId = GetRandomViewerId();
+					FMixerJsonUtf8Writer Writer = BeginServerMessage(MixerStringConstants::EventTypes::ChatMessage);
+					WriteChatMessage(Writer, ViewerId, GetViewerName(ViewerId), FString::Printf(TEXT("Hello from %s"), *GetViewerName(ViewerId)), false);
+					EndMessage(Writer);
+				}
+			}
+		}
+
+		if (bPollActive)
+		{
+			// Like the real service, vote counts are pushed periodically rather than per vote
+			PollUpdateTimer += DeltaTime;
+			if (FPlatformTime::Seconds() >= PollEndsAtAppTime)
+			{
+				bPollActive = false;
+				SendPollEvent(MixerStringConstants::EventTypes::PollEnd);
+			}
+			else if (bPollChanged && PollUpdateTimer >= 1.0f)
+			{
+				SendPollEvent(MixerStringConstants::EventTypes::PollStart);
+			}
+		}
+	}
+
+private:
+	int32 GetRandomViewerId() const
+	{
+		return FirstViewerUserId + FMath::RandHelper(FMath::Max(CVarLoopbackParticipants.GetValueOnGameThread(), 1));
+	}
+
+	void WriteChatMessage(FMixerJsonUtf8Writer& Writer, int32 UserId, const FString& UserName, const FString& Text, bool bWhisper)
+	{
+		Writer.BeginObject();
+		Writer.WriteField("channel", ChannelId);
+		Writer.WriteField(MixerStringConstants::FieldNames::Id, MakeGuidString());
+		Writer.WriteField(MixerStringConstants::FieldNames::UserNameWithUnderscore, UserName);
+		Writer.WriteField(MixerStringConstants::FieldNames::UserIdWithUnderscore, UserId);
+		Writer.WriteField(MixerStringConstants::FieldNames::UserLevel, 1 + UserId % 100);
+		Writer.WriteKey(MixerStringConstants::FieldNames::Message);
+		Writer.BeginObject();
+		Writer.WriteKey(MixerStringConstants::FieldNames::Message);
+		Writer.BeginArray();
+		Writer.BeginObject();
+		Writer.WriteField(MixerStringConstants::FieldNames::Type, MixerStringConstants::FieldNames::Text);
+		Writer.WriteField(MixerStringConstants::FieldNames::Data, Text);
+		Writer.WriteField(MixerStringConstants::FieldNames::Text, Text);
+		Writer.EndObject();
+		Writer.EndArray();
+		Writer.WriteKey(MixerStringConstants::FieldNames::Meta);
+		Writer.BeginObject();
+		if (bWhisper)
+		{
+			Writer.WriteField(MixerStringConstants::FieldNames::Whisper, true);
+		}
+		Writer.EndObject();
+		Writer.EndObject();
+		Writer.EndObject();
+	}
+
+	void SendPollEvent(const FString& EventName)
+	{
+		int32 NumVoters = 0;
+		for (int32 Responses : PollResponses)
+		{
+			NumVoters += Responses;
+		}
+
+		FMixerJsonUtf8Writer Writer = BeginServerMessage(EventName);
+		Writer.BeginObject();
+		Writer.WriteField(MixerStringConstants::FieldNames::Q, PollQuestion);
+		Writer.WriteField(MixerStringConstants::FieldNames::Answers, PollAnswers);
+		Writer.WriteKey(MixerStringConstants::FieldNames::Author);
+		Writer.BeginObject();
+		Writer.WriteField(MixerStringConstants::FieldNames::UserNameWithUnderscore, FString::Printf(TEXT("User%d"), LocalUserId));
+		Writer.WriteField(MixerStringConstants::FieldNames::UserIdWithUnderscore, LocalUserId);
+		Writer.WriteField(MixerStringConstants::FieldNames::UserLevel, 1);
+		Writer.EndObject();
+		Writer.WriteField("duration", PollDurationMs);
+		Writer.WriteField(MixerStringConstants::FieldNames::EndsAt, PollEndsAtMs);
+		Writer.WriteField(MixerStringConstants::FieldNames::Voters, NumVoters);
+		Writer.WriteField(MixerStringConstants::FieldNames::ResponsesByIndex, PollResponses);
+		Writer.EndObject();
+		EndMessage(Writer);
+
+		PollUpdateTimer = 0.0f;
+		bPollChanged = false;
+	}
+
+	int32 ChannelId;
+	int32 LocalUserId;
+	double PendingMessages;
+
+	bool bPollActive;
+	bool bPollChanged;
+	FString PollQuestion;
+	TArray<FString> PollAnswers;
+	TArray<int32> PollResponses;
+	int64 PollEndsAtMs;
+	int64 PollDurationMs;
+	double PollEndsAtAppTime;
+	float PollUpdateTimer;
+};
+
+/**
+* Plays back the frames the service sent during one connection of a .mxcap capture.
+*
+* Replies carry the ids from the capture, which match as long as the client repeats
+* the requests it made when the capture was taken.  At mixer.Replay.Speed 0 each frame
+* is held back until the client has sent as many frames as it had at the same point
+* in the capture, so replies never arrive ahead of their requests.
+*/
+class FMixerLoopbackReplayService : public FMixerLoopbackService
+{
+public:
+	FMixerLoopbackReplayService(const FString& InName, const FString& InCaptureFilename)
+		: FMixerLoopbackService(InName, FString(), FString(), FString(), FString())
+		, CaptureFilename(InCaptureFilename)
+		, NextRecord(0)
+		, EndRecord(0)
+		, CaptureStartTime(0.0)
+		, ReplayStartTime(0.0)
+		, SyncWaitStartTime(0.0)
+		, ClientFramesCaptured(0)
+		, ClientFramesReceived(0)
+		, FramesReplayed(0)
+	{
+	}
+
+protected:
+	virtual void HandleConnected() override
+	{
+		NextRecord = 0;
+		EndRecord = 0;
+		ClientFramesCaptured = 0;
+		ClientFramesReceived = 0;
+		FramesReplayed = 0;
+		SyncWaitStartTime = 0.0;
+		if (!Capture.Open(CaptureFilename))
+		{
+			return;
+		}
+
+		// Replay the first connection in the capture, from its Open record up to the next Open or Close
+		const TArray<FMixerTrafficCaptureReader::FRecord>& Records = Capture.GetRecords();
+		while (NextRecord < Records.Num() && Records[NextRecord].Kind != EMixerTrafficRecordKind::Open)
+		{
+			++NextRecord;
+		}
+		if (NextRecord == Records.Num())
+		{
+			UE_LOG(LogMixerInteractivity, Warning, TEXT("%s contains no connections to replay."), *CaptureFilename);
+			return;
+		}
+
+		UE_LOG(LogMixerInteractivity, Log, TEXT("Replaying connection to %s from %s"), *Records[NextRecord].GetPayloadString(), *CaptureFilename);
+		CaptureStartTime = Records[NextRecord].Timestamp;
+		ReplayStartTime = FPlatformTime::Seconds();
+		++NextRecord;
+
+		EndRecord = NextRecord;
+		while (EndRecord < Records.Num() && Records[EndRecord].Kind != EMixerTrafficRecordKind::Open && Records[EndRecord].Kind != EMixerTrafficRecordKind::Close)
+		{
+			++EndRecord;
+		}
+	}
+
+	virtual void HandleClientMessage(const FString& MessageText) override
+	{
+		// The client's side of the conversation is already in the capture
+		++ClientFramesReceived;
+	}
+
+	virtual void TickSimulation(float DeltaTime) override
+	{
+		if (NextRecord >= EndRecord)
+		{
+			return;
+		}
+
+		const TArray<FMixerTrafficCaptureReader::FRecord>& Records = Capture.GetRecords();
+		const float Speed = FMath::Max(CVarReplaySpeed.GetValueOnGameThread(), 0.0f);
+		const double Now = FPlatformTime::Seconds();
+		for (; NextRecord < EndRecord; ++NextRecord)
+		{
+			const FMixerTrafficCaptureReader::FRecord& Record = Records[NextRecord];
+			if (Record.Kind == EMixerTrafficRecordKind::Outbound)
+			{
+				++ClientFramesCaptured;
+				continue;
+			}
+
+			if (Speed > 0.0f)
+			{
+				if (ReplayStartTime + (Record.Timestamp - CaptureStartTime) / Speed > Now)
+				{
+					break;
+				}
+			}
+			else if (ClientFramesReceived < ClientFramesCaptured)
+			{
+				if (SyncWaitStartTime == 0.0)
+				{
+					SyncWaitStartTime = Now;
+				}
+				if (Now - SyncWaitStartTime < CVarReplaySyncTimeout.GetValueOnGameThread())
+				{
+					break;
+				}
+
+				UE_LOG(LogMixerInteractivity, Warning, TEXT("%s client has sent %d of the %d frames in the capture; replaying regardless."), *Name, ClientFramesReceived, ClientFramesCaptured);
+				ClientFramesReceived = ClientFramesCaptured;
+			}
+
+			SyncWaitStartTime = 0.0;
+			SendRaw(Record.Payload, Record.Length, Now);
+			++FramesReplayed;
+		}
+
+		if (NextRecord == EndRecord)
+		{
+			const double Elapsed = FMath::Max(FPlatformTime::Seconds() - ReplayStartTime, SMALL_NUMBER);
+			UE_LOG(LogMixerInteractivity, Log, TEXT("%s finished: %d frames in %.3f s (%.1f frames/s)"), *Name, FramesReplayed, Elapsed, FramesReplayed / Elapsed);
+		}
+	}
+
+private:
+	FString CaptureFilename;
+	FMixerTrafficCaptureReader Capture;
+	int32 NextRecord;
+	int32 EndRecord;
+	double CaptureStartTime;
+	double ReplayStartTime;
+	double SyncWaitStartTime;
+	int32 ClientFramesCaptured;
+	int32 ClientFramesReceived;
+	int32 FramesReplayed;
+};
+
+FMixerLoopbackWebSocket::FMixerLoopbackWebSocket(const FString& InUrl)
+	: Url(InUrl)
+	, State(EState::Idle)
+	, CloseCode(1000)
+{
+	if (Url.StartsWith(ReplayScheme))
+	{
+		const FString CaptureFilename = Url.RightChop(FCString::Strlen(ReplayScheme));
+		Service = MakeUnique<FMixerLoopbackReplayService>(Url, FPaths::IsRelative(CaptureFilename) ? FPaths::Combine(FPaths::ProjectSavedDir(), CaptureFilename) : CaptureFilename);
+		return;
+	}
+
+	const FString ServiceName = Url.RightChop(FCString::Strlen(LoopbackScheme));
+	if (ServiceName.StartsWith(TEXT("interactive")))
+	{
+		Service = MakeUnique<FMixerLoopbackInteractiveService>(Url);
+	}
+	else if (ServiceName.StartsWith(TEXT("chat")))
+	{
+		Service = MakeUnique<FMixerLoopbackChatService>(Url);
+	}
+}
+
+FMixerLoopbackWebSocket::~FMixerLoopbackWebSocket()
+{
+}
+
+void FMixerLoopbackWebSocket::Connect()
+{
+	State = EState::Connecting;
+}
+
+void FMixerLoopbackWebSocket::Close(int32 Code, const FString& Reason)
+{
+	if (State == EState::Connecting || State == EState::Connected)
+	{
+		State = EState::Closing;
+		CloseCode = Code;
+		CloseReason = Reason;
+	}
+}
+
+bool FMixerLoopbackWebSocket::IsConnected()
+{
+	return State == EState::Connected;
+}
+
+void FMixerLoopbackWebSocket::Send(const FString& Data)
+{
+	if (State == EState::Connected)
+	{
+		Service->ReceiveFromClient(Data, FTCHARToUTF8(*Data, Data.Len()).Length());
+	}
+}
+
+void FMixerLoopbackWebSocket::Send(const void* Utf8Data, SIZE_T Size, bool bIsBinary)
+{
+	// Both services only speak text frames
+	if (State == EState::Connected && !bIsBinary)
+	{
+		FUTF8ToTCHAR Converted(static_cast<const ANSICHAR*>(Utf8Data), static_cast<int32>(Size));
+		Service->ReceiveFromClient(FString(Converted.Length(), Converted.Get()), static_cast<int32>(Size));
+	}
+}
+
+bool FMixerLoopbackWebSocket::Tick(float DeltaTime)
+{
+	// Handlers may release the last reference to this socket
+	TSharedRef<FMixerLoopbackWebSocket> KeepAlive = AsShared();
+
+	switch (State)
+	{
+	case EState::Connecting:
+		if (Service.IsValid())
+		{
+			State = EState::Connected;
+			Service->Connect();
+			OnConnected().Broadcast();
+		}
+		else
+		{
+			State = EState::Idle;
+			OnConnectionError().Broadcast(FString::Printf(TEXT("No simulated service is available at %s"), *Url));
+		}
+		break;
+
+	case EState::Connected:
+	{
+		Service->Tick(DeltaTime);
+
+		FString MessageText;
+		while (State == EState::Connected && Service->PopDeliverable(MessageText))
+		{
+			OnMessage().Broadcast(MessageText);
+		}
+		break;
+	}
+
+	case EState::Closing:
+		State = EState::Idle;
+		OnClosed().Broadcast(CloseCode, CloseReason, true);
+		break;
+
+	default:
+		break;
+	}
+
+	return true;
+}
+
+#endif
+
+// Suppress linker warning "warning LNK4221: no public symbols found; archive member will be inaccessible"
+int32 MixerLoopbackLinkerHelper;
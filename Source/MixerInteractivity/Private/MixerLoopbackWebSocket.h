@@ -0,0 +1,96 @@
+//*********************************************************
+//
+// Copyright (c) Microsoft. All rights reserved.
+// THIS CODE IS PROVIDED *AS IS* WITHOUT WARRANTY OF
+// ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING ANY
+// IMPLIED WARRANTIES OF FITNESS FOR A PARTICULAR
+// PURPOSE, MERCHANTABILITY, OR NON-INFRINGEMENT.
+//
+//*********************************************************
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+#include "IWebSocket.h"
+
+/** The simulated Mixer services are test infrastructure and are compiled out of shipping builds. */
+#define MIXER_WITH_LOOPBACK_SERVICE !UE_BUILD_SHIPPING
+
+/**
+* True for endpoint urls that are served in-process: loopback://interactive and loopback://chat
+* simulations, and replay://<path> playback of a websocket traffic capture.
+*/
+inline bool MixerIsLoopbackUrl(const FString& Url)
+{
+#if MIXER_WITH_LOOPBACK_SERVICE
+	return Url.StartsWith(TEXT("loopback://")) || Url.StartsWith(TEXT("replay://"));
+#else
+	return false;
+#endif
+}
+
+#if MIXER_WITH_LOOPBACK_SERVICE
+
+class FMixerLoopbackService;
+
+/**
+* Websocket whose far end is a simulated Mixer service running in the same process,
+* so that the plugin can be integration and load tested without network access.
+*
+* loopback://interactive speaks interactive protocol 2.0 and loopback://chat speaks the
+* chat protocol.  The number of simulated viewers and the rate at which they generate
+* traffic are controlled with the mixer.Loopback.* console variables.
+*
+* replay://<path to .mxcap> plays back what the service sent during a captured connection
+* (see FMixerTrafficCaptureWriter), at a rate set by the mixer.Replay.* console variables.
+*
+* Like a real socket, nothing is ever delivered from inside Send or Connect; connection
+* and incoming messages are reported from Tick on the game thread.
+*/
+class FMixerLoopbackWebSocket :
+	public IWebSocket,
+	public FTickerObjectBase,
+	public TSharedFromThis<FMixerLoopbackWebSocket>
+{
+public:
+	FMixerLoopbackWebSocket(const FString& Url);
+	virtual ~FMixerLoopbackWebSocket();
+
+	virtual void Connect() override;
+	virtual void Close(int32 Code = 1000, const FString& Reason = FString()) override;
+	virtual bool IsConnected() override;
+	virtual void Send(const FString& Data) override;
+	virtual void Send(const void* Utf8Data, SIZE_T Size, bool bIsBinary) override;
+
+	virtual FWebSocketConnectedEvent& OnConnected() override { return ConnectedEvent; }
+	virtual FWebSocketConnectionErrorEvent& OnConnectionError() override { return ConnectionErrorEvent; }
+	virtual FWebSocketClosedEvent& OnClosed() override { return ClosedEvent; }
+	virtual FWebSocketMessageEvent& OnMessage() override { return MessageEvent; }
+	virtual FWebSocketRawMessageEvent& OnRawMessage() override { return RawMessageEvent; }
+
+public:
+	virtual bool Tick(float DeltaTime) override;
+
+private:
+	enum class EState : uint8
+	{
+		Idle,
+		Connecting,
+		Connected,
+		Closing,
+	};
+
+	FString Url;
+	TUniquePtr<FMixerLoopbackService> Service;
+	EState State;
+	int32 CloseCode;
+	FString CloseReason;
+
+	FWebSocketConnectedEvent ConnectedEvent;
+	FWebSocketConnectionErrorEvent ConnectionErrorEvent;
+	FWebSocketClosedEvent ClosedEvent;
+	FWebSocketMessageEvent MessageEvent;
+	FWebSocketRawMessageEvent RawMessageEvent;
+};
+
+#endif
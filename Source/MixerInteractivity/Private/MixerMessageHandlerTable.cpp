@@ -0,0 +1,86 @@
+//*********************************************************
+//
+// Copyright (c) Microsoft. All rights reserved.
+// THIS CODE IS PROVIDED *AS IS* WITHOUT WARRANTY OF
+// ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING ANY
+// IMPLIED WARRANTIES OF FITNESS FOR A PARTICULAR
+// PURPOSE, MERCHANTABILITY, OR NON-INFRINGEMENT.
+//
+//*********************************************************
+#include "MixerMessageHandlerTable.h"
+#include "MixerInteractivityLog.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+
+#if !UE_BUILD_SHIPPING
+
+namespace
+{
+	/** Compares handler lookup through the perfect hash table against the TMap<FString, ...> it replaced. */
+	void BenchmarkHandlerLookup(const TArray<FString>& Args)
+	{
+		const int32 Iterations = Args.Num() > 0 ? FMath::Max(FCString::Atoi(*Args[0]), 1) : 1000000;
+
+		// Names registered by the interactive backend, plus one unhandled name to exercise misses
+		const TCHAR* Names[] =
+		{
+			TEXT("hello"), TEXT("giveInput"), TEXT("onParticipantJoin"), TEXT("onParticipantLeave"), TEXT("onParticipantUpdate"),
+			TEXT("onReady"), TEXT("onControlUpdate"), TEXT("onGroupCreate"), TEXT("onGroupUpdate"), TEXT("onGroupDelete"),
+		};
+
+		TMap<FString, int32> Map;
+		TMixerMessageHandlerTable<int32> Table;
+		for (int32 i = 0; i < static_cast<int32>(ARRAY_COUNT(Names)); ++i)
+		{
+			Map.Add(Names[i], i);
+			Table.Add(Names[i]) = i;
+		}
+
+		// Incoming names as they would appear inside a raw message: mostly giveInput, some participant traffic
+		const FString Message = TEXT("giveInput giveInput giveInput onParticipantUpdate giveInput onControlUpdate giveInput onSomethingNew");
+		TArray<FMixerJsonSpan> Incoming;
+		for (int32 Start = 0; Start < Message.Len();)
+		{
+			int32 End = Message.Find(TEXT(" "), ESearchCase::CaseSensitive, ESearchDir::FromStart, Start);
+			End = End == INDEX_NONE ? Message.Len() : End;
+			FMixerJsonSpan& Span = Incoming[Incoming.AddDefaulted()];
+			Span.Start = *Message + Start;
+			Span.Length = End - Start;
+			Span.Kind = EMixerJsonValueKind::String;
+			Start = End + 1;
+		}
+
+		int64 MapChecksum = 0;
+		const double MapStart = FPlatformTime::Seconds();
+		for (int32 i = 0; i < Iterations; ++i)
+		{
+			// The map needed the subtype copied out of the message first
+			const int32* Found = Map.Find(Incoming[i % Incoming.Num()].ToString());
+			MapChecksum += Found != nullptr ? *Found : -1;
+		}
+		const double MapSeconds = FPlatformTime::Seconds() - MapStart;
+
+		int64 TableChecksum = 0;
+		const double TableStart = FPlatformTime::Seconds();
+		for (int32 i = 0; i < Iterations; ++i)
+		{
+			const int32* Found = Table.Find(Incoming[i % Incoming.Num()]);
+			TableChecksum += Found != nullptr ? *Found : -1;
+		}
+		const double TableSeconds = FPlatformTime::Seconds() - TableStart;
+
+		UE_LOG(LogMixerInteractivity, Display, TEXT("Handler lookup x%d: TMap %.2fms (%.1fns/lookup), perfect hash %.2fms (%.1fns/lookup), speedup %.1fx%s"),
+			Iterations,
+			MapSeconds * 1000.0, MapSeconds * 1.0e9 / Iterations,
+			TableSeconds * 1000.0, TableSeconds * 1.0e9 / Iterations,
+			TableSeconds > 0.0 ? MapSeconds / TableSeconds : 0.0,
+			MapChecksum == TableChecksum ? TEXT("") : TEXT(" (RESULTS DIFFER)"));
+	}
+
+	FAutoConsoleCommand BenchmarkHandlerLookupCommand(
+		TEXT("Mixer.BenchmarkHandlerLookup"),
+		TEXT("Time server message handler lookup against the previous TMap based implementation.  Optional argument: iteration count."),
+		FConsoleCommandWithArgsDelegate::CreateStatic(&BenchmarkHandlerLookup));
+}
+
+#endif
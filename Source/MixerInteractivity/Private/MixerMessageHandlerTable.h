@@ -0,0 +1,150 @@
+//*********************************************************
+//
+// Copyright (c) Microsoft. All rights reserved.
+// THIS CODE IS PROVIDED *AS IS* WITHOUT WARRANTY OF
+// ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING ANY
+// IMPLIED WARRANTIES OF FITNESS FOR A PARTICULAR
+// PURPOSE, MERCHANTABILITY, OR NON-INFRINGEMENT.
+//
+//*********************************************************
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MixerJsonStreamReader.h"
+
+/** Case-insensitive FNV-1a over a run of characters, matching FString's comparison rules for ASCII keys. */
+inline uint32 MixerHashMessageName(const TCHAR* Chars, int32 Length, uint32 Seed)
+{
+	uint32 Hash = 2166136261u ^ Seed;
+	for (int32 i = 0; i < Length; ++i)
+	{
+		Hash = (Hash ^ static_cast<uint32>(FChar::ToLower(Chars[i]))) * 16777619u;
+	}
+	return Hash;
+}
+
+/**
+* Maps message names to handlers using a perfect hash that is recomputed whenever
+* the set of names changes.  Lookups hash the name straight out of the raw message,
+* probe exactly one slot and do at most one comparison, so routing a message never
+* allocates an FString.
+*
+* Registration is expected to happen in a burst (RegisterAllServerMessageHandlers)
+* while lookups happen for every incoming message, so Add is deliberately slow.
+*/
+template <typename EntryType>
+class TMixerMessageHandlerTable
+{
+public:
+	TMixerMessageHandlerTable()
+		: Seed(0)
+		, SlotMask(0)
+	{
+	}
+
+	/** Returns the entry for Name, which may have been newly default-constructed. */
+	EntryType& Add(const FString& Name)
+	{
+		int32 Index = Names.IndexOfByKey(Name);
+		if (Index == INDEX_NONE)
+		{
+			Index = Names.Add(Name);
+			Entries.AddDefaulted();
+			Rebuild();
+		}
+		return Entries[Index];
+	}
+
+	void Empty()
+	{
+		Names.Empty();
+		Entries.Empty();
+		Slots.Empty();
+		Seed = 0;
+		SlotMask = 0;
+	}
+
+	int32 Num() const
+	{
+		return Names.Num();
+	}
+
+	EntryType* Find(const TCHAR* Chars, int32 Length)
+	{
+		if (Slots.Num() == 0)
+		{
+			return nullptr;
+		}
+
+		const int32 Index = Slots[MixerHashMessageName(Chars, Length, Seed) & SlotMask];
+		if (Index == INDEX_NONE)
+		{
+			return nullptr;
+		}
+
+		const FString& Candidate = Names[Index];
+		return Candidate.Len() == Length && FCString::Strnicmp(*Candidate, Chars, Length) == 0 ? &Entries[Index] : nullptr;
+	}
+
+	EntryType* Find(const FMixerJsonSpan& Name)
+	{
+		if (Name.bHasEscapes)
+		{
+			return Find(Name.ToString());
+		}
+		return Find(Name.Start, Name.Length);
+	}
+
+	EntryType* Find(const FString& Name)
+	{
+		return Find(*Name, Name.Len());
+	}
+
+private:
+	void Rebuild()
+	{
+		// Start with a load factor of at most 1/2 and grow until some seed places every name in its own slot.
+		// For the dozen or so names a connection registers that takes at most a few dozen attempts.
+		const uint32 MaxSeedAttempts = 64;
+		int32 NumSlots = FMath::RoundUpToPowerOfTwo(FMath::Max(Names.Num() * 2, 2));
+		for (;;)
+		{
+			Slots.Init(INDEX_NONE, NumSlots);
+			SlotMask = NumSlots - 1;
+			for (uint32 CandidateSeed = 0; CandidateSeed < MaxSeedAttempts; ++CandidateSeed)
+			{
+				if (TryBuild(CandidateSeed))
+				{
+					Seed = CandidateSeed;
+					return;
+				}
+			}
+			NumSlots *= 2;
+		}
+	}
+
+	bool TryBuild(uint32 CandidateSeed)
+	{
+		for (int32& Slot : Slots)
+		{
+			Slot = INDEX_NONE;
+		}
+
+		for (int32 i = 0; i < Names.Num(); ++i)
+		{
+			int32& Slot = Slots[MixerHashMessageName(*Names[i], Names[i].Len(), CandidateSeed) & SlotMask];
+			if (Slot != INDEX_NONE)
+			{
+				return false;
+			}
+			Slot = i;
+		}
+		return true;
+	}
+
+	TArray<FString> Names;
+	TArray<EntryType> Entries;
+	TArray<int32> Slots;
+	uint32 Seed;
+	uint32 SlotMask;
+};
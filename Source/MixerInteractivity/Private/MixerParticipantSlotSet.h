@@ -0,0 +1,136 @@
+//*********************************************************
+//
+// Copyright (c) Microsoft. All rights reserved.
+// THIS CODE IS PROVIDED *AS IS* WITHOUT WARRANTY OF
+// ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING ANY
+// IMPLIED WARRANTIES OF FITNESS FOR A PARTICULAR
+// PURPOSE, MERCHANTABILITY, OR NON-INFRINGEMENT.
+//
+//*********************************************************
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+* Set of FMixerParticipantTable slots stored one bit per slot.
+*
+* Set operations work a 64-bit word at a time over plain loops with no
+* cross-iteration dependencies, which the compiler is free to vectorize.
+*/
+class FMixerParticipantSlotSet
+{
+public:
+	FMixerParticipantSlotSet()
+		: Count(0)
+	{
+	}
+
+	/** @Return	True if the slot wasn't already in the set. */
+	bool Add(int32 Slot)
+	{
+		check(Slot >= 0);
+		const int32 WordIndex = Slot / BitsPerWord;
+		if (WordIndex >= Words.Num())
+		{
+			Words.AddZeroed(WordIndex + 1 - Words.Num());
+		}
+
+		const uint64 Mask = 1ull << (Slot % BitsPerWord);
+		if ((Words[WordIndex] & Mask) == 0)
+		{
+			Words[WordIndex] |= Mask;
+			++Count;
+			return true;
+		}
+		return false;
+	}
+
+	/** @Return	True if the slot was in the set. */
+	bool Remove(int32 Slot)
+	{
+		const int32 WordIndex = Slot / BitsPerWord;
+		const uint64 Mask = 1ull << (Slot % BitsPerWord);
+		if (Words.IsValidIndex(WordIndex) && (Words[WordIndex] & Mask) != 0)
+		{
+			Words[WordIndex] &= ~Mask;
+			--Count;
+			return true;
+		}
+		return false;
+	}
+
+	bool Contains(int32 Slot) const
+	{
+		const int32 WordIndex = Slot / BitsPerWord;
+		return Words.IsValidIndex(WordIndex) && (Words[WordIndex] & (1ull << (Slot % BitsPerWord))) != 0;
+	}
+
+	int32 Num() const { return Count; }
+
+	void Empty()
+	{
+		Words.Empty();
+		Count = 0;
+	}
+
+	/** Number of slots in both this set and Other. */
+	int32 CountIntersection(const FMixerParticipantSlotSet& Other) const
+	{
+		const int32 NumWords = FMath::Min(Words.Num(), Other.Words.Num());
+		const uint64* RESTRICT A = Words.GetData();
+		const uint64* RESTRICT B = Other.Words.GetData();
+		int32 Result = 0;
+		for (int32 i = 0; i < NumWords; ++i)
+		{
+			Result += CountBits(A[i] & B[i]);
+		}
+		return Result;
+	}
+
+	/** Remove every slot that isn't also in Other. */
+	void IntersectWith(const FMixerParticipantSlotSet& Other)
+	{
+		const int32 NumWords = FMath::Min(Words.Num(), Other.Words.Num());
+		Words.SetNum(NumWords, false);
+
+		uint64* RESTRICT A = Words.GetData();
+		const uint64* RESTRICT B = Other.Words.GetData();
+		int32 NewCount = 0;
+		for (int32 i = 0; i < NumWords; ++i)
+		{
+			A[i] &= B[i];
+			NewCount += CountBits(A[i]);
+		}
+		Count = NewCount;
+	}
+
+	/** Call Func(int32 Slot) for each slot in the set, in ascending order. */
+	template <typename FuncType>
+	void ForEachSlot(FuncType Func) const
+	{
+		for (int32 WordIndex = 0; WordIndex < Words.Num(); ++WordIndex)
+		{
+			uint64 Word = Words[WordIndex];
+			while (Word != 0)
+			{
+				const uint64 LowestBit = Word & (~Word + 1);
+				Func(WordIndex * BitsPerWord + CountBits(LowestBit - 1));
+				Word ^= LowestBit;
+			}
+		}
+	}
+
+private:
+	static const int32 BitsPerWord = 64;
+
+	static int32 CountBits(uint64 Word)
+	{
+		Word = Word - ((Word >> 1) & 0x5555555555555555ull);
+		Word = (Word & 0x3333333333333333ull) + ((Word >> 2) & 0x3333333333333333ull);
+		Word = (Word + (Word >> 4)) & 0x0F0F0F0F0F0F0F0Full;
+		return static_cast<int32>((Word * 0x0101010101010101ull) >> 56);
+	}
+
+	TArray<uint64> Words;
+	int32 Count;
+};
@@ -0,0 +1,701 @@
+//*********************************************************
+//
+// Copyright (c) Microsoft. All rights reserved.
+// THIS CODE IS PROVIDED *AS IS* WITHOUT WARRANTY OF
+// ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING ANY
+// IMPLIED WARRANTIES OF FITNESS FOR A PARTICULAR
+// PURPOSE, MERCHANTABILITY, OR NON-INFRINGEMENT.
+//
+//*********************************************************
+#include "MixerParticipantTable.h"
+#include "MixerInteractivityLog.h"
+#include "Containers/StringConv.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+
+namespace
+{
+	/** Don't bother compacting the name pool until at least this much of it is garbage. */
+	const int32 MinNamePoolWasteToCompact = 64 * 1024;
+
+	const int32 MinViewedSlotsPruneThreshold = 64;
+
+	const int32 MinSessionIdBuckets = 64;
+
+	bool SessionIdTextEquals(const ANSICHAR* StoredText, const ANSICHAR* Text, int32 Length)
+	{
+		return FMemory::Memcmp(StoredText, Text, Length) == 0;
+	}
+
+	/** Text must be ASCII, which is encoded the same in UTF-8. */
+	bool SessionIdTextEquals(const ANSICHAR* StoredText, const TCHAR* Text, int32 Length)
+	{
+		for (int32 i = 0; i < Length; ++i)
+		{
+			if (static_cast<uint8>(StoredText[i]) != static_cast<uint32>(Text[i]))
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+}
+
+FMixerParticipantTable::FMixerParticipantTable()
+	: NumParticipants(0)
+	, NamePoolWaste(0)
+	, NumSessionIdTexts(0)
+	, ViewedSlotsPruneThreshold(MinViewedSlotsPruneThreshold)
+{
+}
+
+FMixerParticipantHandle FMixerParticipantTable::Add(const FMixerRemoteUser& User)
+{
+	const int32* ExistingSlot = SlotsBySessionGuid.Find(User.SessionGuid);
+	if (ExistingSlot != nullptr)
+	{
+		const FMixerParticipantHandle Handle(*ExistingSlot, Generations[*ExistingSlot]);
+		Update(Handle, User);
+		return Handle;
+	}
+
+	// A viewer rejoining from elsewhere gets a new session; the old one is gone
+	const int32* StaleSlot = SlotsByUserId.Find(static_cast<uint32>(User.Id));
+	if (StaleSlot != nullptr)
+	{
+		Remove(FMixerParticipantHandle(*StaleSlot, Generations[*StaleSlot]));
+	}
+
+	int32 Slot;
+	if (FreeSlots.Num() > 0)
+	{
+		Slot = FreeSlots.Pop(false);
+	}
+	else
+	{
+		Slot = Generations.Add(0);
+		Occupied.Add(false);
+		UserIds.AddUninitialized();
+		SessionGuids.AddUninitialized();
+		SlotGroups.Add(INDEX_NONE);
+		NextInGroup.Add(INDEX_NONE);
+		PrevInGroup.Add(INDEX_NONE);
+		InputEnabled.Add(false);
+		Levels.AddUninitialized();
+		ConnectedAt.AddUninitialized();
+		InputAt.AddUninitialized();
+		NameSpans.AddZeroed();
+		SessionIdSpans.AddZeroed();
+		NextInSessionIdBucket.Add(INDEX_NONE);
+		SessionIdHashes.AddUninitialized();
+		Views.AddDefaulted();
+		ViewedSlotFlags.Add(false);
+	}
+
+	Occupied[Slot] = true;
+	++NumParticipants;
+	SessionGuids[Slot] = User.SessionGuid;
+	WriteSlot(Slot, User);
+
+	SlotsBySessionGuid.Add(User.SessionGuid, Slot);
+	SlotsByUserId.Add(static_cast<uint32>(User.Id), Slot);
+	return FMixerParticipantHandle(Slot, Generations[Slot]);
+}
+
+void FMixerParticipantTable::Update(FMixerParticipantHandle Handle, const FMixerRemoteUser& User)
+{
+	check(IsValid(Handle));
+	const int32 Slot = Handle.Slot;
+	if (UserIds[Slot] != static_cast<uint32>(User.Id))
+	{
+		SlotsByUserId.Remove(UserIds[Slot]);
+		SlotsByUserId.Add(static_cast<uint32>(User.Id), Slot);
+	}
+	WriteSlot(Slot, User);
+}
+
+bool FMixerParticipantTable::Remove(FMixerParticipantHandle Handle)
+{
+	if (!IsValid(Handle))
+	{
+		return false;
+	}
+
+	const int32 Slot = Handle.Slot;
+	SlotsBySessionGuid.Remove(SessionGuids[Slot]);
+	SlotsByUserId.Remove(UserIds[Slot]);
+
+	// Anyone still holding the view keeps it as a snapshot of the participant as they left
+	Views[Slot].Reset();
+	UnlinkFromGroup(Slot);
+	NamePoolWaste += NameSpans[Slot].Length;
+	NameSpans[Slot].Offset = 0;
+	NameSpans[Slot].Length = 0;
+	if (SessionIdSpans[Slot].Length > 0)
+	{
+		UnlinkSessionIdText(Slot);
+		NamePoolWaste += SessionIdSpans[Slot].Length;
+		SessionIdSpans[Slot].Offset = 0;
+		SessionIdSpans[Slot].Length = 0;
+	}
+
+	Occupied[Slot] = false;
+	++Generations[Slot];
+	FreeSlots.Add(Slot);
+	--NumParticipants;
+	return true;
+}
+
+void FMixerParticipantTable::Empty()
+{
+	Generations.Empty();
+	Occupied.Empty();
+	FreeSlots.Empty();
+	NumParticipants = 0;
+
+	UserIds.Empty();
+	SessionGuids.Empty();
+	SlotGroups.Empty();
+	NextInGroup.Empty();
+	PrevInGroup.Empty();
+	InputEnabled.Empty();
+	Levels.Empty();
+	ConnectedAt.Empty();
+	InputAt.Empty();
+	NameSpans.Empty();
+	SessionIdSpans.Empty();
+
+	NamePool.Empty();
+	NamePoolWaste = 0;
+
+	SessionIdBuckets.Empty();
+	NextInSessionIdBucket.Empty();
+	SessionIdHashes.Empty();
+	NumSessionIdTexts = 0;
+
+	Views.Empty();
+	ViewedSlots.Empty();
+	ViewedSlotFlags.Empty();
+	ViewedSlotsPruneThreshold = MinViewedSlotsPruneThreshold;
+
+	GroupEntries.Empty();
+	GroupsByName.Empty();
+
+	SlotsBySessionGuid.Empty();
+	SlotsByUserId.Empty();
+}
+
+FMixerParticipantHandle FMixerParticipantTable::FindByUserId(uint32 UserId) const
+{
+	const int32* Slot = SlotsByUserId.Find(UserId);
+	return Slot != nullptr ? FMixerParticipantHandle(*Slot, Generations[*Slot]) : FMixerParticipantHandle();
+}
+
+FMixerParticipantHandle FMixerParticipantTable::FindBySessionGuid(const FGuid& SessionGuid) const
+{
+	const int32* Slot = SlotsBySessionGuid.Find(SessionGuid);
+	return Slot != nullptr ? FMixerParticipantHandle(*Slot, Generations[*Slot]) : FMixerParticipantHandle();
+}
+
+void FMixerParticipantTable::SetSessionIdText(FMixerParticipantHandle Handle, const ANSICHAR* Utf8SessionId, int32 Length)
+{
+	check(IsValid(Handle));
+	const int32 Slot = Handle.Slot;
+	FNameSpan& Span = SessionIdSpans[Slot];
+	if (Span.Length == Length && FMemory::Memcmp(NamePool.GetData() + Span.Offset, Utf8SessionId, Length) == 0)
+	{
+		return;
+	}
+
+	if (Span.Length > 0)
+	{
+		UnlinkSessionIdText(Slot);
+		NamePoolWaste += Span.Length;
+	}
+
+	Span.Offset = NamePool.Num();
+	Span.Length = Length;
+	NamePool.Append(Utf8SessionId, Length);
+	SessionIdHashes[Slot] = HashSessionIdText(Utf8SessionId, Length);
+	if (Length > 0)
+	{
+		LinkSessionIdText(Slot);
+	}
+}
+
+FMixerParticipantHandle FMixerParticipantTable::FindBySessionIdText(const ANSICHAR* Utf8SessionId, int32 Length) const
+{
+	if (NumSessionIdTexts == 0)
+	{
+		return FMixerParticipantHandle();
+	}
+
+	return LookupSessionIdText(Utf8SessionId, Length);
+}
+
+FMixerParticipantHandle FMixerParticipantTable::FindBySessionIdText(const TCHAR* SessionId, int32 Length) const
+{
+	if (NumSessionIdTexts == 0)
+	{
+		return FMixerParticipantHandle();
+	}
+
+	for (int32 i = 0; i < Length; ++i)
+	{
+		if (static_cast<uint32>(SessionId[i]) >= 0x80)
+		{
+			FTCHARToUTF8 Utf8SessionId(SessionId, Length);
+			return LookupSessionIdText(reinterpret_cast<const ANSICHAR*>(Utf8SessionId.Get()), Utf8SessionId.Length());
+		}
+	}
+
+	return LookupSessionIdText(SessionId, Length);
+}
+
+template <typename CharType>
+FMixerParticipantHandle FMixerParticipantTable::LookupSessionIdText(const CharType* SessionId, int32 Length) const
+{
+	const uint32 Hash = HashSessionIdText(SessionId, Length);
+	for (int32 Slot = SessionIdBuckets[Hash & (SessionIdBuckets.Num() - 1)]; Slot != INDEX_NONE; Slot = NextInSessionIdBucket[Slot])
+	{
+		const FNameSpan& Span = SessionIdSpans[Slot];
+		if (SessionIdHashes[Slot] == Hash
+			&& Span.Length == Length
+			&& SessionIdTextEquals(NamePool.GetData() + Span.Offset, SessionId, Length))
+		{
+			return FMixerParticipantHandle(Slot, Generations[Slot]);
+		}
+	}
+	return FMixerParticipantHandle();
+}
+
+void FMixerParticipantTable::GetUser(FMixerParticipantHandle Handle, FMixerRemoteUser& OutUser) const
+{
+	check(IsValid(Handle));
+	ReadSlot(Handle.Slot, OutUser);
+}
+
+TSharedPtr<const FMixerRemoteUser> FMixerParticipantTable::GetView(FMixerParticipantHandle Handle)
+{
+	if (!IsValid(Handle))
+	{
+		return nullptr;
+	}
+
+	TSharedPtr<FMixerRemoteUser> View = Views[Handle.Slot].Pin();
+	if (!View.IsValid())
+	{
+		View = MakeShared<FMixerRemoteUser>();
+		ReadSlot(Handle.Slot, *View);
+		Views[Handle.Slot] = View;
+
+		if (!ViewedSlotFlags[Handle.Slot])
+		{
+			ViewedSlotFlags[Handle.Slot] = true;
+			ViewedSlots.Add(Handle.Slot);
+			if (ViewedSlots.Num() > ViewedSlotsPruneThreshold)
+			{
+				PruneViewedSlots();
+			}
+		}
+	}
+	return View;
+}
+
+bool FMixerParticipantTable::GetViewsInGroup(FName Group, TArray<TSharedPtr<const FMixerRemoteUser>>& OutViews)
+{
+	const int32* GroupIndex = GroupsByName.Find(Group);
+	if (GroupIndex == nullptr)
+	{
+		return false;
+	}
+
+	const FGroupEntry& Entry = GroupEntries[*GroupIndex];
+	OutViews.Reserve(OutViews.Num() + Entry.Num);
+	for (int32 Slot = Entry.FirstSlot; Slot != INDEX_NONE; Slot = NextInGroup[Slot])
+	{
+		OutViews.Add(GetView(FMixerParticipantHandle(Slot, Generations[Slot])));
+	}
+	return true;
+}
+
+bool FMixerParticipantTable::GetUserIdsInGroup(FName Group, TArray<uint32>& OutUserIds) const
+{
+	const int32* GroupIndex = GroupsByName.Find(Group);
+	if (GroupIndex == nullptr)
+	{
+		return false;
+	}
+
+	const FGroupEntry& Entry = GroupEntries[*GroupIndex];
+	OutUserIds.Reserve(OutUserIds.Num() + Entry.Num);
+	for (int32 Slot = Entry.FirstSlot; Slot != INDEX_NONE; Slot = NextInGroup[Slot])
+	{
+		OutUserIds.Add(UserIds[Slot]);
+	}
+	return true;
+}
+
+bool FMixerParticipantTable::GetSlotsInGroup(FName Group, FMixerParticipantSlotSet& OutSlots) const
+{
+	const int32* GroupIndex = GroupsByName.Find(Group);
+	if (GroupIndex == nullptr)
+	{
+		return false;
+	}
+
+	for (int32 Slot = GroupEntries[*GroupIndex].FirstSlot; Slot != INDEX_NONE; Slot = NextInGroup[Slot])
+	{
+		OutSlots.Add(Slot);
+	}
+	return true;
+}
+
+int32 FMixerParticipantTable::GetNumInGroup(FName Group) const
+{
+	const int32* GroupIndex = GroupsByName.Find(Group);
+	return GroupIndex != nullptr ? GroupEntries[*GroupIndex].Num : 0;
+}
+
+void FMixerParticipantTable::ReassignGroup(FName FromGroup, FName ToGroup)
+{
+	int32 FromIndex;
+	if (FromGroup == ToGroup || !GroupsByName.RemoveAndCopyValue(FromGroup, FromIndex))
+	{
+		return;
+	}
+
+	const int32 ToIndex = FindOrAddGroup(ToGroup);
+	FGroupEntry& From = GroupEntries[FromIndex];
+	FGroupEntry& To = GroupEntries[ToIndex];
+	if (From.FirstSlot != INDEX_NONE)
+	{
+		if (To.LastSlot != INDEX_NONE)
+		{
+			NextInGroup[To.LastSlot] = From.FirstSlot;
+			PrevInGroup[From.FirstSlot] = To.LastSlot;
+		}
+		else
+		{
+			To.FirstSlot = From.FirstSlot;
+		}
+		To.LastSlot = From.LastSlot;
+		To.Num += From.Num;
+	}
+
+	// Members still point at the old entry; ResolveGroup follows it to the new one
+	From.MergedInto = ToIndex;
+	From.FirstSlot = INDEX_NONE;
+	From.LastSlot = INDEX_NONE;
+	From.Num = 0;
+
+	for (int32 Slot : ViewedSlots)
+	{
+		TSharedPtr<FMixerRemoteUser> View = Views[Slot].Pin();
+		if (View.IsValid() && View->Group == FromGroup)
+		{
+			View->Group = ToGroup;
+		}
+	}
+}
+
+int32 FMixerParticipantTable::FindOrAddGroup(FName Group)
+{
+	const int32* ExistingIndex = GroupsByName.Find(Group);
+	if (ExistingIndex != nullptr)
+	{
+		return *ExistingIndex;
+	}
+
+	const int32 NewIndex = GroupEntries.AddUninitialized();
+	FGroupEntry& Entry = GroupEntries[NewIndex];
+	Entry.Name = Group;
+	Entry.MergedInto = INDEX_NONE;
+	Entry.FirstSlot = INDEX_NONE;
+	Entry.LastSlot = INDEX_NONE;
+	Entry.Num = 0;
+	GroupsByName.Add(Group, NewIndex);
+	return NewIndex;
+}
+
+int32 FMixerParticipantTable::ResolveGroup(int32 GroupIndex) const
+{
+	while (GroupEntries[GroupIndex].MergedInto != INDEX_NONE)
+	{
+		GroupIndex = GroupEntries[GroupIndex].MergedInto;
+	}
+	return GroupIndex;
+}
+
+void FMixerParticipantTable::LinkToGroup(int32 Slot, FName Group)
+{
+	const int32 GroupIndex = FindOrAddGroup(Group);
+	FGroupEntry& Entry = GroupEntries[GroupIndex];
+	NextInGroup[Slot] = INDEX_NONE;
+	PrevInGroup[Slot] = Entry.LastSlot;
+	if (Entry.LastSlot != INDEX_NONE)
+	{
+		NextInGroup[Entry.LastSlot] = Slot;
+	}
+	else
+	{
+		Entry.FirstSlot = Slot;
+	}
+	Entry.LastSlot = Slot;
+	++Entry.Num;
+	SlotGroups[Slot] = GroupIndex;
+}
+
+void FMixerParticipantTable::UnlinkFromGroup(int32 Slot)
+{
+	if (SlotGroups[Slot] == INDEX_NONE)
+	{
+		return;
+	}
+
+	FGroupEntry& Entry = GroupEntries[ResolveGroup(SlotGroups[Slot])];
+	const int32 Prev = PrevInGroup[Slot];
+	const int32 Next = NextInGroup[Slot];
+	if (Prev != INDEX_NONE)
+	{
+		NextInGroup[Prev] = Next;
+	}
+	else
+	{
+		Entry.FirstSlot = Next;
+	}
+	if (Next != INDEX_NONE)
+	{
+		PrevInGroup[Next] = Prev;
+	}
+	else
+	{
+		Entry.LastSlot = Prev;
+	}
+	--Entry.Num;
+	SlotGroups[Slot] = INDEX_NONE;
+}
+
+void FMixerParticipantTable::PruneViewedSlots()
+{
+	for (int32 i = ViewedSlots.Num() - 1; i >= 0; --i)
+	{
+		const int32 Slot = ViewedSlots[i];
+		if (!Views[Slot].IsValid())
+		{
+			ViewedSlotFlags[Slot] = false;
+			ViewedSlots.RemoveAtSwap(i, 1, false);
+		}
+	}
+	ViewedSlotsPruneThreshold = FMath::Max(ViewedSlots.Num() * 2, MinViewedSlotsPruneThreshold);
+}
+
+void FMixerParticipantTable::WriteSlot(int32 Slot, const FMixerRemoteUser& User)
+{
+	UserIds[Slot] = static_cast<uint32>(User.Id);
+	if (SlotGroups[Slot] == INDEX_NONE || GroupEntries[ResolveGroup(SlotGroups[Slot])].Name != User.Group)
+	{
+		UnlinkFromGroup(Slot);
+		LinkToGroup(Slot, User.Group);
+	}
+	InputEnabled[Slot] = User.InputEnabled;
+	Levels[Slot] = User.Level;
+	ConnectedAt[Slot] = User.ConnectedAt;
+	InputAt[Slot] = User.InputAt;
+	SetName(Slot, User.Name);
+
+	TSharedPtr<FMixerRemoteUser> View = Views[Slot].Pin();
+	if (View.IsValid())
+	{
+		ReadSlot(Slot, *View);
+	}
+}
+
+void FMixerParticipantTable::ReadSlot(int32 Slot, FMixerRemoteUser& OutUser) const
+{
+	OutUser.Id = static_cast<int32>(UserIds[Slot]);
+	OutUser.SessionGuid = SessionGuids[Slot];
+	OutUser.Group = GroupEntries[ResolveGroup(SlotGroups[Slot])].Name;
+	OutUser.InputEnabled = InputEnabled[Slot];
+	OutUser.Level = Levels[Slot];
+	OutUser.ConnectedAt = ConnectedAt[Slot];
+	OutUser.InputAt = InputAt[Slot];
+
+	const FNameSpan& Span = NameSpans[Slot];
+	FUTF8ToTCHAR Converted(NamePool.GetData() + Span.Offset, Span.Length);
+	OutUser.Name = FString(Converted.Length(), Converted.Get());
+}
+
+void FMixerParticipantTable::SetName(int32 Slot, const FString& Name)
+{
+	FTCHARToUTF8 Converted(*Name, Name.Len());
+	FNameSpan& Span = NameSpans[Slot];
+
+	// Participant updates almost never rename anyone
+	if (Span.Length == Converted.Length() && FMemory::Memcmp(NamePool.GetData() + Span.Offset, Converted.Get(), Span.Length) == 0)
+	{
+		return;
+	}
+
+	NamePoolWaste += Span.Length;
+	Span.Offset = NamePool.Num();
+	Span.Length = Converted.Length();
+	NamePool.Append(reinterpret_cast<const ANSICHAR*>(Converted.Get()), Converted.Length());
+
+	if (NamePoolWaste >= MinNamePoolWasteToCompact && NamePoolWaste * 2 >= NamePool.Num())
+	{
+		CompactNamePool();
+	}
+}
+
+void FMixerParticipantTable::CompactNamePool()
+{
+	TArray<ANSICHAR> CompactedPool;
+	CompactedPool.Reserve(NamePool.Num() - NamePoolWaste);
+	auto MoveToCompactedPool = [this, &CompactedPool](FNameSpan& Span)
+	{
+		if (Span.Length > 0)
+		{
+			const int32 NewOffset = CompactedPool.Num();
+			CompactedPool.Append(NamePool.GetData() + Span.Offset, Span.Length);
+			Span.Offset = NewOffset;
+		}
+	};
+
+	for (int32 Slot = 0; Slot < NameSpans.Num(); ++Slot)
+	{
+		if (Occupied[Slot])
+		{
+			MoveToCompactedPool(NameSpans[Slot]);
+			MoveToCompactedPool(SessionIdSpans[Slot]);
+		}
+	}
+	NamePool = MoveTemp(CompactedPool);
+	NamePoolWaste = 0;
+}
+
+template <typename CharType>
+uint32 FMixerParticipantTable::HashSessionIdText(const CharType* SessionId, int32 Length)
+{
+	// FNV-1a over the UTF-8 bytes, so ASCII text hashes the same whatever its character type
+	uint32 Hash = 2166136261u;
+	for (int32 i = 0; i < Length; ++i)
+	{
+		Hash = (Hash ^ static_cast<uint8>(SessionId[i])) * 16777619u;
+	}
+	return Hash;
+}
+
+void FMixerParticipantTable::LinkSessionIdText(int32 Slot)
+{
+	++NumSessionIdTexts;
+	if (NumSessionIdTexts > SessionIdBuckets.Num())
+	{
+		RehashSessionIdText(FMath::Max(SessionIdBuckets.Num() * 2, MinSessionIdBuckets));
+	}
+	else
+	{
+		int32& Bucket = SessionIdBuckets[SessionIdHashes[Slot] & (SessionIdBuckets.Num() - 1)];
+		NextInSessionIdBucket[Slot] = Bucket;
+		Bucket = Slot;
+	}
+}
+
+void FMixerParticipantTable::UnlinkSessionIdText(int32 Slot)
+{
+	int32* Link = &SessionIdBuckets[SessionIdHashes[Slot] & (SessionIdBuckets.Num() - 1)];
+	while (*Link != Slot)
+	{
+		check(*Link != INDEX_NONE);
+		Link = &NextInSessionIdBucket[*Link];
+	}
+	*Link = NextInSessionIdBucket[Slot];
+	NextInSessionIdBucket[Slot] = INDEX_NONE;
+	--NumSessionIdTexts;
+}
+
+void FMixerParticipantTable::RehashSessionIdText(int32 NumBuckets)
+{
+	check(FMath::IsPowerOfTwo(NumBuckets));
+	SessionIdBuckets.Init(INDEX_NONE, NumBuckets);
+	for (int32 Slot = 0; Slot < SessionIdSpans.Num(); ++Slot)
+	{
+		if (Occupied[Slot] && SessionIdSpans[Slot].Length > 0)
+		{
+			int32& Bucket = SessionIdBuckets[SessionIdHashes[Slot] & (NumBuckets - 1)];
+			NextInSessionIdBucket[Slot] = Bucket;
+			Bucket = Slot;
+		}
+	}
+}
+
+#if !UE_BUILD_SHIPPING
+
+namespace
+{
+	/** Compares attributing input through the session id text index against parsing the id as a guid first. */
+	void BenchmarkParticipantLookup(const TArray<FString>& Args)
+	{
+		const int32 NumParticipants = Args.Num() > 0 ? FMath::Max(FCString::Atoi(*Args[0]), 1) : 10000;
+		const int32 Iterations = Args.Num() > 1 ? FMath::Max(FCString::Atoi(*Args[1]), 1) : 1000000;
+
+		FMixerParticipantTable Table;
+		TArray<FString> Ids;
+		TArray<ANSICHAR> Utf8Pool;
+		TArray<int32> Utf8Offsets;
+		for (int32 i = 0; i < NumParticipants; ++i)
+		{
+			FMixerRemoteUser User;
+			User.Id = i + 1;
+			User.Name = FString::Printf(TEXT("Viewer%d"), i);
+			User.SessionGuid = FGuid::NewGuid();
+			User.Group = NAME_DefaultMixerParticipantGroup;
+			User.InputEnabled = true;
+
+			// The service sends lower case hyphenated guids
+			const FString IdText = User.SessionGuid.ToString(EGuidFormats::DigitsWithHyphens).ToLower();
+			FTCHARToUTF8 Utf8IdText(*IdText, IdText.Len());
+			Utf8Offsets.Add(Utf8Pool.Num());
+			Utf8Pool.Append(reinterpret_cast<const ANSICHAR*>(Utf8IdText.Get()), Utf8IdText.Length());
+
+			const FMixerParticipantHandle Handle = Table.Add(User);
+			Table.SetSessionIdText(Handle, reinterpret_cast<const ANSICHAR*>(Utf8IdText.Get()), Utf8IdText.Length());
+			Ids.Add(IdText);
+		}
+		const int32 IdLength = Ids[0].Len();
+
+		int64 GuidChecksum = 0;
+		const double GuidStart = FPlatformTime::Seconds();
+		for (int32 i = 0; i < Iterations; ++i)
+		{
+			// What every input paid before: parse the id out of the message, then look up the guid
+			FGuid SessionGuid;
+			FGuid::Parse(Ids[i % NumParticipants], SessionGuid);
+			GuidChecksum += Table.FindBySessionGuid(SessionGuid).Slot;
+		}
+		const double GuidSeconds = FPlatformTime::Seconds() - GuidStart;
+
+		int64 TextChecksum = 0;
+		const double TextStart = FPlatformTime::Seconds();
+		for (int32 i = 0; i < Iterations; ++i)
+		{
+			TextChecksum += Table.FindBySessionIdText(Utf8Pool.GetData() + Utf8Offsets[i % NumParticipants], IdLength).Slot;
+		}
+		const double TextSeconds = FPlatformTime::Seconds() - TextStart;
+
+		UE_LOG(LogMixerInteractivity, Display, TEXT("Participant lookup x%d over %d participants: guid parse %.2fms (%.1fns/input), session id text %.2fms (%.1fns/input, %.0f inputs/sec), speedup %.1fx%s"),
+			Iterations, NumParticipants,
+			GuidSeconds * 1000.0, GuidSeconds * 1.0e9 / Iterations,
+			TextSeconds * 1000.0, TextSeconds * 1.0e9 / Iterations,
+			TextSeconds > 0.0 ? Iterations / TextSeconds : 0.0,
+			TextSeconds > 0.0 ? GuidSeconds / TextSeconds : 0.0,
+			GuidChecksum == TextChecksum ? TEXT("") : TEXT(" (RESULTS DIFFER)"));
+	}
+
+	FAutoConsoleCommand BenchmarkParticipantLookupCommand(
+		TEXT("Mixer.BenchmarkParticipantLookup"),
+		TEXT("Time attributing input to participants by session id text against parsing it as a guid.  Optional arguments: participant count, iteration count."),
+		FConsoleCommandWithArgsDelegate::CreateStatic(&BenchmarkParticipantLookup));
+}
+
+#endif
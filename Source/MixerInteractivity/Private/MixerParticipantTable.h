@@ -0,0 +1,215 @@
+//*********************************************************
+//
+// Copyright (c) Microsoft. All rights reserved.
+// THIS CODE IS PROVIDED *AS IS* WITHOUT WARRANTY OF
+// ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING ANY
+// IMPLIED WARRANTIES OF FITNESS FOR A PARTICULAR
+// PURPOSE, MERCHANTABILITY, OR NON-INFRINGEMENT.
+//
+//*********************************************************
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MixerInteractivityTypes.h"
+#include "MixerParticipantSlotSet.h"
+
+/**
+* Refers to a participant in FMixerParticipantTable.  The generation makes handles to
+* participants that have since left invalid, even once their slot has been reused.
+*/
+struct FMixerParticipantHandle
+{
+	int32 Slot;
+	uint32 Generation;
+
+	FMixerParticipantHandle()
+		: Slot(INDEX_NONE)
+		, Generation(0)
+	{
+	}
+
+	FMixerParticipantHandle(int32 InSlot, uint32 InGeneration)
+		: Slot(InSlot)
+		, Generation(InGeneration)
+	{
+	}
+
+	/** Only says whether the handle was ever filled in.  Use FMixerParticipantTable::IsValid to check it's still current. */
+	bool IsSet() const { return Slot != INDEX_NONE; }
+};
+
+/**
+* Remote participants in the current interactive session.
+*
+* Participants occupy slots in a set of parallel arrays, one per field, so the
+* fields touched for every input (ids, groups, input enabled) are packed densely
+* and the rest stay out of the way.  Display names live UTF-8 encoded in a single
+* pool instead of one FString allocation per participant.
+*
+* FMixerRemoteUser objects are only created when something outside the table asks
+* for one, and are shared for as long as anybody holds on to them.  While shared
+* they are kept up to date with changes to the participant.
+*
+* Each group threads its members onto an intrusive list and keeps a count, so
+* group queries only touch members of that group and deleting a group splices
+* its members onto their new group without visiting them.
+*/
+class FMixerParticipantTable
+{
+public:
+	FMixerParticipantTable();
+
+	/** Add a participant, or update the existing participant with the same session guid. */
+	FMixerParticipantHandle Add(const FMixerRemoteUser& User);
+
+	/** Replace everything but the session guid of an existing participant. */
+	void Update(FMixerParticipantHandle Handle, const FMixerRemoteUser& User);
+
+	/** @Return	False if the handle was no longer valid. */
+	bool Remove(FMixerParticipantHandle Handle);
+
+	void Empty();
+
+	int32 Num() const { return NumParticipants; }
+
+	FMixerParticipantHandle FindByUserId(uint32 UserId) const;
+	FMixerParticipantHandle FindBySessionGuid(const FGuid& SessionGuid) const;
+
+	/**
+	* Remember the exact text the service uses for a participant's session id, so that
+	* FindBySessionIdText can attribute their input without parsing it as a guid.
+	*/
+	void SetSessionIdText(FMixerParticipantHandle Handle, const ANSICHAR* Utf8SessionId, int32 Length);
+
+	/** Find a participant by session id text previously passed to SetSessionIdText. */
+	FMixerParticipantHandle FindBySessionIdText(const ANSICHAR* Utf8SessionId, int32 Length) const;
+
+	/**
+	* As above, for text straight out of a message.  Session ids are plain ASCII, which is matched
+	* in place against the UTF-8 text; anything else is converted first.
+	*/
+	FMixerParticipantHandle FindBySessionIdText(const TCHAR* SessionId, int32 Length) const;
+
+	/** Handle to whoever currently occupies a slot.  Not set if nobody does. */
+	FMixerParticipantHandle GetHandleAtSlot(int32 Slot) const
+	{
+		return Occupied.IsValidIndex(Slot) && Occupied[Slot] ? FMixerParticipantHandle(Slot, Generations[Slot]) : FMixerParticipantHandle();
+	}
+
+	bool IsValid(FMixerParticipantHandle Handle) const
+	{
+		return Generations.IsValidIndex(Handle.Slot) && Generations[Handle.Slot] == Handle.Generation && Occupied[Handle.Slot];
+	}
+
+	uint32 GetUserId(FMixerParticipantHandle Handle) const { check(IsValid(Handle)); return UserIds[Handle.Slot]; }
+	const FGuid& GetSessionGuid(FMixerParticipantHandle Handle) const { check(IsValid(Handle)); return SessionGuids[Handle.Slot]; }
+	FName GetGroup(FMixerParticipantHandle Handle) const { check(IsValid(Handle)); return GroupEntries[ResolveGroup(SlotGroups[Handle.Slot])].Name; }
+	bool IsInputEnabled(FMixerParticipantHandle Handle) const { check(IsValid(Handle)); return InputEnabled[Handle.Slot]; }
+	int32 GetLevel(FMixerParticipantHandle Handle) const { check(IsValid(Handle)); return Levels[Handle.Slot]; }
+
+	/** Copy out everything known about a participant. */
+	void GetUser(FMixerParticipantHandle Handle, FMixerRemoteUser& OutUser) const;
+
+	/** Shared view of a participant for handing to game code.  Invalid if the handle is. */
+	TSharedPtr<const FMixerRemoteUser> GetView(FMixerParticipantHandle Handle);
+
+	/** @Return	False if no participant has ever been in the group. */
+	bool GetViewsInGroup(FName Group, TArray<TSharedPtr<const FMixerRemoteUser>>& OutViews);
+
+	/** @Return	False if no participant has ever been in the group. */
+	bool GetUserIdsInGroup(FName Group, TArray<uint32>& OutUserIds) const;
+
+	/** @Return	False if no participant has ever been in the group. */
+	bool GetSlotsInGroup(FName Group, FMixerParticipantSlotSet& OutSlots) const;
+
+	int32 GetNumInGroup(FName Group) const;
+
+	/**
+	* Move every participant in FromGroup to ToGroup, after which FromGroup is forgotten.
+	* Constant time apart from refreshing views that game code is still holding on to.
+	*/
+	void ReassignGroup(FName FromGroup, FName ToGroup);
+
+private:
+	struct FNameSpan
+	{
+		int32 Offset;
+		int32 Length;
+	};
+
+	struct FGroupEntry
+	{
+		FName Name;
+		/** Entry this group's members were spliced onto when it was deleted, or INDEX_NONE while it is current. */
+		int32 MergedInto;
+		int32 FirstSlot;
+		int32 LastSlot;
+		int32 Num;
+	};
+
+	int32 FindOrAddGroup(FName Group);
+	int32 ResolveGroup(int32 GroupIndex) const;
+	void LinkToGroup(int32 Slot, FName Group);
+	void UnlinkFromGroup(int32 Slot);
+	void PruneViewedSlots();
+
+	void WriteSlot(int32 Slot, const FMixerRemoteUser& User);
+	void ReadSlot(int32 Slot, FMixerRemoteUser& OutUser) const;
+	void SetName(int32 Slot, const FString& Name);
+	void CompactNamePool();
+
+	/** CharType is ANSICHAR for UTF-8 text, or TCHAR for text known to be ASCII. */
+	template <typename CharType>
+	static uint32 HashSessionIdText(const CharType* SessionId, int32 Length);
+
+	template <typename CharType>
+	FMixerParticipantHandle LookupSessionIdText(const CharType* SessionId, int32 Length) const;
+	void LinkSessionIdText(int32 Slot);
+	void UnlinkSessionIdText(int32 Slot);
+	void RehashSessionIdText(int32 NumBuckets);
+
+	/** Bumped each time a slot is vacated. */
+	TArray<uint32> Generations;
+	TBitArray<> Occupied;
+	TArray<int32> FreeSlots;
+	int32 NumParticipants;
+
+	TArray<uint32> UserIds;
+	TArray<FGuid> SessionGuids;
+	/** Index into GroupEntries, possibly of a group that has since been merged into another. */
+	TArray<int32> SlotGroups;
+	TArray<int32> NextInGroup;
+	TArray<int32> PrevInGroup;
+	TBitArray<> InputEnabled;
+	TArray<int32> Levels;
+	TArray<FDateTime> ConnectedAt;
+	TArray<FDateTime> InputAt;
+	TArray<FNameSpan> NameSpans;
+	/** Raw session id text, also kept in NamePool.  Zero length if never set. */
+	TArray<FNameSpan> SessionIdSpans;
+
+	TArray<ANSICHAR> NamePool;
+	/** Bytes in NamePool no longer referenced by any slot. */
+	int32 NamePoolWaste;
+
+	/**
+	* Chained hash index over session id text.  Buckets hold the first slot in each chain
+	* and NextInSessionIdBucket links the rest, so lookups never allocate.
+	*/
+	TArray<int32> SessionIdBuckets;
+	TArray<int32> NextInSessionIdBucket;
+	TArray<uint32> SessionIdHashes;
+	int32 NumSessionIdTexts;
+
+	TArray<TWeakPtr<FMixerRemoteUser>> Views;
+	/** Slots that may have a live view, so that group reassignment can find them without a full scan. */
+	TArray<int32> ViewedSlots;
+	TBitArray<> ViewedSlotFlags;
+	int32 ViewedSlotsPruneThreshold;
+
+	TArray<FGroupEntry> GroupEntries;
+	TMap<FName, int32> GroupsByName;
+
+	TMap<FGuid, int32> SlotsBySessionGuid;
+	TMap<uint32, int32> SlotsByUserId;
+};
@@ -0,0 +1,299 @@
+//*********************************************************
+//
+// Copyright (c) Microsoft. All rights reserved.
+// THIS CODE IS PROVIDED *AS IS* WITHOUT WARRANTY OF
+// ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING ANY
+// IMPLIED WARRANTIES OF FITNESS FOR A PARTICULAR
+// PURPOSE, MERCHANTABILITY, OR NON-INFRINGEMENT.
+//
+//*********************************************************
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MixerInteractivityTypes.h"
+
+/**
+* Requests sent to the Mixer service that are still waiting on a reply.
+*
+* Entries live in a slab allocated up front and are threaded onto a list in
+* send order.  All requests share one timeout, so the head of that list is
+* always the next to expire and reaping never has to scan the whole table.
+* When the slab is full the oldest request is evicted to make room, but only if
+* nobody is waiting on its reply; otherwise the slab grows.
+*/
+template <typename HandlerType>
+class TMixerPendingRequestTable
+{
+public:
+	/** Identifies a request that was removed without a reply. */
+	struct FAbandonedRequest
+	{
+		int32 MessageId;
+		int32 MethodIndex;
+		HandlerType Handler;
+	};
+
+	TMixerPendingRequestTable(int32 InCapacity, double InTimeoutSeconds)
+		: OldestSlot(INDEX_NONE)
+		, NewestSlot(INDEX_NONE)
+		, FreeSlot(INDEX_NONE)
+		, TimeoutSeconds(InTimeoutSeconds)
+		, TimedOutCount(0)
+		, EvictedCount(0)
+		, NextRecentlyAbandoned(0)
+	{
+		Slots.SetNum(FMath::Max(InCapacity, 1));
+		IdToSlot.Reserve(Slots.Num());
+		Reset();
+	}
+
+	void SetTimeout(double InTimeoutSeconds)
+	{
+		TimeoutSeconds = InTimeoutSeconds;
+	}
+
+	/**
+	* Track a newly sent request.  If its id is already pending (after MessageId wraps) that
+	* request is evicted.  If the table is full the oldest request is evicted when it has no
+	* handler, and the table grows otherwise.  Evictions are not counted as timeouts.
+	*
+	* @Return	True if OutEvicted was filled in.
+	*/
+	bool Add(int32 MessageId, const FString& MethodName, HandlerType Handler, double Now, FAbandonedRequest& OutEvicted)
+	{
+		bool bEvicted = false;
+		const int32* ExistingSlot = IdToSlot.Find(MessageId);
+		if (ExistingSlot != nullptr)
+		{
+			bEvicted = Abandon(*ExistingSlot, false, OutEvicted);
+		}
+		else if (FreeSlot == INDEX_NONE)
+		{
+			if (Slots[OldestSlot].Handler == nullptr)
+			{
+				bEvicted = Abandon(OldestSlot, false, OutEvicted);
+			}
+			else
+			{
+				Grow();
+			}
+		}
+
+		const int32 SlotIndex = FreeSlot;
+		FSlot& Slot = Slots[SlotIndex];
+		FreeSlot = Slot.Next;
+
+		Slot.Handler = Handler;
+		Slot.SendTime = Now;
+		Slot.Deadline = Now + TimeoutSeconds;
+		Slot.MessageId = MessageId;
+		Slot.MethodIndex = FindOrAddMethod(MethodName);
+		Slot.Prev = NewestSlot;
+		Slot.Next = INDEX_NONE;
+		if (NewestSlot != INDEX_NONE)
+		{
+			Slots[NewestSlot].Next = SlotIndex;
+		}
+		else
+		{
+			OldestSlot = SlotIndex;
+		}
+		NewestSlot = SlotIndex;
+
+		IdToSlot.Add(MessageId, SlotIndex);
+		return bEvicted;
+	}
+
+	/** Stop tracking a request whose reply has arrived, recording its round trip time. */
+	bool Remove(int32 MessageId, double Now, HandlerType& OutHandler)
+	{
+		int32 SlotIndex;
+		if (!IdToSlot.RemoveAndCopyValue(MessageId, SlotIndex))
+		{
+			return false;
+		}
+
+		FSlot& Slot = Slots[SlotIndex];
+		OutHandler = Slot.Handler;
+		Latencies[Slot.MethodIndex].AddSample(Now - Slot.SendTime);
+		Release(SlotIndex);
+		return true;
+	}
+
+	/** Remove the oldest request if its deadline has passed.  Call repeatedly until it returns false. */
+	bool PopExpired(double Now, FAbandonedRequest& OutExpired)
+	{
+		if (OldestSlot == INDEX_NONE || Slots[OldestSlot].Deadline > Now)
+		{
+			return false;
+		}
+
+		return Abandon(OldestSlot, true, OutExpired);
+	}
+
+	/** Whether this request was recently given up on, so that a late reply to it is not unexpected. */
+	bool WasRecentlyAbandoned(int32 MessageId) const
+	{
+		return RecentlyAbandoned.Contains(MessageId);
+	}
+
+	/** Drop every pending request at once, e.g. when the connection they were sent on goes away. */
+	int32 Reset()
+	{
+		const int32 NumCancelled = IdToSlot.Num();
+		IdToSlot.Reset();
+		OldestSlot = INDEX_NONE;
+		NewestSlot = INDEX_NONE;
+		FreeSlot = INDEX_NONE;
+		for (int32 i = Slots.Num() - 1; i >= 0; --i)
+		{
+			Slots[i].Handler = nullptr;
+			Slots[i].Next = FreeSlot;
+			FreeSlot = i;
+		}
+		return NumCancelled;
+	}
+
+	int32 Num() const
+	{
+		return IdToSlot.Num();
+	}
+
+	int32 GetTimedOutCount() const
+	{
+		return TimedOutCount;
+	}
+
+	int32 GetEvictedCount() const
+	{
+		return EvictedCount;
+	}
+
+	const FString& GetMethodName(int32 MethodIndex) const
+	{
+		return MethodNames[MethodIndex];
+	}
+
+	void GetLatencyHistograms(TMap<FString, FMixerReplyLatencyHistogram>& OutHistograms) const
+	{
+		OutHistograms.Reset();
+		for (int32 i = 0; i < MethodNames.Num(); ++i)
+		{
+			OutHistograms.Add(MethodNames[i], Latencies[i]);
+		}
+	}
+
+private:
+	struct FSlot
+	{
+		HandlerType Handler;
+		double SendTime;
+		double Deadline;
+		int32 MessageId;
+		int32 MethodIndex;
+		int32 Prev;
+		int32 Next;
+	};
+
+	bool Abandon(int32 SlotIndex, bool bTimedOut, FAbandonedRequest& OutAbandoned)
+	{
+		FSlot& Slot = Slots[SlotIndex];
+		OutAbandoned.MessageId = Slot.MessageId;
+		OutAbandoned.MethodIndex = Slot.MethodIndex;
+		OutAbandoned.Handler = Slot.Handler;
+		if (bTimedOut)
+		{
+			++Latencies[Slot.MethodIndex].TimedOut;
+			++TimedOutCount;
+		}
+		else
+		{
+			++Latencies[Slot.MethodIndex].Evicted;
+			++EvictedCount;
+		}
+
+		if (RecentlyAbandoned.Num() < MaxRecentlyAbandoned)
+		{
+			RecentlyAbandoned.Add(Slot.MessageId);
+		}
+		else
+		{
+			RecentlyAbandoned[NextRecentlyAbandoned] = Slot.MessageId;
+			NextRecentlyAbandoned = (NextRecentlyAbandoned + 1) % MaxRecentlyAbandoned;
+		}
+
+		IdToSlot.Remove(Slot.MessageId);
+		Release(SlotIndex);
+		return true;
+	}
+
+	/** Double the slab, threading the new slots onto the free list. */
+	void Grow()
+	{
+		const int32 OldNum = Slots.Num();
+		Slots.SetNum(OldNum * 2);
+		for (int32 i = Slots.Num() - 1; i >= OldNum; --i)
+		{
+			Slots[i].Handler = nullptr;
+			Slots[i].Next = FreeSlot;
+			FreeSlot = i;
+		}
+		IdToSlot.Reserve(Slots.Num());
+	}
+
+	void Release(int32 SlotIndex)
+	{
+		FSlot& Slot = Slots[SlotIndex];
+		if (Slot.Prev != INDEX_NONE)
+		{
+			Slots[Slot.Prev].Next = Slot.Next;
+		}
+		else
+		{
+			OldestSlot = Slot.Next;
+		}
+
+		if (Slot.Next != INDEX_NONE)
+		{
+			Slots[Slot.Next].Prev = Slot.Prev;
+		}
+		else
+		{
+			NewestSlot = Slot.Prev;
+		}
+
+		Slot.Handler = nullptr;
+		Slot.Next = FreeSlot;
+		FreeSlot = SlotIndex;
+	}
+
+	int32 FindOrAddMethod(const FString& MethodName)
+	{
+		// Only a handful of distinct methods are ever sent
+		int32 MethodIndex = MethodNames.IndexOfByKey(MethodName);
+		if (MethodIndex == INDEX_NONE)
+		{
+			MethodIndex = MethodNames.Add(MethodName);
+			Latencies.AddDefaulted();
+		}
+		return MethodIndex;
+	}
+
+	TArray<FSlot> Slots;
+	TMap<int32, int32> IdToSlot;
+	int32 OldestSlot;
+	int32 NewestSlot;
+	int32 FreeSlot;
+	double TimeoutSeconds;
+	int32 TimedOutCount;
+	int32 EvictedCount;
+
+	/** Ring of the ids most recently timed out or evicted. */
+	static const int32 MaxRecentlyAbandoned = 64;
+	TArray<int32> RecentlyAbandoned;
+	int32 NextRecentlyAbandoned;
+
+	/** Parallel arrays indexed by FSlot::MethodIndex.  Survive Reset so that stats cover the whole session. */
+	TArray<FString> MethodNames;
+	TArray<FMixerReplyLatencyHistogram> Latencies;
+};
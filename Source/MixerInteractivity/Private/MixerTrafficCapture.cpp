@@ -0,0 +1,169 @@
+//*********************************************************
+//
+// Copyright (c) Microsoft. All rights reserved.
+// THIS CODE IS PROVIDED *AS IS* WITHOUT WARRANTY OF
+// ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING ANY
+// IMPLIED WARRANTIES OF FITNESS FOR A PARTICULAR
+// PURPOSE, MERCHANTABILITY, OR NON-INFRINGEMENT.
+//
+//*********************************************************
+#include "MixerTrafficCapture.h"
+
+#if MIXER_WITH_TRAFFIC_CAPTURE
+
+#include "MixerInteractivityLog.h"
+#include "MixerInteractivitySettings.h"
+#include "Containers/StringConv.h"
+#include "GenericPlatform/GenericPlatformFile.h"
+#include "HAL/PlatformFilemanager.h"
+#include "Misc/DateTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+namespace
+{
+	const int32 RecordAlignment = 8;
+
+	/** Buffered records are written out at least this often, and more often under heavy traffic. */
+	const int32 FlushThresholdBytes = 256 * 1024;
+}
+
+TUniquePtr<FMixerTrafficCaptureWriter> FMixerTrafficCaptureWriter::CreateForConnection(const FString& ConnectionName, const FString& Url)
+{
+	const UMixerInteractivitySettings* Settings = GetDefault<UMixerInteractivitySettings>();
+	if (Settings->TrafficCaptureDirectory.IsEmpty())
+	{
+		return nullptr;
+	}
+
+	const FString Directory = FPaths::IsRelative(Settings->TrafficCaptureDirectory)
+		? FPaths::Combine(FPaths::ProjectSavedDir(), Settings->TrafficCaptureDirectory)
+		: Settings->TrafficCaptureDirectory;
+	const FString Filename = FPaths::Combine(Directory, FPaths::MakeValidFileName(FString::Printf(TEXT("%s-%s.mxcap"), *ConnectionName, *FDateTime::Now().ToString())));
+
+	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+	PlatformFile.CreateDirectoryTree(*Directory);
+	IFileHandle* File = PlatformFile.OpenWrite(*Filename);
+	if (File == nullptr)
+	{
+		UE_LOG(LogMixerInteractivity, Warning, TEXT("Failed to open %s for websocket traffic capture."), *Filename);
+		return nullptr;
+	}
+
+	UE_LOG(LogMixerInteractivity, Log, TEXT("Capturing websocket traffic to %s"), *Filename);
+
+	TUniquePtr<FMixerTrafficCaptureWriter> Writer(new FMixerTrafficCaptureWriter(File));
+	Writer->Record(EMixerTrafficRecordKind::Open, Url);
+	return Writer;
+}
+
+FMixerTrafficCaptureWriter::FMixerTrafficCaptureWriter(IFileHandle* InFile)
+	: File(InFile)
+	, StartTime(FPlatformTime::Seconds())
+{
+	FMixerTrafficCaptureFileHeader Header;
+	Header.Magic = FMixerTrafficCaptureFileHeader::ExpectedMagic;
+	Header.Version = FMixerTrafficCaptureFileHeader::CurrentVersion;
+	Header.StartUnixTimeMs = static_cast<int64>((FDateTime::UtcNow() - FDateTime(1970, 1, 1)).GetTotalMilliseconds());
+	Buffer.Append(reinterpret_cast<const uint8*>(&Header), sizeof(Header));
+}
+
+FMixerTrafficCaptureWriter::~FMixerTrafficCaptureWriter()
+{
+	Flush();
+}
+
+void FMixerTrafficCaptureWriter::Record(EMixerTrafficRecordKind Kind, const ANSICHAR* Utf8Data, int32 Length)
+{
+	FMixerTrafficCaptureRecordHeader Header;
+	Header.TimestampUs = static_cast<uint64>((FPlatformTime::Seconds() - StartTime) * 1000000.0);
+	Header.Length = static_cast<uint32>(Length);
+	Header.Kind = Kind;
+	FMemory::Memzero(Header.Reserved);
+
+	const int32 PaddedLength = Align(Length, RecordAlignment);
+	const int32 RecordStart = Buffer.AddUninitialized(sizeof(Header) + PaddedLength);
+	uint8* RecordData = Buffer.GetData() + RecordStart;
+	FMemory::Memcpy(RecordData, &Header, sizeof(Header));
+	FMemory::Memcpy(RecordData + sizeof(Header), Utf8Data, Length);
+	FMemory::Memzero(RecordData + sizeof(Header) + Length, PaddedLength - Length);
+
+	if (Buffer.Num() >= FlushThresholdBytes)
+	{
+		Flush();
+	}
+}
+
+void FMixerTrafficCaptureWriter::Record(EMixerTrafficRecordKind Kind, const FString& Text)
+{
+	FTCHARToUTF8 Converted(*Text, Text.Len());
+	Record(Kind, reinterpret_cast<const ANSICHAR*>(Converted.Get()), Converted.Length());
+}
+
+void FMixerTrafficCaptureWriter::Flush()
+{
+	if (Buffer.Num() > 0)
+	{
+		if (!File->Write(Buffer.GetData(), Buffer.Num()))
+		{
+			UE_LOG(LogMixerInteractivity, Warning, TEXT("Failed to write %d bytes of websocket traffic capture."), Buffer.Num());
+		}
+		File->Flush();
+		Buffer.Reset();
+	}
+}
+
+FString FMixerTrafficCaptureReader::FRecord::GetPayloadString() const
+{
+	FUTF8ToTCHAR Converted(Payload, Length);
+	return FString(Converted.Length(), Converted.Get());
+}
+
+bool FMixerTrafficCaptureReader::Open(const FString& Filename)
+{
+	Records.Reset();
+	if (!FFileHelper::LoadFileToArray(Contents, *Filename))
+	{
+		UE_LOG(LogMixerInteractivity, Warning, TEXT("Failed to read websocket traffic capture %s."), *Filename);
+		return false;
+	}
+
+	FMixerTrafficCaptureFileHeader FileHeader;
+	if (Contents.Num() < static_cast<int32>(sizeof(FileHeader)))
+	{
+		UE_LOG(LogMixerInteractivity, Warning, TEXT("%s is too short to be a websocket traffic capture."), *Filename);
+		return false;
+	}
+
+	FMemory::Memcpy(&FileHeader, Contents.GetData(), sizeof(FileHeader));
+	if (FileHeader.Magic != FMixerTrafficCaptureFileHeader::ExpectedMagic || FileHeader.Version != FMixerTrafficCaptureFileHeader::CurrentVersion)
+	{
+		UE_LOG(LogMixerInteractivity, Warning, TEXT("%s is not a websocket traffic capture this version can read."), *Filename);
+		return false;
+	}
+
+	int64 Offset = sizeof(FileHeader);
+	while (Offset + static_cast<int64>(sizeof(FMixerTrafficCaptureRecordHeader)) <= Contents.Num())
+	{
+		FMixerTrafficCaptureRecordHeader RecordHeader;
+		FMemory::Memcpy(&RecordHeader, Contents.GetData() + Offset, sizeof(RecordHeader));
+		const int64 PayloadOffset = Offset + sizeof(RecordHeader);
+		if (PayloadOffset + RecordHeader.Length > Contents.Num())
+		{
+			UE_LOG(LogMixerInteractivity, Warning, TEXT("%s ends with a truncated record; ignoring it."), *Filename);
+			break;
+		}
+
+		FRecord& Record = Records[Records.AddUninitialized()];
+		Record.Timestamp = RecordHeader.TimestampUs / 1000000.0;
+		Record.Kind = RecordHeader.Kind;
+		Record.Payload = reinterpret_cast<const ANSICHAR*>(Contents.GetData() + PayloadOffset);
+		Record.Length = static_cast<int32>(RecordHeader.Length);
+
+		Offset = PayloadOffset + Align(static_cast<int64>(RecordHeader.Length), static_cast<int64>(RecordAlignment));
+	}
+
+	return true;
+}
+
+#endif // MIXER_WITH_TRAFFIC_CAPTURE
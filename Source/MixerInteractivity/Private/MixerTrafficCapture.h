@@ -0,0 +1,128 @@
+//*********************************************************
+//
+// Copyright (c) Microsoft. All rights reserved.
+// THIS CODE IS PROVIDED *AS IS* WITHOUT WARRANTY OF
+// ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING ANY
+// IMPLIED WARRANTIES OF FITNESS FOR A PARTICULAR
+// PURPOSE, MERCHANTABILITY, OR NON-INFRINGEMENT.
+//
+//*********************************************************
+#pragma once
+
+#include "CoreMinimal.h"
+
+/** Captures hold everything sent over the socket, credentials included, so they are a development aid only. */
+#define MIXER_WITH_TRAFFIC_CAPTURE !UE_BUILD_SHIPPING
+
+#if MIXER_WITH_TRAFFIC_CAPTURE
+
+class IFileHandle;
+
+/**
+* Websocket traffic capture files (.mxcap).
+*
+* The layout is fixed so that a capture can be memory-mapped and walked in place.
+* All integers are little-endian and every record starts on an 8 byte boundary:
+*
+*	FMixerTrafficCaptureFileHeader
+*	repeated:
+*		FMixerTrafficCaptureRecordHeader
+*		Length bytes of payload (UTF-8 for frames and urls)
+*		zero padding up to the next multiple of 8
+*
+* Records are only ever appended, so a capture cut short by a crash is still
+* readable up to its last complete record.
+*/
+enum class EMixerTrafficRecordKind : uint8
+{
+	/** A connection attempt.  Payload is the url. */
+	Open,
+
+	/** A frame received from the service. */
+	Inbound,
+
+	/** A frame sent to the service. */
+	Outbound,
+
+	/** The connection went away.  Payload is the reason, if any. */
+	Close,
+};
+
+struct FMixerTrafficCaptureFileHeader
+{
+	static const uint32 ExpectedMagic = 0x5043584D; // "MXCP"
+	static const uint32 CurrentVersion = 1;
+
+	uint32 Magic;
+	uint32 Version;
+	/** Wall clock time the capture started, for lining captures up with logs. */
+	int64 StartUnixTimeMs;
+};
+
+struct FMixerTrafficCaptureRecordHeader
+{
+	/** Monotonic time since the capture started. */
+	uint64 TimestampUs;
+	uint32 Length;
+	EMixerTrafficRecordKind Kind;
+	uint8 Reserved[3];
+};
+
+static_assert(sizeof(FMixerTrafficCaptureFileHeader) == 16, "Capture file header layout is part of the file format");
+static_assert(sizeof(FMixerTrafficCaptureRecordHeader) == 16, "Capture record header layout is part of the file format");
+
+/** Appends the traffic of one websocket connection to a capture file. */
+class FMixerTrafficCaptureWriter
+{
+public:
+	/**
+	* Start capturing a connection if TrafficCaptureDirectory is set in the project settings.
+	* Callers are responsible for keeping secrets (e.g. chat auth keys) out of what they record.
+	*
+	* @param	ConnectionName	Prefix for the capture file name, e.g. "interactive".
+	* @param	Url				Recorded as the capture's Open record.
+	* @Return					Null if capture is disabled or the file couldn't be created.
+	*/
+	static TUniquePtr<FMixerTrafficCaptureWriter> CreateForConnection(const FString& ConnectionName, const FString& Url);
+
+	~FMixerTrafficCaptureWriter();
+
+	void Record(EMixerTrafficRecordKind Kind, const ANSICHAR* Utf8Data, int32 Length);
+	void Record(EMixerTrafficRecordKind Kind, const FString& Text);
+
+	/** Write out buffered records.  Cheap when nothing has been recorded since the last call. */
+	void Flush();
+
+private:
+	FMixerTrafficCaptureWriter(IFileHandle* InFile);
+
+	TUniquePtr<IFileHandle> File;
+	TArray<uint8> Buffer;
+	double StartTime;
+};
+
+/** Reads a capture file written by FMixerTrafficCaptureWriter. */
+class FMixerTrafficCaptureReader
+{
+public:
+	struct FRecord
+	{
+		double Timestamp;
+		EMixerTrafficRecordKind Kind;
+		const ANSICHAR* Payload;
+		int32 Length;
+
+		FString GetPayloadString() const;
+	};
+
+	/** Load and index a capture.  A truncated final record is ignored rather than treated as an error. */
+	bool Open(const FString& Filename);
+
+	const TArray<FRecord>& GetRecords() const { return Records; }
+
+private:
+	TArray<uint8> Contents;
+	TArray<FRecord> Records;
+};
+
+#endif // MIXER_WITH_TRAFFIC_CAPTURE
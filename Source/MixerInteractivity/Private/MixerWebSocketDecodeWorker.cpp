@@ -0,0 +1,201 @@
+//*********************************************************
+//
+// Copyright (c) Microsoft. All rights reserved.
+// THIS CODE IS PROVIDED *AS IS* WITHOUT WARRANTY OF
+// ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING ANY
+// IMPLIED WARRANTIES OF FITNESS FOR A PARTICULAR
+// PURPOSE, MERCHANTABILITY, OR NON-INFRINGEMENT.
+//
+//*********************************************************
+#include "MixerWebSocketDecodeWorker.h"
+#include "MixerJsonStreamReader.h"
+#include "MixerJsonHelpers.h"
+#include "MixerInteractivityLog.h"
+#include "HAL/RunnableThread.h"
+#include "HAL/Event.h"
+#include "HAL/PlatformProcess.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+
+FMixerWebSocketDecodeWorker::FMixerWebSocketDecodeWorker(const FString& InServerInitiatedMessageType, const FString& InServerInitiatedMessageSubtypeName, const FString& InServerInitiatedMessageParamsName, const TSet<FString>& InRawParamsSubtypes, uint32 InCapacity)
+	: RawFrames(InCapacity)
+	, DecodedMessages(InCapacity)
+	, bHasPendingDecoded(false)
+	, ServerInitiatedMessageType(InServerInitiatedMessageType)
+	, ServerInitiatedMessageSubtypeName(InServerInitiatedMessageSubtypeName)
+	, ServerInitiatedMessageParamsName(InServerInitiatedMessageParamsName)
+	, RawParamsSubtypes(InRawParamsSubtypes)
+	, WorkAvailable(FPlatformProcess::GetSynchEventFromPool())
+	, Thread(nullptr)
+{
+}
+
+FMixerWebSocketDecodeWorker::~FMixerWebSocketDecodeWorker()
+{
+	Shutdown();
+
+	FPlatformProcess::ReturnSynchEventToPool(WorkAvailable);
+	WorkAvailable = nullptr;
+}
+
+bool FMixerWebSocketDecodeWorker::Start()
+{
+	check(Thread == nullptr);
+	Thread = FRunnableThread::Create(this, TEXT("MixerWebSocketDecode"), 0, TPri_BelowNormal);
+	return Thread != nullptr;
+}
+
+void FMixerWebSocketDecodeWorker::Shutdown()
+{
+	if (Thread != nullptr)
+	{
+		Thread->Kill(true);
+		delete Thread;
+		Thread = nullptr;
+	}
+}
+
+bool FMixerWebSocketDecodeWorker::EnqueueFrame(FString& Frame)
+{
+	if (Thread == nullptr || !RawFrames.Enqueue(Frame))
+	{
+		return false;
+	}
+
+	WorkAvailable->Trigger();
+	return true;
+}
+
+bool FMixerWebSocketDecodeWorker::DequeueDecoded(FMixerDecodedWebSocketMessage& OutMessage)
+{
+	const bool bWasFull = DecodedMessages.IsFull();
+	if (!DecodedMessages.Dequeue(OutMessage))
+	{
+		if (Thread != nullptr)
+		{
+			return false;
+		}
+
+		// Worker has been joined, so its leftovers and the input ring are ours now.  Keep arrival order.
+		if (bHasPendingDecoded)
+		{
+			OutMessage = MoveTemp(PendingDecoded);
+			PendingDecoded = FMixerDecodedWebSocketMessage();
+			bHasPendingDecoded = false;
+			return true;
+		}
+
+		FString Frame;
+		if (!RawFrames.Dequeue(Frame))
+		{
+			return false;
+		}
+
+		Decode(Frame, OutMessage);
+		return true;
+	}
+
+	// The worker may be parked waiting for room in the output ring
+	if (bWasFull)
+	{
+		WorkAvailable->Trigger();
+	}
+	return true;
+}
+
+uint32 FMixerWebSocketDecodeWorker::Run()
+{
+	FString Frame;
+	while (!bStopRequested)
+	{
+		if (!bHasPendingDecoded)
+		{
+			if (!RawFrames.Dequeue(Frame))
+			{
+				WorkAvailable->Wait(100);
+				continue;
+			}
+
+			Decode(Frame, PendingDecoded);
+			bHasPendingDecoded = true;
+		}
+
+		if (DecodedMessages.Enqueue(PendingDecoded))
+		{
+			bHasPendingDecoded = false;
+		}
+		else
+		{
+			// Game thread is behind; hold on to this message until it drains.
+			WorkAvailable->Wait(10);
+		}
+	}
+
+	return 0;
+}
+
+void FMixerWebSocketDecodeWorker::Stop()
+{
+	bStopRequested = true;
+	WorkAvailable->Trigger();
+}
+
+void FMixerWebSocketDecodeWorker::Decode(FString& Frame, FMixerDecodedWebSocketMessage& OutMessage) const
+{
+	OutMessage = FMixerDecodedWebSocketMessage();
+
+	FMixerJsonMessageEnvelope Envelope;
+	if (!FMixerJsonMessageEnvelope::Scan(Frame, ServerInitiatedMessageSubtypeName, ServerInitiatedMessageParamsName, Envelope))
+	{
+		UE_LOG(LogMixerInteractivity, Error, TEXT("Missing required %s field in json payload"), *MixerStringConstants::FieldNames::Type);
+	}
+	else if (Envelope.Type.Equals(MixerStringConstants::MessageTypes::Reply))
+	{
+		if (Envelope.Id.ToInt(OutMessage.ReplyId))
+		{
+			OutMessage.Kind = FMixerDecodedWebSocketMessage::EKind::Reply;
+		}
+		else
+		{
+			UE_LOG(LogMixerInteractivity, Error, TEXT("Missing required %s field in json payload"), *MixerStringConstants::FieldNames::Id);
+		}
+	}
+	else if (Envelope.Type.Equals(ServerInitiatedMessageType))
+	{
+		if (Envelope.Subtype.Kind != EMixerJsonValueKind::String)
+		{
+			UE_LOG(LogMixerInteractivity, Error, TEXT("Missing message subtype (%s)"), *ServerInitiatedMessageSubtypeName);
+		}
+		else if (!Envelope.Params.IsSet())
+		{
+			UE_LOG(LogMixerInteractivity, Error, TEXT("Missing message params (%s)"), *ServerInitiatedMessageParamsName);
+		}
+		else if (Envelope.Params.Kind != EMixerJsonValueKind::Object && Envelope.Params.Kind != EMixerJsonValueKind::Null)
+		{
+			UE_LOG(LogMixerInteractivity, Error, TEXT("Unexpected value %s for message params (%s)"), *Envelope.Params.ToString(), *ServerInitiatedMessageParamsName);
+		}
+		else
+		{
+			OutMessage.Kind = FMixerDecodedWebSocketMessage::EKind::ServerInitiated;
+			OutMessage.Subtype = Envelope.Subtype.ToString();
+			OutMessage.ParamsOffset = static_cast<int32>(Envelope.Params.Start - *Frame);
+			OutMessage.ParamsLength = Envelope.Params.Length;
+			OutMessage.ParamsKind = Envelope.Params.Kind;
+
+			// View handlers read what they need straight from the text.  Everything else, including
+			// unhandled methods that are passed on as objects, has its tree built here instead.
+			if (Envelope.Params.Kind == EMixerJsonValueKind::Object && !RawParamsSubtypes.Contains(OutMessage.Subtype))
+			{
+				TSharedRef<TJsonReader<>> JsonReader = TJsonReaderFactory<>::Create(FString(Envelope.Params.Length, Envelope.Params.Start));
+				FJsonSerializer::Deserialize(JsonReader, OutMessage.ParamsObject);
+			}
+		}
+	}
+	else
+	{
+		OutMessage.Kind = FMixerDecodedWebSocketMessage::EKind::Other;
+	}
+
+	// Only offsets into Frame are kept, so it's safe to hand the text over.
+	OutMessage.Raw = MoveTemp(Frame);
+}
@@ -0,0 +1,191 @@
+//*********************************************************
+//
+// Copyright (c) Microsoft. All rights reserved.
+// THIS CODE IS PROVIDED *AS IS* WITHOUT WARRANTY OF
+// ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING ANY
+// IMPLIED WARRANTIES OF FITNESS FOR A PARTICULAR
+// PURPOSE, MERCHANTABILITY, OR NON-INFRINGEMENT.
+//
+//*********************************************************
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/Runnable.h"
+#include "HAL/ThreadSafeBool.h"
+#include "MixerJsonStreamReader.h"
+
+/**
+* Bounded, lock-free queue for exactly one producer thread and one consumer thread.
+* Unlike TCircularQueue, elements are moved in and out so that non-thread-safe
+* shared pointers built on one side never have their reference counts touched
+* concurrently by the other.
+*/
+template <typename ElementType>
+class TMixerSpscRing
+{
+public:
+	explicit TMixerSpscRing(uint32 InCapacity)
+		: Head(0)
+		, Tail(0)
+	{
+		const uint32 Capacity = FMath::RoundUpToPowerOfTwo(FMath::Max<uint32>(InCapacity, 2));
+		Storage.SetNum(Capacity);
+		IndexMask = Capacity - 1;
+	}
+
+	/** Producer only. Returns false (leaving Element untouched) if the ring is full. */
+	bool Enqueue(ElementType& Element)
+	{
+		const uint32 CurrentTail = Tail;
+		const uint32 NextTail = (CurrentTail + 1) & IndexMask;
+		if (NextTail == Head)
+		{
+			return false;
+		}
+
+		Storage[CurrentTail] = MoveTemp(Element);
+		FPlatformMisc::MemoryBarrier();
+		Tail = NextTail;
+		return true;
+	}
+
+	/** Consumer only. */
+	bool Dequeue(ElementType& OutElement)
+	{
+		const uint32 CurrentHead = Head;
+		if (CurrentHead == Tail)
+		{
+			return false;
+		}
+
+		FPlatformMisc::MemoryBarrier();
+		OutElement = MoveTemp(Storage[CurrentHead]);
+		Storage[CurrentHead] = ElementType();
+		FPlatformMisc::MemoryBarrier();
+		Head = (CurrentHead + 1) & IndexMask;
+		return true;
+	}
+
+	/** Approximate when called from a thread that is neither producer nor consumer. */
+	int32 Num() const
+	{
+		return static_cast<int32>((Tail - Head) & IndexMask);
+	}
+
+	bool IsEmpty() const
+	{
+		return Head == Tail;
+	}
+
+	bool IsFull() const
+	{
+		return ((Tail + 1) & IndexMask) == Head;
+	}
+
+private:
+	TArray<ElementType> Storage;
+	uint32 IndexMask;
+	volatile uint32 Head;
+	volatile uint32 Tail;
+};
+
+/** A websocket frame that has been parsed and classified off the game thread. */
+struct FMixerDecodedWebSocketMessage
+{
+public:
+	enum class EKind : uint8
+	{
+		/** Could not be parsed or was missing required routing fields.  Raw holds the original text. */
+		Malformed,
+		/** Reply to a method we sent.  Left as raw text since most replies are never inspected. */
+		Reply,
+		/** Server initiated method/event.  Params (possibly null) are located, and only parsed if their handler needs an FJsonObject. */
+		ServerInitiated,
+		/** Valid message of a type this connection doesn't route. */
+		Other,
+	};
+
+	FMixerDecodedWebSocketMessage()
+		: Kind(EKind::Malformed)
+		, ReplyId(0)
+		, ParamsOffset(0)
+		, ParamsLength(0)
+		, ParamsKind(EMixerJsonValueKind::None)
+	{
+	}
+
+	/** Span over the params inside Raw.  Only valid while Raw is neither modified nor reassigned. */
+	FMixerJsonSpan GetParams() const
+	{
+		FMixerJsonSpan Params;
+		if (ParamsKind != EMixerJsonValueKind::None)
+		{
+			Params.Start = *Raw + ParamsOffset;
+			Params.Length = ParamsLength;
+			Params.Kind = ParamsKind;
+		}
+		return Params;
+	}
+
+	EKind Kind;
+	int32 ReplyId;
+	FString Subtype;
+	FString Raw;
+	/** Params built on the worker, for subtypes whose handlers don't read the raw text. */
+	TSharedPtr<FJsonObject> ParamsObject;
+	/** Params are kept as an offset rather than a pointer so that Raw can be moved between threads freely. */
+	int32 ParamsOffset;
+	int32 ParamsLength;
+	EMixerJsonValueKind ParamsKind;
+};
+
+/**
+* Worker thread that receives raw websocket frames from the game thread, parses
+* and classifies them, and hands the results back through a second ring for the
+* owning connection to drain at a time of its choosing.
+*/
+class FMixerWebSocketDecodeWorker : public FRunnable
+{
+public:
+	/**
+	* Params of server initiated messages are deserialized on the worker unless their subtype
+	* is in InRawParamsSubtypes, i.e. its handler reads them through an FMixerJsonMessageView.
+	*/
+	FMixerWebSocketDecodeWorker(const FString& InServerInitiatedMessageType, const FString& InServerInitiatedMessageSubtypeName, const FString& InServerInitiatedMessageParamsName, const TSet<FString>& InRawParamsSubtypes, uint32 InCapacity);
+	virtual ~FMixerWebSocketDecodeWorker();
+
+	bool Start();
+
+	/** Game thread.  Returns false (leaving Frame untouched) if the worker is backed up. */
+	bool EnqueueFrame(FString& Frame);
+
+	/**
+	* Game thread.  After Shutdown this keeps returning messages, decoding any frames
+	* the worker never got to on the calling thread, until everything enqueued is delivered.
+	*/
+	bool DequeueDecoded(FMixerDecodedWebSocketMessage& OutMessage);
+
+	/** Game thread.  Stop and join the worker thread without discarding any queued frames. */
+	void Shutdown();
+
+public:
+	// FRunnable
+	virtual uint32 Run() override;
+	virtual void Stop() override;
+
+private:
+	void Decode(FString& Frame, FMixerDecodedWebSocketMessage& OutMessage) const;
+
+	TMixerSpscRing<FString> RawFrames;
+	TMixerSpscRing<FMixerDecodedWebSocketMessage> DecodedMessages;
+	/** Decoded message that didn't fit in DecodedMessages.  Owned by the worker until it has been joined. */
+	FMixerDecodedWebSocketMessage PendingDecoded;
+	bool bHasPendingDecoded;
+	FString ServerInitiatedMessageType;
+	FString ServerInitiatedMessageSubtypeName;
+	FString ServerInitiatedMessageParamsName;
+	TSet<FString> RawParamsSubtypes;
+	FEvent* WorkAvailable;
+	FRunnableThread* Thread;
+	FThreadSafeBool bStopRequested;
+};
@@ -4,37 +4,131 @@
 #include "WebSocketsModule.h"
 #include "IWebSocket.h"
 #include "MixerInteractivityLog.h"
+#include "MixerInteractivityTypes.h"
 #include "MixerJsonHelpers.h"
+#include "MixerJsonStreamReader.h"
+#include "MixerJsonWriter.h"
+#include "MixerLoopbackWebSocket.h"
+#include "MixerMessageHandlerTable.h"
+#include "MixerPendingRequestTable.h"
+#include "MixerTrafficCapture.h"
+#include "MixerWebSocketDecodeWorker.h"
 #include "Policies/JsonPrintPolicy.h"
 #include "Policies/CondensedJsonPrintPolicy.h"
 #include "Serialization/JsonSerializerMacros.h"
+#include "Templates/EnableIf.h"
+#include "Templates/UnrealTypeTraits.h"
 
 #if PLATFORM_XBOXONE
 #include "XboxOne/MixerXboxOneWebSocket.h"
 #endif
 
+/** How incoming websocket frames are decoded before being routed to handlers. */
+enum class EMixerJsonDispatchMode : uint8
+{
+	/** Deserialize every frame into a full FJsonObject before routing. */
+	Document,
+
+	/**
+	* Route on fields read by a forward-only scan of the raw frame.  Payloads are
+	* only deserialized when the selected handler asks for them.
+	*/
+	Streaming,
+};
+
+/** Scheduling class for outgoing method messages. */
+enum class EMixerMessagePriority : uint8
+{
+	/** Sent immediately and never held back by the send budget (e.g. spark capture, ready state). */
+	Urgent,
+
+	/** Sent immediately unless the send budget is exhausted or earlier messages are still queued. */
+	Normal,
+
+	/** Always queued until the next FlushSendQueue, and sent only once nothing of higher priority is waiting. */
+	Cosmetic,
+
+	Count
+};
+
 template <class T>
 class TMixerWebSocketOwnerBase
 {
 protected:
-	TMixerWebSocketOwnerBase(const FString& InServerInitiatedMessageType, const FString& InServerInitiatedMessageSubtypeName, const FString& InServerInitiatedMessageParamsName);
+	TMixerWebSocketOwnerBase(const FString& InServerInitiatedMessageType, const FString& InServerInitiatedMessageSubtypeName, const FString& InServerInitiatedMessageParamsName, EMixerJsonDispatchMode InDispatchMode = EMixerJsonDispatchMode::Document);
 	virtual ~TMixerWebSocketOwnerBase();
 
 	void InitConnection(const FString& Url, const TMap<FString,FString>& UpgradeHeaders);
 	void CleanupConnection();
 
 	typedef bool (T::*FServerMessageHandler)(FJsonObject*);
+	typedef bool (T::*FServerMessageViewHandler)(FMixerJsonMessageView&);
 
 	void RegisterServerMessageHandler(const FString& MessageType, FServerMessageHandler Handler);
+	void RegisterServerMessageHandler(const FString& MessageType, FServerMessageViewHandler Handler);
+
+	void SetMessageDispatchMode(EMixerJsonDispatchMode InDispatchMode) { DispatchMode = InDispatchMode; }
+	EMixerJsonDispatchMode GetMessageDispatchMode() const { return DispatchMode; }
+
+	/**
+	* Parse incoming frames on a worker thread rather than inside the websocket callback.
+	* Takes effect on the next InitConnection.  While enabled, handlers are only invoked
+	* from ProcessDecodedMessages, which the owner must call regularly on the game thread.
+	*/
+	void SetDecodeOnWorkerThread(bool bEnable, uint32 InQueueCapacity = 1024);
+
+	/** Deliver messages decoded by the worker thread until none remain or the time budget is spent. */
+	void ProcessDecodedMessages(double TimeBudgetSeconds);
+
+	/** Limit non-urgent outgoing traffic to roughly this many bytes per second.  0 means unlimited. */
+	void SetSendBudget(int32 InBytesPerSecond);
+
+	/**
+	* Send queued messages in priority order, as far as the send budget allows, and time out
+	* requests whose replies are overdue.  Call once per frame.
+	*/
+	void FlushSendQueue();
+
+	void GetOutgoingMessageStats(FMixerOutgoingMessageStats& OutStats) const;
+
+	/** @Return	Whether any messages of this priority are waiting for send budget. */
+	bool HasQueuedMessages(EMixerMessagePriority Priority) const { return SendQueues[static_cast<int32>(Priority)].Num() > 0; }
+
+	/** Give up on replies that haven't arrived within this many seconds of the request being sent. */
+	void SetReplyTimeout(double InTimeoutSeconds);
+
+	/**
+	* Name used for traffic capture files when TrafficCaptureDirectory is set in the project settings.
+	* Each InitConnection starts a new capture.  An empty name disables capture for this owner.
+	* Capture is never available in shipping builds.
+	*/
+	void SetTrafficCaptureName(const FString& InName) { TrafficCaptureName = InName; }
+
+	/**
+	* Called when a request is abandoned because no reply arrived in time (or, rarely, because its id was
+	* reused).  Handler, which will now never be called, is passed along so that owners can fail or retry
+	* requests that something is waiting on.
+	*/
+	virtual void HandleReplyTimeout(const FString& MethodName, int32 TimedOutMessageId, FServerMessageHandler Handler);
+
+	/** Choose how an outgoing message is scheduled. */
+	virtual EMixerMessagePriority GetOutgoingMessagePriority(const FString& MethodName) const { return EMixerMessagePriority::Normal; }
 	virtual bool OnUnhandledServerMessage(const FString& MessageType, const TSharedPtr<FJsonObject> Params) = 0;
 
 	void SendMethodMessageNoParams(const FString& MethodName, FServerMessageHandler Handler);
 	void SendMethodMessageObjectParams(const FString& MethodName, FServerMessageHandler Handler, const FJsonSerializable& ObjectStyleParams);
 	void SendMethodMessageObjectParams(const FString& MethodName, FServerMessageHandler Handler, const TSharedRef<FJsonObject> ObjectStyleParams);
 
+	/** Preferred over the FJsonSerializable overload: ParamsType supplies WriteJsonFields (see FMixerJsonUtf8Writer). */
+	template <class ParamsType>
+	typename TEnableIf<!TIsDerivedFrom<ParamsType, FJsonSerializable>::IsDerived>::Type SendMethodMessageObjectParams(const FString& MethodName, FServerMessageHandler Handler, const ParamsType& ObjectStyleParams);
+
 	template <class ... ArgTypes>
 	void SendMethodMessageArrayParams(const FString& MethodName, FServerMessageHandler Handler, ArgTypes... ArrayStyleParams);
 
+	/** For params already serialized to UTF-8 JSON text.  The caller picks the priority. */
+	void SendMethodMessageJsonParams(const FString& MethodName, FServerMessageHandler Handler, const ANSICHAR* Utf8ParamsJson, int32 Length, EMixerMessagePriority Priority);
+
 	virtual void HandleSocketConnected() = 0;
 	virtual void HandleSocketConnectionError() = 0;
 	virtual void HandleSocketClosed(bool bWasClean) = 0;
@@ -48,44 +142,117 @@ private:
 	void OnSocketClosed(int32 StatusCode, const FString& Reason, bool bWasClean);
 
 	bool OnSocketMessage(FJsonObject* JsonObj);
+	bool OnSocketMessageStreaming(const FString& MessageJsonString);
+	bool OnDecodedSocketMessage(FMixerDecodedWebSocketMessage& Decoded);
+	void DispatchSocketMessage(const FString& MessageJsonString);
+	void DrainDecodeWorker();
+	bool DispatchReply(int32 ReplyingToMessageId, const FString& MessageJsonString);
+	bool DispatchServerInitiatedMessage(const FMixerJsonSpan& Subtype, FMixerJsonMessageView& Params);
 
 	typedef TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>> CondensedWriterType;
 
-	TSharedRef<CondensedWriterType> StartMethodMessage(const FString& MethodName, FString& PayloadString);
-	void FinishMethodMessage(TSharedRef<CondensedWriterType> Writer);
-	void ActuallySendMethodMessage(FServerMessageHandler Handler, const FString& PayloadString);
+	struct FOutgoingMessage
+	{
+		FString MethodName;
+		/** UTF-8 text.  Only filled in once the message is queued; until then it lives in PayloadScratch. */
+		TArray<ANSICHAR> Payload;
+		FServerMessageHandler Handler;
+		int32 Id;
+
+		FOutgoingMessage()
+			: Handler(nullptr)
+			, Id(0)
+		{
+		}
+	};
+
+	FMixerJsonUtf8Writer StartMethodMessage(FOutgoingMessage& Message, FServerMessageHandler Handler, const FString& MethodName);
+	void FinishMethodMessage(FMixerJsonUtf8Writer& Writer);
+	void SerializeObjectParamsMessage(const FOutgoingMessage& Message, const TSharedRef<FJsonObject>& Params, TArray<ANSICHAR>& OutPayload);
+	void QueueOrSendMethodMessage(FOutgoingMessage& Message, const TArray<ANSICHAR>& Payload);
+	void QueueOrSendMethodMessage(FOutgoingMessage& Message, const TArray<ANSICHAR>& Payload, EMixerMessagePriority Priority);
+	void ActuallySendMethodMessage(const FOutgoingMessage& Message, const TArray<ANSICHAR>& Payload);
+	void RecordOutboundMessage(const FOutgoingMessage& Message, const TArray<ANSICHAR>& Payload);
+
+	int32 AllocateMessageId();
+	void ReapExpiredReplies();
+	void RefillSendBudget();
+	bool HasSendBudget(int32 PayloadSize) const;
 
 private:
 	template <class PARAM>
-	void WriteSingleRemoteMethodParam(CondensedWriterType& Writer, PARAM Param1);
+	void WriteSingleRemoteMethodParam(FMixerJsonUtf8Writer& Writer, PARAM Param1);
 
 	template <class PARAM>
-	void WriteSingleRemoteMethodParam(CondensedWriterType& Writer, const TArray<PARAM>& Param1);
+	void WriteSingleRemoteMethodParam(FMixerJsonUtf8Writer& Writer, const TArray<PARAM>& Param1);
 
 	template <class PARAM, class ...ArgTypes>
-	void WriteRemoteMethodParams(CondensedWriterType& Writer, PARAM Param1, ArgTypes... AdditionalArgs);
+	void WriteRemoteMethodParams(FMixerJsonUtf8Writer& Writer, PARAM Param1, ArgTypes... AdditionalArgs);
 
 	template <class PARAM>
-	void WriteRemoteMethodParams(CondensedWriterType& Writer, PARAM Param1);
+	void WriteRemoteMethodParams(FMixerJsonUtf8Writer& Writer, PARAM Param1);
 
 private:
+	/** Exactly one of the two handler flavors is set (or neither, for explicitly ignored messages). */
+	struct FServerMessageHandlerEntry
+	{
+		FServerMessageHandler ObjectHandler;
+		FServerMessageViewHandler ViewHandler;
+	};
+
 	TSharedPtr<IWebSocket> WebSocket;
 	FString ServerInitiatedMessageType;
 	FString ServerInitiatedMessageSubtypeName;
 	FString ServerInitiatedMessageParamsName;
-	TMap<int32, FServerMessageHandler> ReplyHandlers;
-	TMap<FString, FServerMessageHandler> ServerInitiatedMessageHandlers;
+	TMixerPendingRequestTable<FServerMessageHandler> PendingReplies;
+	TMixerMessageHandlerTable<FServerMessageHandlerEntry> ServerInitiatedMessageHandlers;
+	/** Subtypes whose params never need an FJsonObject, so the decode worker leaves them as text. */
+	TSet<FString> RawParamsSubtypes;
 	int32 MessageId;
 	int32 SequenceId;
+	EMixerJsonDispatchMode DispatchMode;
+
+	TArray<FOutgoingMessage> SendQueues[static_cast<int32>(EMixerMessagePriority::Count)];
+	/** Reused for every outgoing message so that those sent immediately never allocate. */
+	TArray<ANSICHAR> PayloadScratch;
+	int32 QueuedBytes;
+	int32 SendBudgetBytesPerSecond;
+	double SendBudgetAvailable;
+	double LastSendBudgetRefillTime;
+	int32 SentMessageCount;
+	int64 SentByteCount;
+
+	FString TrafficCaptureName;
+#if MIXER_WITH_TRAFFIC_CAPTURE
+	TUniquePtr<FMixerTrafficCaptureWriter> TrafficCapture;
+	/** Reused for the stand-in written in place of messages that carry credentials. */
+	TArray<ANSICHAR> RedactedPayloadScratch;
+#endif
+
+	TUniquePtr<FMixerWebSocketDecodeWorker> DecodeWorker;
+	/** Frames that arrived while the worker's input ring was full, in arrival order. */
+	TArray<FString> OverflowFrames;
+	uint32 DecodeQueueCapacity;
+	bool bDecodeOnWorkerThread;
 };
 
 template <class T>
-TMixerWebSocketOwnerBase<T>::TMixerWebSocketOwnerBase(const FString& InServerInitiatedMessageType, const FString& InServerInitiatedMessageSubtypeName, const FString& InServerInitiatedMessageParamsName)
+TMixerWebSocketOwnerBase<T>::TMixerWebSocketOwnerBase(const FString& InServerInitiatedMessageType, const FString& InServerInitiatedMessageSubtypeName, const FString& InServerInitiatedMessageParamsName, EMixerJsonDispatchMode InDispatchMode)
 	: ServerInitiatedMessageType(InServerInitiatedMessageType)
 	, ServerInitiatedMessageSubtypeName(InServerInitiatedMessageSubtypeName)
 	, ServerInitiatedMessageParamsName(InServerInitiatedMessageParamsName)
+	, PendingReplies(256, 30.0)
 	, MessageId(0)
 	, SequenceId(0)
+	, DispatchMode(InDispatchMode)
+	, QueuedBytes(0)
+	, SendBudgetBytesPerSecond(0)
+	, SendBudgetAvailable(0.0)
+	, LastSendBudgetRefillTime(0.0)
+	, SentMessageCount(0)
+	, SentByteCount(0)
+	, DecodeQueueCapacity(1024)
+	, bDecodeOnWorkerThread(false)
 {
 
 }
@@ -100,17 +267,44 @@ template <class T>
 void TMixerWebSocketOwnerBase<T>::InitConnection(const FString& Url, const TMap<FString, FString>& UpgradeHeaders)
 {
 	ServerInitiatedMessageHandlers.Empty();
+	RawParamsSubtypes.Empty();
 	RegisterAllServerMessageHandlers();
 
+#if MIXER_WITH_TRAFFIC_CAPTURE
+	if (!TrafficCaptureName.IsEmpty())
+	{
+		TrafficCapture = FMixerTrafficCaptureWriter::CreateForConnection(TrafficCaptureName, Url);
+	}
+#endif
+
+	if (bDecodeOnWorkerThread && FPlatformProcess::SupportsMultithreading())
+	{
+		DecodeWorker = MakeUnique<FMixerWebSocketDecodeWorker>(ServerInitiatedMessageType, ServerInitiatedMessageSubtypeName, ServerInitiatedMessageParamsName, RawParamsSubtypes, DecodeQueueCapacity);
+		if (!DecodeWorker->Start())
+		{
+			UE_LOG(LogMixerInteractivity, Warning, TEXT("Failed to start websocket decode thread.  Messages will be decoded on the game thread."));
+			DecodeWorker.Reset();
+		}
+	}
+
 	// Explicitly list protocols for the benefit of Xbox
 	TArray<FString> Protocols;
 	Protocols.Add(TEXT("wss"));
 	Protocols.Add(TEXT("ws"));
+#if MIXER_WITH_LOOPBACK_SERVICE
+	if (MixerIsLoopbackUrl(Url))
+	{
+		WebSocket = MakeShared<FMixerLoopbackWebSocket>(Url);
+	}
+	else
+#endif
+	{
 #if PLATFORM_XBOXONE
-	WebSocket = MakeShared<FMixerXboxOneWebSocket>(Url, Protocols, UpgradeHeaders);
+		WebSocket = MakeShared<FMixerXboxOneWebSocket>(Url, Protocols, UpgradeHeaders);
 #else
-	WebSocket = FModuleManager::LoadModuleChecked<FWebSocketsModule>("WebSockets").CreateWebSocket(Url, Protocols, UpgradeHeaders);
+		WebSocket = FModuleManager::LoadModuleChecked<FWebSocketsModule>("WebSockets").CreateWebSocket(Url, Protocols, UpgradeHeaders);
 #endif
+	}
 
 	if (WebSocket.IsValid())
 	{
@@ -140,84 +334,415 @@ void TMixerWebSocketOwnerBase<T>::CleanupConnection()
 
 		WebSocket.Reset();
 	}
+
+#if MIXER_WITH_TRAFFIC_CAPTURE
+	if (TrafficCapture.IsValid())
+	{
+		TrafficCapture->Record(EMixerTrafficRecordKind::Close, FString());
+		TrafficCapture.Reset();
+	}
+#endif
+
+	// Anything still in flight belonged to the old connection
+	DecodeWorker.Reset();
+	OverflowFrames.Empty();
+
+	const int32 NumCancelled = PendingReplies.Reset();
+	UE_CLOG(NumCancelled > 0, LogMixerInteractivity, Verbose, TEXT("Cancelled %d requests still waiting on a reply."), NumCancelled);
+
+	for (TArray<FOutgoingMessage>& Queue : SendQueues)
+	{
+		Queue.Empty();
+	}
+	QueuedBytes = 0;
+}
+
+template <class T>
+void TMixerWebSocketOwnerBase<T>::SetDecodeOnWorkerThread(bool bEnable, uint32 InQueueCapacity)
+{
+	bDecodeOnWorkerThread = bEnable;
+	DecodeQueueCapacity = InQueueCapacity;
+}
+
+template <class T>
+void TMixerWebSocketOwnerBase<T>::ProcessDecodedMessages(double TimeBudgetSeconds)
+{
+	if (!DecodeWorker.IsValid())
+	{
+		return;
+	}
+
+	int32 NumRequeued = 0;
+	while (NumRequeued < OverflowFrames.Num() && DecodeWorker->EnqueueFrame(OverflowFrames[NumRequeued]))
+	{
+		++NumRequeued;
+	}
+	OverflowFrames.RemoveAt(0, NumRequeued, false);
+
+	const double StartTime = FPlatformTime::Seconds();
+	FMixerDecodedWebSocketMessage Decoded;
+	// Always handle at least one message so that a tiny budget can't stall the connection.
+	// Handlers may tear down (and even reopen) the connection, so re-check the worker each time.
+	while (DecodeWorker.IsValid() && DecodeWorker->DequeueDecoded(Decoded))
+	{
+		if (!OnDecodedSocketMessage(Decoded))
+		{
+			UE_LOG(LogMixerInteractivity, Warning, TEXT("Failed to handle websocket message from server: %s"), *Decoded.Raw);
+		}
+
+		if (FPlatformTime::Seconds() - StartTime >= TimeBudgetSeconds)
+		{
+			break;
+		}
+	}
 }
 
 template <class T>
 void TMixerWebSocketOwnerBase<T>::RegisterServerMessageHandler(const FString& MessageType, FServerMessageHandler Handler)
 {
-	ServerInitiatedMessageHandlers.Add(MessageType, Handler);
+	FServerMessageHandlerEntry& Entry = ServerInitiatedMessageHandlers.Add(MessageType);
+	Entry.ObjectHandler = Handler;
+	Entry.ViewHandler = nullptr;
+
+	if (Handler != nullptr)
+	{
+		RawParamsSubtypes.Remove(MessageType);
+	}
+	else
+	{
+		RawParamsSubtypes.Add(MessageType);
+	}
+}
+
+template <class T>
+void TMixerWebSocketOwnerBase<T>::RegisterServerMessageHandler(const FString& MessageType, FServerMessageViewHandler Handler)
+{
+	FServerMessageHandlerEntry& Entry = ServerInitiatedMessageHandlers.Add(MessageType);
+	Entry.ObjectHandler = nullptr;
+	Entry.ViewHandler = Handler;
+	RawParamsSubtypes.Add(MessageType);
 }
 
 template <class T>
-TSharedRef<typename TMixerWebSocketOwnerBase<T>::CondensedWriterType> TMixerWebSocketOwnerBase<T>::StartMethodMessage(const FString& MethodName, FString& PayloadString)
+FMixerJsonUtf8Writer TMixerWebSocketOwnerBase<T>::StartMethodMessage(FOutgoingMessage& Message, FServerMessageHandler Handler, const FString& MethodName)
 {
-	TSharedRef<CondensedWriterType> Writer = TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&PayloadString);
-	Writer->WriteObjectStart();
-	Writer->WriteValue(MixerStringConstants::FieldNames::Type, MixerStringConstants::MessageTypes::Method);
-	Writer->WriteValue(MixerStringConstants::FieldNames::Method, MethodName);
-	Writer->WriteValue(MixerStringConstants::FieldNames::Id, MessageId);
+	Message.MethodName = MethodName;
+	Message.Handler = Handler;
+	Message.Id = AllocateMessageId();
+
+	PayloadScratch.Reset();
+	FMixerJsonUtf8Writer Writer(PayloadScratch);
+	Writer.BeginObject();
+	Writer.WriteField(MixerStringConstants::FieldNames::Type, MixerStringConstants::MessageTypes::Method);
+	Writer.WriteField(MixerStringConstants::FieldNames::Method, MethodName);
+	Writer.WriteField(MixerStringConstants::FieldNames::Id, Message.Id);
 	return Writer;
 }
 
 template <class T>
-void TMixerWebSocketOwnerBase<T>::FinishMethodMessage(TSharedRef<CondensedWriterType> Writer)
+void TMixerWebSocketOwnerBase<T>::FinishMethodMessage(FMixerJsonUtf8Writer& Writer)
+{
+	Writer.EndObject();
+}
+
+template <class T>
+void TMixerWebSocketOwnerBase<T>::SerializeObjectParamsMessage(const FOutgoingMessage& Message, const TSharedRef<FJsonObject>& Params, TArray<ANSICHAR>& OutPayload)
+{
+	FString ParamsString;
+	TSharedRef<CondensedWriterType> ParamsWriter = TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&ParamsString);
+	FJsonSerializer::Serialize(Params, ParamsWriter, true);
+
+	OutPayload.Reset();
+	FMixerJsonUtf8Writer Writer(OutPayload);
+	Writer.BeginObject();
+	Writer.WriteField(MixerStringConstants::FieldNames::Type, MixerStringConstants::MessageTypes::Method);
+	Writer.WriteField(MixerStringConstants::FieldNames::Method, Message.MethodName);
+	Writer.WriteField(MixerStringConstants::FieldNames::Id, Message.Id);
+	Writer.WriteKey(MixerStringConstants::FieldNames::Params);
+	Writer.WriteRawValue(ParamsString);
+	FinishMethodMessage(Writer);
+}
+
+template <class T>
+void TMixerWebSocketOwnerBase<T>::QueueOrSendMethodMessage(FOutgoingMessage& Message, const TArray<ANSICHAR>& Payload)
+{
+	QueueOrSendMethodMessage(Message, Payload, GetOutgoingMessagePriority(Message.MethodName));
+}
+
+template <class T>
+void TMixerWebSocketOwnerBase<T>::QueueOrSendMethodMessage(FOutgoingMessage& Message, const TArray<ANSICHAR>& Payload, EMixerMessagePriority Priority)
+{
+	TArray<FOutgoingMessage>& Queue = SendQueues[static_cast<int32>(Priority)];
+
+	if (Priority == EMixerMessagePriority::Urgent)
+	{
+		ActuallySendMethodMessage(Message, Payload);
+		return;
+	}
+
+	if (Priority == EMixerMessagePriority::Normal && Queue.Num() == 0)
+	{
+		RefillSendBudget();
+		if (HasSendBudget(Payload.Num()))
+		{
+			ActuallySendMethodMessage(Message, Payload);
+			return;
+		}
+	}
+
+	Message.Payload = Payload;
+	QueuedBytes += Message.Payload.Num();
+	Queue.Add(MoveTemp(Message));
+}
+
+template <class T>
+void TMixerWebSocketOwnerBase<T>::ActuallySendMethodMessage(const FOutgoingMessage& Message, const TArray<ANSICHAR>& Payload)
+{
+	if (!WebSocket.IsValid())
+	{
+		UE_LOG(LogMixerInteractivity, Warning, TEXT("Dropping %s message sent while not connected."), *Message.MethodName);
+		return;
+	}
+
+	typename TMixerPendingRequestTable<FServerMessageHandler>::FAbandonedRequest Evicted;
+	const bool bEvicted = PendingReplies.Add(Message.Id, Message.MethodName, Message.Handler, FPlatformTime::Seconds(), Evicted);
+
+	const int32 PayloadSize = Payload.Num();
+	SendBudgetAvailable -= PayloadSize;
+	++SentMessageCount;
+	SentByteCount += PayloadSize;
+
+	WebSocket->Send(Payload.GetData(), PayloadSize, false);
+
+	RecordOutboundMessage(Message, Payload);
+
+	// Notify only once the payload is on its way, since the owner may respond by sending (and so reusing PayloadScratch)
+	if (bEvicted)
+	{
+		if (Evicted.Handler != nullptr)
+		{
+			UE_LOG(LogMixerInteractivity, Warning, TEXT("Message id reused; no longer waiting on reply to %s (id %d)."), *PendingReplies.GetMethodName(Evicted.MethodIndex), Evicted.MessageId);
+			HandleReplyTimeout(PendingReplies.GetMethodName(Evicted.MethodIndex), Evicted.MessageId, Evicted.Handler);
+		}
+		else
+		{
+			UE_LOG(LogMixerInteractivity, Verbose, TEXT("Too many requests outstanding; no longer tracking reply to %s (id %d)."), *PendingReplies.GetMethodName(Evicted.MethodIndex), Evicted.MessageId);
+		}
+	}
+}
+
+template <class T>
+void TMixerWebSocketOwnerBase<T>::RecordOutboundMessage(const FOutgoingMessage& Message, const TArray<ANSICHAR>& Payload)
+{
+#if MIXER_WITH_TRAFFIC_CAPTURE
+	if (!TrafficCapture.IsValid())
+	{
+		return;
+	}
+
+	if (Message.MethodName == MixerStringConstants::MethodNames::Auth)
+	{
+		// Keep the auth key out of files on disk.  Replay only counts outbound frames, so a stand-in is enough.
+		RedactedPayloadScratch.Reset();
+		FMixerJsonUtf8Writer Writer(RedactedPayloadScratch);
+		Writer.BeginObject();
+		Writer.WriteField(MixerStringConstants::FieldNames::Type, MixerStringConstants::MessageTypes::Method);
+		Writer.WriteField(MixerStringConstants::FieldNames::Method, Message.MethodName);
+		Writer.WriteField(MixerStringConstants::FieldNames::Id, Message.Id);
+		Writer.WriteField(MixerStringConstants::FieldNames::Arguments, FString(TEXT("<redacted>")));
+		Writer.EndObject();
+		TrafficCapture->Record(EMixerTrafficRecordKind::Outbound, RedactedPayloadScratch.GetData(), RedactedPayloadScratch.Num());
+		return;
+	}
+
+	TrafficCapture->Record(EMixerTrafficRecordKind::Outbound, Payload.GetData(), Payload.Num());
+#endif
+}
+
+template <class T>
+void TMixerWebSocketOwnerBase<T>::SetSendBudget(int32 InBytesPerSecond)
+{
+	SendBudgetBytesPerSecond = FMath::Max(InBytesPerSecond, 0);
+	SendBudgetAvailable = SendBudgetBytesPerSecond;
+	LastSendBudgetRefillTime = FPlatformTime::Seconds();
+}
+
+template <class T>
+void TMixerWebSocketOwnerBase<T>::RefillSendBudget()
+{
+	if (SendBudgetBytesPerSecond > 0)
+	{
+		// Allow bursts of up to one second's worth of traffic
+		const double Now = FPlatformTime::Seconds();
+		SendBudgetAvailable = FMath::Min<double>(SendBudgetAvailable + (Now - LastSendBudgetRefillTime) * SendBudgetBytesPerSecond, SendBudgetBytesPerSecond);
+		LastSendBudgetRefillTime = Now;
+	}
+}
+
+template <class T>
+bool TMixerWebSocketOwnerBase<T>::HasSendBudget(int32 PayloadSize) const
 {
-	Writer->WriteObjectEnd();
-	Writer->Close();
+	// A full bucket always admits one message so that oversized payloads can't wedge the queue
+	return SendBudgetBytesPerSecond == 0 || SendBudgetAvailable >= PayloadSize || SendBudgetAvailable >= SendBudgetBytesPerSecond;
 }
 
 template <class T>
-void TMixerWebSocketOwnerBase<T>::ActuallySendMethodMessage(FServerMessageHandler Handler, const FString& PayloadString)
+int32 TMixerWebSocketOwnerBase<T>::AllocateMessageId()
 {
-	check(!ReplyHandlers.Contains(MessageId));
-	ReplyHandlers.Add(MessageId, Handler);
-	++MessageId;
+	const int32 Id = MessageId;
+	MessageId = MessageId < MAX_int32 ? MessageId + 1 : 0;
+	return Id;
+}
+
+template <class T>
+void TMixerWebSocketOwnerBase<T>::SetReplyTimeout(double InTimeoutSeconds)
+{
+	PendingReplies.SetTimeout(InTimeoutSeconds);
+}
 
-	WebSocket->Send(PayloadString);
+template <class T>
+void TMixerWebSocketOwnerBase<T>::HandleReplyTimeout(const FString& MethodName, int32 TimedOutMessageId, FServerMessageHandler Handler)
+{
+	UE_LOG(LogMixerInteractivity, Warning, TEXT("No reply received for %s (id %d)."), *MethodName, TimedOutMessageId);
+}
+
+template <class T>
+void TMixerWebSocketOwnerBase<T>::ReapExpiredReplies()
+{
+	const double Now = FPlatformTime::Seconds();
+	typename TMixerPendingRequestTable<FServerMessageHandler>::FAbandonedRequest Expired;
+	while (PendingReplies.PopExpired(Now, Expired))
+	{
+		HandleReplyTimeout(PendingReplies.GetMethodName(Expired.MethodIndex), Expired.MessageId, Expired.Handler);
+	}
+}
+
+template <class T>
+void TMixerWebSocketOwnerBase<T>::FlushSendQueue()
+{
+	ReapExpiredReplies();
+	RefillSendBudget();
+
+#if MIXER_WITH_TRAFFIC_CAPTURE
+	if (TrafficCapture.IsValid())
+	{
+		TrafficCapture->Flush();
+	}
+#endif
+
+	for (int32 Priority = static_cast<int32>(EMixerMessagePriority::Normal); Priority < static_cast<int32>(EMixerMessagePriority::Count); ++Priority)
+	{
+		TArray<FOutgoingMessage>& Queue = SendQueues[Priority];
+		int32 NumSent = 0;
+		while (NumSent < Queue.Num())
+		{
+			FOutgoingMessage& Next = Queue[NumSent];
+			if (!HasSendBudget(Next.Payload.Num()))
+			{
+				break;
+			}
+
+			QueuedBytes -= Next.Payload.Num();
+			ActuallySendMethodMessage(Next, Next.Payload);
+			++NumSent;
+		}
+		Queue.RemoveAt(0, NumSent, false);
+
+		// Lower priority traffic waits until everything above it has gone out
+		if (Queue.Num() > 0)
+		{
+			break;
+		}
+	}
+}
+
+template <class T>
+void TMixerWebSocketOwnerBase<T>::GetOutgoingMessageStats(FMixerOutgoingMessageStats& OutStats) const
+{
+	OutStats.QueuedMessages = 0;
+	for (const TArray<FOutgoingMessage>& Queue : SendQueues)
+	{
+		OutStats.QueuedMessages += Queue.Num();
+	}
+	OutStats.QueuedBytes = QueuedBytes;
+	OutStats.AwaitingReply = PendingReplies.Num();
+	OutStats.SentMessages = SentMessageCount;
+	OutStats.SentBytes = SentByteCount;
+	OutStats.TimedOutReplies = PendingReplies.GetTimedOutCount();
+	OutStats.EvictedReplies = PendingReplies.GetEvictedCount();
+	PendingReplies.GetLatencyHistograms(OutStats.ReplyLatencyByMethod);
 }
 
 template <class T>
 void TMixerWebSocketOwnerBase<T>::SendMethodMessageNoParams(const FString& MethodName, FServerMessageHandler Handler)
 {
-	FString PayloadString;
-	TSharedRef<CondensedWriterType> Writer = StartMethodMessage(MethodName, PayloadString);
+	FOutgoingMessage Message;
+	FMixerJsonUtf8Writer Writer = StartMethodMessage(Message, Handler, MethodName);
 	FinishMethodMessage(Writer);
-	ActuallySendMethodMessage(Handler, PayloadString);
+	QueueOrSendMethodMessage(Message, PayloadScratch);
 }
 
 template <class T>
 void TMixerWebSocketOwnerBase<T>::SendMethodMessageObjectParams(const FString& MethodName, FServerMessageHandler Handler, const FJsonSerializable& ObjectStyleParams)
 {
-	FString PayloadString;
-	TSharedRef<CondensedWriterType> Writer = StartMethodMessage(MethodName, PayloadString);
-	Writer->WriteIdentifierPrefix(MixerStringConstants::FieldNames::Params);
-	ObjectStyleParams.ToJson(Writer, false);
+	FString ParamsString;
+	TSharedRef<CondensedWriterType> ParamsWriter = TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&ParamsString);
+	ObjectStyleParams.ToJson(ParamsWriter, false);
+	ParamsWriter->Close();
+
+	FOutgoingMessage Message;
+	FMixerJsonUtf8Writer Writer = StartMethodMessage(Message, Handler, MethodName);
+	Writer.WriteKey(MixerStringConstants::FieldNames::Params);
+	Writer.WriteRawValue(ParamsString);
 	FinishMethodMessage(Writer);
-	ActuallySendMethodMessage(Handler, PayloadString);
+	QueueOrSendMethodMessage(Message, PayloadScratch);
 }
 
 template <class T>
 void TMixerWebSocketOwnerBase<T>::SendMethodMessageObjectParams(const FString& MethodName, FServerMessageHandler Handler, const TSharedRef<FJsonObject> ObjectStyleParams)
 {
-	FString PayloadString;
-	TSharedRef<CondensedWriterType> Writer = StartMethodMessage(MethodName, PayloadString);
-	Writer->WriteIdentifierPrefix(MixerStringConstants::FieldNames::Params);
-	FJsonSerializer::Serialize(ObjectStyleParams, Writer, false);
+	FOutgoingMessage Message;
+	Message.MethodName = MethodName;
+	Message.Handler = Handler;
+	Message.Id = AllocateMessageId();
+	SerializeObjectParamsMessage(Message, ObjectStyleParams, PayloadScratch);
+	QueueOrSendMethodMessage(Message, PayloadScratch);
+}
+
+template <class T>
+template <class ParamsType>
+typename TEnableIf<!TIsDerivedFrom<ParamsType, FJsonSerializable>::IsDerived>::Type TMixerWebSocketOwnerBase<T>::SendMethodMessageObjectParams(const FString& MethodName, FServerMessageHandler Handler, const ParamsType& ObjectStyleParams)
+{
+	FOutgoingMessage Message;
+	FMixerJsonUtf8Writer Writer = StartMethodMessage(Message, Handler, MethodName);
+	Writer.WriteField(MixerStringConstants::FieldNames::Params, ObjectStyleParams);
 	FinishMethodMessage(Writer);
-	ActuallySendMethodMessage(Handler, PayloadString);
+	QueueOrSendMethodMessage(Message, PayloadScratch);
 }
 
 template <class T>
 template <class ... ArgTypes>
 void TMixerWebSocketOwnerBase<T>::SendMethodMessageArrayParams(const FString& MethodName, typename TMixerWebSocketOwnerBase<T>::FServerMessageHandler Handler, ArgTypes... ArrayStyleParams)
 {
-	FString PayloadString;
-	TSharedRef<CondensedWriterType> Writer = StartMethodMessage(MethodName, PayloadString);
-	Writer->WriteArrayStart(MixerStringConstants::FieldNames::Arguments);
-	WriteRemoteMethodParams(Writer.Get(), ArrayStyleParams...);
-	Writer->WriteArrayEnd();
+	FOutgoingMessage Message;
+	FMixerJsonUtf8Writer Writer = StartMethodMessage(Message, Handler, MethodName);
+	Writer.WriteKey(MixerStringConstants::FieldNames::Arguments);
+	Writer.BeginArray();
+	WriteRemoteMethodParams(Writer, ArrayStyleParams...);
+	Writer.EndArray();
+	FinishMethodMessage(Writer);
+	QueueOrSendMethodMessage(Message, PayloadScratch);
+}
+
+template <class T>
+void TMixerWebSocketOwnerBase<T>::SendMethodMessageJsonParams(const FString& MethodName, FServerMessageHandler Handler, const ANSICHAR* Utf8ParamsJson, int32 Length, EMixerMessagePriority Priority)
+{
+	FOutgoingMessage Message;
+	FMixerJsonUtf8Writer Writer = StartMethodMessage(Message, Handler, MethodName);
+	Writer.WriteKey(MixerStringConstants::FieldNames::Params);
+	Writer.WriteRawValue(Utf8ParamsJson, Length);
 	FinishMethodMessage(Writer);
-	ActuallySendMethodMessage(Handler, PayloadString);
+	QueueOrSendMethodMessage(Message, PayloadScratch, Priority);
 }
 
 template <class T>
@@ -239,12 +764,43 @@ void TMixerWebSocketOwnerBase<T>::OnSocketMessage(const FString& MessageJsonStri
 {
 	UE_LOG(LogMixerInteractivity, Verbose, TEXT("WebSocket message %s"), *MessageJsonString);
 
+#if MIXER_WITH_TRAFFIC_CAPTURE
+	if (TrafficCapture.IsValid())
+	{
+		TrafficCapture->Record(EMixerTrafficRecordKind::Inbound, MessageJsonString);
+	}
+#endif
+
+	if (DecodeWorker.IsValid())
+	{
+		// Preserve ordering: once anything has overflowed, everything queues behind it.
+		FString Frame = MessageJsonString;
+		if (OverflowFrames.Num() > 0 || !DecodeWorker->EnqueueFrame(Frame))
+		{
+			OverflowFrames.Add(MoveTemp(Frame));
+		}
+		return;
+	}
+
+	DispatchSocketMessage(MessageJsonString);
+}
+
+template <class T>
+void TMixerWebSocketOwnerBase<T>::DispatchSocketMessage(const FString& MessageJsonString)
+{
 	bool bHandled = false;
-	TSharedRef<TJsonReader<>> JsonReader = TJsonReaderFactory<>::Create(MessageJsonString);
-	TSharedPtr<FJsonObject> JsonObj;
-	if (FJsonSerializer::Deserialize(JsonReader, JsonObj) && JsonObj.IsValid())
+	if (DispatchMode == EMixerJsonDispatchMode::Streaming)
 	{
-		bHandled = OnSocketMessage(JsonObj.Get());
+		bHandled = OnSocketMessageStreaming(MessageJsonString);
+	}
+	else
+	{
+		TSharedRef<TJsonReader<>> JsonReader = TJsonReaderFactory<>::Create(MessageJsonString);
+		TSharedPtr<FJsonObject> JsonObj;
+		if (FJsonSerializer::Deserialize(JsonReader, JsonObj) && JsonObj.IsValid())
+		{
+			bHandled = OnSocketMessage(JsonObj.Get());
+		}
 	}
 
 	if (!bHandled)
@@ -258,11 +814,50 @@ void TMixerWebSocketOwnerBase<T>::OnSocketClosed(int32 StatusCode, const FString
 {
 	UE_LOG(LogMixerInteractivity, Warning, TEXT("WebSocket closed with reason '%s'."), *Reason);
 
+#if MIXER_WITH_TRAFFIC_CAPTURE
+	if (TrafficCapture.IsValid())
+	{
+		TrafficCapture->Record(EMixerTrafficRecordKind::Close, Reason);
+		TrafficCapture.Reset();
+	}
+#endif
+
+	// The server may well have said something important (e.g. why it's closing) just before going away
+	DrainDecodeWorker();
+
 	CleanupConnection();
 
 	HandleSocketClosed(bWasClean);
 }
 
+template <class T>
+void TMixerWebSocketOwnerBase<T>::DrainDecodeWorker()
+{
+	if (!DecodeWorker.IsValid())
+	{
+		return;
+	}
+
+	// Handlers may tear down or reopen the connection, so detach everything that's left before delivering it.
+	TUniquePtr<FMixerWebSocketDecodeWorker> Worker = MoveTemp(DecodeWorker);
+	TArray<FString> RemainingFrames = MoveTemp(OverflowFrames);
+	Worker->Shutdown();
+
+	FMixerDecodedWebSocketMessage Decoded;
+	while (Worker->DequeueDecoded(Decoded))
+	{
+		if (!OnDecodedSocketMessage(Decoded))
+		{
+			UE_LOG(LogMixerInteractivity, Warning, TEXT("Failed to handle websocket message from server: %s"), *Decoded.Raw);
+		}
+	}
+
+	for (const FString& Frame : RemainingFrames)
+	{
+		DispatchSocketMessage(Frame);
+	}
+}
+
 template <class T>
 bool TMixerWebSocketOwnerBase<T>::OnSocketMessage(FJsonObject* JsonObj)
 {
@@ -273,7 +868,7 @@ bool TMixerWebSocketOwnerBase<T>::OnSocketMessage(FJsonObject* JsonObj)
 		GET_JSON_INT_RETURN_FAILURE(Id, ReplyingToMessageId);
 
 		FServerMessageHandler Handler;
-		if (ReplyHandlers.RemoveAndCopyValue(ReplyingToMessageId, Handler))
+		if (PendingReplies.Remove(ReplyingToMessageId, FPlatformTime::Seconds(), Handler))
 		{
 			if (Handler != nullptr)
 			{
@@ -281,6 +876,11 @@ bool TMixerWebSocketOwnerBase<T>::OnSocketMessage(FJsonObject* JsonObj)
 			}
 			bHandled = true;
 		}
+		else if (PendingReplies.WasRecentlyAbandoned(ReplyingToMessageId))
+		{
+			UE_LOG(LogMixerInteractivity, Verbose, TEXT("Ignoring late reply for message id %d"), ReplyingToMessageId);
+			bHandled = true;
+		}
 		else
 		{
 			UE_LOG(LogMixerInteractivity, Error, TEXT("Received unexpected reply for unknown message id %d"), ReplyingToMessageId);
@@ -312,46 +912,157 @@ bool TMixerWebSocketOwnerBase<T>::OnSocketMessage(FJsonObject* JsonObj)
 			}
 		}
 
-		FServerMessageHandler* Handler = ServerInitiatedMessageHandlers.Find(Subtype);
-		if (Handler != nullptr)
+		FMixerJsonMessageView ParamsView(Params != nullptr ? *Params : nullptr);
+		bHandled = DispatchServerInitiatedMessage(FMixerJsonSpan::FromString(Subtype), ParamsView);
+	}
+
+	return bHandled;
+}
+
+template <class T>
+bool TMixerWebSocketOwnerBase<T>::OnSocketMessageStreaming(const FString& MessageJsonString)
+{
+	FMixerJsonMessageEnvelope Envelope;
+	if (!FMixerJsonMessageEnvelope::Scan(MessageJsonString, ServerInitiatedMessageSubtypeName, ServerInitiatedMessageParamsName, Envelope))
+	{
+		UE_LOG(LogMixerInteractivity, Error, TEXT("Missing required %s field in json payload"), *MixerStringConstants::FieldNames::Type);
+		return false;
+	}
+
+	bool bHandled = false;
+	if (Envelope.Type.Equals(MixerStringConstants::MessageTypes::Reply))
+	{
+		int32 ReplyingToMessageId;
+		if (!Envelope.Id.ToInt(ReplyingToMessageId))
 		{
-			if (*Handler != nullptr)
-			{
-				(static_cast<T*>(this)->**Handler)(Params != nullptr ? Params->Get() : nullptr);
-			}
-			bHandled = true;
+			UE_LOG(LogMixerInteractivity, Error, TEXT("Missing required %s field in json payload"), *MixerStringConstants::FieldNames::Id);
+			return false;
 		}
-		else
+
+		bHandled = DispatchReply(ReplyingToMessageId, MessageJsonString);
+	}
+	else if (Envelope.Type.Equals(ServerInitiatedMessageType))
+	{
+		if (Envelope.Subtype.Kind != EMixerJsonValueKind::String)
+		{
+			UE_LOG(LogMixerInteractivity, Error, TEXT("Missing message subtype (%s)"), *ServerInitiatedMessageSubtypeName);
+			return false;
+		}
+
+		if (!Envelope.Params.IsSet())
+		{
+			UE_LOG(LogMixerInteractivity, Error, TEXT("Missing message params (%s)"), *ServerInitiatedMessageParamsName);
+			return false;
+		}
+
+		if (Envelope.Params.Kind != EMixerJsonValueKind::Object && Envelope.Params.Kind != EMixerJsonValueKind::Null)
 		{
-			bHandled = OnUnhandledServerMessage(Subtype, Params != nullptr ? *Params : nullptr);
+			UE_LOG(LogMixerInteractivity, Error, TEXT("Unexpected value %s for message params (%s)"), *Envelope.Params.ToString(), *ServerInitiatedMessageParamsName);
+			return false;
 		}
+
+		FMixerJsonMessageView ParamsView(Envelope.Params);
+		bHandled = DispatchServerInitiatedMessage(Envelope.Subtype, ParamsView);
 	}
 
 	return bHandled;
 }
 
+template <class T>
+bool TMixerWebSocketOwnerBase<T>::OnDecodedSocketMessage(FMixerDecodedWebSocketMessage& Decoded)
+{
+	switch (Decoded.Kind)
+	{
+	case FMixerDecodedWebSocketMessage::EKind::Reply:
+		return DispatchReply(Decoded.ReplyId, Decoded.Raw);
+
+	case FMixerDecodedWebSocketMessage::EKind::ServerInitiated:
+	{
+		FMixerJsonMessageView ParamsView = Decoded.ParamsObject.IsValid() ? FMixerJsonMessageView(Decoded.ParamsObject) : FMixerJsonMessageView(Decoded.GetParams());
+		return DispatchServerInitiatedMessage(FMixerJsonSpan::FromString(Decoded.Subtype), ParamsView);
+	}
+
+	default:
+		return false;
+	}
+}
+
+template <class T>
+bool TMixerWebSocketOwnerBase<T>::DispatchReply(int32 ReplyingToMessageId, const FString& MessageJsonString)
+{
+	FServerMessageHandler Handler;
+	if (!PendingReplies.Remove(ReplyingToMessageId, FPlatformTime::Seconds(), Handler))
+	{
+		if (PendingReplies.WasRecentlyAbandoned(ReplyingToMessageId))
+		{
+			UE_LOG(LogMixerInteractivity, Verbose, TEXT("Ignoring late reply for message id %d"), ReplyingToMessageId);
+			return true;
+		}
+
+		UE_LOG(LogMixerInteractivity, Error, TEXT("Received unexpected reply for unknown message id %d"), ReplyingToMessageId);
+		return false;
+	}
+
+	// Replies with no handler (the common case for fire-and-forget methods) never get deserialized
+	if (Handler != nullptr)
+	{
+		FMixerJsonSpan WholeMessage;
+		WholeMessage.Start = *MessageJsonString;
+		WholeMessage.Length = MessageJsonString.Len();
+		WholeMessage.Kind = EMixerJsonValueKind::Object;
+		FMixerJsonMessageView MessageView(WholeMessage);
+		FJsonObject* JsonObj = MessageView.GetObject();
+		if (JsonObj == nullptr)
+		{
+			return false;
+		}
+		(static_cast<T*>(this)->*Handler)(JsonObj);
+	}
+	return true;
+}
+
+template <class T>
+bool TMixerWebSocketOwnerBase<T>::DispatchServerInitiatedMessage(const FMixerJsonSpan& Subtype, FMixerJsonMessageView& Params)
+{
+	FServerMessageHandlerEntry* Entry = ServerInitiatedMessageHandlers.Find(Subtype);
+	if (Entry == nullptr)
+	{
+		return OnUnhandledServerMessage(Subtype.ToString(), Params.GetSharedObject());
+	}
+
+	if (Entry->ViewHandler != nullptr)
+	{
+		(static_cast<T*>(this)->*Entry->ViewHandler)(Params);
+	}
+	else if (Entry->ObjectHandler != nullptr)
+	{
+		(static_cast<T*>(this)->*Entry->ObjectHandler)(Params.GetObject());
+	}
+	return true;
+}
+
 template <class T>
 template <class PARAM>
-void TMixerWebSocketOwnerBase<T>::WriteSingleRemoteMethodParam(CondensedWriterType& Writer, PARAM Param1)
+void TMixerWebSocketOwnerBase<T>::WriteSingleRemoteMethodParam(FMixerJsonUtf8Writer& Writer, PARAM Param1)
 {
 	Writer.WriteValue(Param1);
 }
 
 template <class T>
 template <class PARAM>
-void TMixerWebSocketOwnerBase<T>::WriteSingleRemoteMethodParam(CondensedWriterType& Writer, const TArray<PARAM>& Param1)
+void TMixerWebSocketOwnerBase<T>::WriteSingleRemoteMethodParam(FMixerJsonUtf8Writer& Writer, const TArray<PARAM>& Param1)
 {
-	Writer.WriteArrayStart();
+	Writer.BeginArray();
 	for (const PARAM& Val : Param1)
 	{
 		Writer.WriteValue(Val);
 	}
-	Writer.WriteArrayEnd();
+	Writer.EndArray();
 }
 
 template <class T>
 template <class PARAM, class ...ArgTypes>
-void TMixerWebSocketOwnerBase<T>::WriteRemoteMethodParams(CondensedWriterType& Writer, PARAM Param1, ArgTypes... AdditionalArgs)
+void TMixerWebSocketOwnerBase<T>::WriteRemoteMethodParams(FMixerJsonUtf8Writer& Writer, PARAM Param1, ArgTypes... AdditionalArgs)
 {
 	WriteSingleRemoteMethodParam(Writer, Param1);
 	WriteRemoteMethodParams(Writer, AdditionalArgs...);
@@ -359,7 +1070,7 @@ void TMixerWebSocketOwnerBase<T>::WriteRemoteMethodParams(CondensedWriterType& W
 
 template <class T>
 template <class PARAM>
-void TMixerWebSocketOwnerBase<T>::WriteRemoteMethodParams(CondensedWriterType& Writer, PARAM Param1)
+void TMixerWebSocketOwnerBase<T>::WriteRemoteMethodParams(FMixerJsonUtf8Writer& Writer, PARAM Param1)
 {
 	WriteSingleRemoteMethodParam(Writer, Param1);
 }
\ No newline at end of file
@@ -178,7 +178,10 @@ bool FOnlineChatMixer::GetLastMessages(const FUniqueNetId& UserId, const FChatRo
 	TSharedPtr<FMixerChatConnection> Connection = FindConnectionForRoomId(RoomId);
 	if (Connection.IsValid())
 	{
-		Connection->GetMessageHistory(NumMessages, OutMessages);
+		for (FMixerChatHistory::FConstIterator It = Connection->GetMessageHistory().CreateConstIterator(); It && (NumMessages == -1 || OutMessages.Num() < NumMessages); ++It)
+		{
+			OutMessages.Add(*It);
+		}
 		return true;
 	}
 	else
@@ -145,14 +145,6 @@ private:
 	bool bIsWhisper;
 	bool bIsAction;
 	bool bIsModerated;
-
-public:
-	// Intrusive list to avoid double allocation for chat history
-	// Would be nice to use TIntrusiveList, but that doesn't support
-	// TSharedPtr as the link type, and IOnlineChat enforces that the
-	// lifetime is managed by TSharedPtr
-	TSharedPtr<FChatMessageMixerImpl> NextLink;
-	TSharedPtr<FChatMessageMixerImpl> PrevLink;
 };
 
 struct FChatPollMixerImpl : public FChatPollMixer
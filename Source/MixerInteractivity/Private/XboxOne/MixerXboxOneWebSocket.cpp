@@ -122,7 +122,18 @@ void FMixerXboxOneWebSocket::Send(const FString& Data)
 
 void FMixerXboxOneWebSocket::Send(const void* Utf8Data, SIZE_T Size, bool bIsBinary)
 {
-
+	// Socket is configured for UTF-8 messages, so binary frames aren't supported
+	if (Writer != nullptr && !bIsBinary)
+	{
+		try
+		{
+			Writer->WriteBytes(Platform::ArrayReference<uint8>(static_cast<uint8*>(const_cast<void*>(Utf8Data)), static_cast<uint32>(Size)));
+			SendOperations.Add(Writer->StoreAsync());
+		}
+		catch (...)
+		{
+		}
+	}
 }
 
 bool FMixerXboxOneWebSocket::Tick(float DeltaTime)
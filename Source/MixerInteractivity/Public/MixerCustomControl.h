@@ -39,7 +39,9 @@ protected:
 	/**
 	* Collect the set of UProperties that may be written by the client and should
 	* be transmitted to the server.  If this collection is non-empty the control
-	* instance will be ticked every ClientPropertyUpdateInterval seconds.
+	* instance will be checked for changes every ClientPropertyUpdateInterval seconds.
+	* Called once per instance, but the first result for a class is used for all
+	* instances of it.
 	* Default implementation collects all properties that are BlueprintReadWrite.
 	*
 	* @param	OutProperties		Out parameter to be filled with UProperty instances for which updates should be sent client->server
@@ -55,20 +57,15 @@ public:
 	FName ControlName;
 
 public:
-	virtual ~UMixerCustomControl();
-
 	virtual void PostLoad() override;
+	virtual void BeginDestroy() override;
 
 public:
-	bool Tick(float DeltaTime);
-
 	UFUNCTION(BlueprintImplementableEvent)
 	void OnServerPropertiesUpdated();
 
 private:
-	void InitClientWrittenPropertyMaintenance();
+	friend class FMixerCustomControlReplicator;
 
-private:
-	TArray<UProperty*> ClientWritableProperties;
-	TArray<uint8> LastSentPropertyData;
+	void InitClientWrittenPropertyMaintenance();
 };
\ No newline at end of file
@@ -21,9 +21,34 @@
 
 #include "MixerDynamicDelegateBinding.generated.h"
 
+/** Latest position of one participant's joystick, as delivered to coalesced Blueprint joystick events. */
+USTRUCT(BlueprintType)
+struct MIXERINTERACTIVITY_API FMixerStickParticipantMove
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category = "Mixer|Interactivity")
+	int32 ParticipantId;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Mixer|Interactivity")
+	float XAxis;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Mixer|Interactivity")
+	float YAxis;
+
+	FMixerStickParticipantMove()
+		: ParticipantId(0)
+		, XAxis(0.0f)
+		, YAxis(0.0f)
+	{
+	}
+};
+
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_FourParams(FMixerButtonEventDynamicDelegate, FMixerButtonReference, Button, int32, ParticipantId, FMixerTransactionId, TransactionId, int32, SparkCost);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_FiveParams(FMixerCoalescedButtonEventDynamicDelegate, FMixerButtonReference, Button, int32, ParticipantId, FMixerTransactionId, TransactionId, int32, SparkCost, int32, PressCount);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FMixerParticipantEventDynamicDelegate, int32, ParticipantId);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_FourParams(FMixerStickEventDynamicDelegate, FMixerStickReference, Joystick, int32, ParticipantId, float, XAxis, float, YAxis);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FMixerStickFrameEventDynamicDelegate, FMixerStickReference, Joystick, const TArray<FMixerStickParticipantMove>&, Moves);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE(FMixerBroadcastingEventDynamicDelegate);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_FiveParams(FMixerTextSubmittedEventDynamicDelegate, FMixerTextboxReference, Textbox, int32, ParticipantId, FText, SubmittedText, FMixerTransactionId, TransactionId, int32, SparkCost);
 
@@ -33,6 +58,38 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FMixerCustomControlUpdateDynamicDele
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE(FMixerCustomMethodStubDelegate);
 
+/** How a Blueprint button event is delivered when a button is used many times in one frame. */
+UENUM()
+enum class EMixerButtonEventCoalescing : uint8
+{
+	/** One event for every press or release. */
+	None,
+
+	/**
+	* At most one press event and one release event per frame, for the last participant to use the
+	* button.  PressCount says how many presses (or releases) the event stands for.  Presses that
+	* carry a spark transaction still get an event each, with a PressCount of 1.
+	*/
+	OncePerFrame,
+};
+
+/** How a Blueprint joystick event is delivered when a joystick moves many times in one frame. */
+UENUM()
+enum class EMixerStickEventCoalescing : uint8
+{
+	/** One event for every move. */
+	None,
+
+	/** One event per frame carrying the latest position of every participant who moved the joystick. */
+	LatestPerParticipant,
+
+	/**
+	* One event every frame, whether or not anyone moved the joystick, with its aggregate
+	* position across all participants as returned by GetStickState, and a ParticipantId of 0.
+	*/
+	Aggregate,
+};
+
 USTRUCT()
 struct MIXERINTERACTIVITY_API FMixerButtonEventDynamicDelegateWrapper
 {
@@ -44,10 +101,26 @@ struct MIXERINTERACTIVITY_API FMixerButtonEventDynamicDelegateWrapper
 	UPROPERTY()
 	FMixerButtonEventDynamicDelegate ReleasedDelegate;
 
+	UPROPERTY()
+	FMixerCoalescedButtonEventDynamicDelegate CoalescedPressedDelegate;
+
+	UPROPERTY()
+	FMixerCoalescedButtonEventDynamicDelegate CoalescedReleasedDelegate;
+
 	bool IsBound()
+	{
+		return HasPerInputBindings() || HasCoalescedBindings();
+	}
+
+	bool HasPerInputBindings()
 	{
 		return PressedDelegate.IsBound() || ReleasedDelegate.IsBound();
 	}
+
+	bool HasCoalescedBindings()
+	{
+		return CoalescedPressedDelegate.IsBound() || CoalescedReleasedDelegate.IsBound();
+	}
 };
 
 USTRUCT()
@@ -58,10 +131,26 @@ struct MIXERINTERACTIVITY_API FMixerStickEventDynamicDelegateWrapper
 	UPROPERTY()
 	FMixerStickEventDynamicDelegate Delegate;
 
+	UPROPERTY()
+	FMixerStickFrameEventDynamicDelegate LatestPerParticipantDelegate;
+
+	UPROPERTY()
+	FMixerStickEventDynamicDelegate AggregateDelegate;
+
 	bool IsBound()
+	{
+		return HasPerInputBindings() || HasCoalescedBindings();
+	}
+
+	bool HasPerInputBindings()
 	{
 		return Delegate.IsBound();
 	}
+
+	bool HasCoalescedBindings()
+	{
+		return LatestPerParticipantDelegate.IsBound() || AggregateDelegate.IsBound();
+	}
 };
 
 USTRUCT()
@@ -121,6 +210,26 @@ struct MIXERINTERACTIVITY_API FMixerCustomMethodStubDelegateWrapper
 };
 
 
+/** A button event for a coalesced binding, gathered from an input frame before any are broadcast. */
+struct FMixerCoalescedButtonEvent
+{
+	FName ButtonName;
+	uint32 ParticipantId;
+	uint32 SparkCost;
+	int32 TransactionIndex;
+	/** Number of presses or releases merged into this event. */
+	int32 Count;
+	bool Pressed;
+};
+
+/** Latest position of each participant who moved a joystick with LatestPerParticipant bindings this frame. */
+struct FMixerCoalescedStickFrame
+{
+	/** Broadcast as is to LatestPerParticipant bindings. */
+	TArray<FMixerStickParticipantMove> LatestMoves;
+	TMap<uint32, int32> MoveIndexByParticipant;
+};
+
 UCLASS()
 class MIXERINTERACTIVITY_API UMixerInteractivityBlueprintEventSource : public UObject
 {
@@ -146,8 +255,9 @@ public:
 	FMixerBroadcastingEventDynamicDelegate BroadcastingStoppedDelegate;
 
 public:
-	FMixerButtonEventDynamicDelegate* GetButtonEvent(FName ButtonName, bool Pressed);
-	FMixerStickEventDynamicDelegate* GetStickEvent(FName StickName);
+	/** The signature of the returned event depends on the coalescing mode, so only its script delegate base is exposed. */
+	FMulticastScriptDelegate* GetButtonEvent(FName ButtonName, bool Pressed, EMixerButtonEventCoalescing Coalescing = EMixerButtonEventCoalescing::None);
+	FMulticastScriptDelegate* GetStickEvent(FName StickName, EMixerStickEventCoalescing Coalescing = EMixerStickEventCoalescing::None);
 	FMixerCustomControlInputDynamicDelegate& GetCustomControlInputEvent(FName ControlName);
 	FMixerCustomControlUpdateDynamicDelegate& GetCustomControlUpdateEvent(FName ControlName);
 	void AddCustomMethodBinding(FName EventName, UObject* TargetObject, FName TargetFunctionName);
@@ -163,6 +273,7 @@ public:
 	void OnCustomControlInputNativeEvent(FName ControlName, FName EventType, TSharedPtr<const FMixerRemoteUser> Participant, const TSharedRef<FJsonObject> EventPayload);
 	void OnCustomControlPropertyUpdateNativeEvent(FName ControlName, const TSharedRef<FJsonObject> UpdatedProperties);
 	void OnTextboxSubmitNativeEvent(FName TextboxName, TSharedPtr<const FMixerRemoteUser> Participant, const FMixerTextboxEventDetails& Details);
+	void OnInputFrameNativeEvent(const FMixerInputFrame& Frame);
 
 #if WITH_EDITORONLY_DATA
 	void RefreshCustomControls();
@@ -192,6 +303,21 @@ private:
 	UPROPERTY()
 	TMap<FName, FMixerTextboxEventDynamicDelegateWrapper> TextboxDelegates;
 
+	/** Scratch space for OnInputFrameNativeEvent, kept between frames to reuse allocations. */
+	TArray<FMixerCoalescedButtonEvent> CoalescedButtonEvents;
+	TMap<FName, int32> CoalescedPressIndices;
+	TMap<FName, int32> CoalescedReleaseIndices;
+	TMap<FName, FMixerCoalescedStickFrame> CoalescedStickFrames;
+	TArray<FName> CoalescedSticksThisFrame;
+	TArray<TPair<FName, FVector2D>> AggregateStickAxes;
+
+	/**
+	* Names of buttons and joysticks with coalesced bindings, indexed by control handle, so input
+	* frame records can be matched to bindings without looking their names up.  NAME_None elsewhere.
+	*/
+	TArray<FName> ButtonNamesByHandle;
+	TArray<FName> StickNamesByHandle;
+
 public:
 	static UMixerInteractivityBlueprintEventSource* GetBlueprintEventSource(UWorld* ForWorld);
 
@@ -214,6 +340,15 @@ struct FMixerButtonEventBinding
 
 	UPROPERTY()
 	bool Pressed;
+
+	UPROPERTY()
+	EMixerButtonEventCoalescing Coalescing;
+
+	FMixerButtonEventBinding()
+		: Pressed(false)
+		, Coalescing(EMixerButtonEventCoalescing::None)
+	{
+	}
 };
 
 UENUM()
@@ -237,6 +372,16 @@ struct FMixerGenericEventBinding
 
 	UPROPERTY()
 	EMixerGenericEventBindingType BindingType;
+
+	/** Only used by Stick bindings. */
+	UPROPERTY()
+	EMixerStickEventCoalescing StickCoalescing;
+
+	FMixerGenericEventBinding()
+		: BindingType(EMixerGenericEventBindingType::Stick)
+		, StickCoalescing(EMixerStickEventCoalescing::None)
+	{
+	}
 };
 
 USTRUCT()
@@ -169,6 +169,57 @@ struct TStructOpsTypeTraits<FMixerTextboxReference> : public TStructOpsTypeTrait
 	};
 };
 
+/** A button resolved ahead of time with ResolveButton, so that polling it doesn't look it up by name. */
+USTRUCT(BlueprintType)
+struct MIXERINTERACTIVITY_API FMixerResolvedButton
+{
+public:
+	GENERATED_BODY()
+
+	FMixerResolvedButton()
+		: Index(INDEX_NONE)
+	{
+	}
+
+public:
+	UPROPERTY()
+	int32 Index;
+};
+
+/** A joystick resolved ahead of time with ResolveStick, so that polling it doesn't look it up by name. */
+USTRUCT(BlueprintType)
+struct MIXERINTERACTIVITY_API FMixerResolvedStick
+{
+public:
+	GENERATED_BODY()
+
+	FMixerResolvedStick()
+		: Index(INDEX_NONE)
+	{
+	}
+
+public:
+	UPROPERTY()
+	int32 Index;
+};
+
+/** A label resolved ahead of time with ResolveLabel, so that polling it doesn't look it up by name. */
+USTRUCT(BlueprintType)
+struct MIXERINTERACTIVITY_API FMixerResolvedLabel
+{
+public:
+	GENERATED_BODY()
+
+	FMixerResolvedLabel()
+		: Index(INDEX_NONE)
+	{
+	}
+
+public:
+	UPROPERTY()
+	int32 Index;
+};
+
 USTRUCT(BlueprintType)
 struct MIXERINTERACTIVITY_API FMixerTransactionId
 {
@@ -286,6 +337,24 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Mixer|Interactivity", Meta=(AdvancedDisplay = "7"))
 	static void GetButtonState(FMixerButtonReference Button, FTimespan& RemainingCooldown, float& Progress, int32& DownCount, int32& PressCount, int32& UpCount, bool& Enabled, int32 ParticipantId = 0);
 
+	/**
+	* Resolve a button once so that it can be polled every frame without a lookup by name.
+	* The result remains valid across interactive sessions and may be stored in a variable.
+	*
+	* @param	Button			Reference to the button to resolve.
+	*/
+	UFUNCTION(BlueprintPure, Category = "Mixer|Interactivity")
+	static FMixerResolvedButton ResolveButton(FMixerButtonReference Button);
+
+	/**
+	* Retrieve information about a resolved button that is dependent on remote user and title interactions,
+	* aggregated over all participants.  See GetButtonState for details of the outputs.
+	*
+	* @param	Button			Button returned by ResolveButton.
+	*/
+	UFUNCTION(BlueprintPure, Category = "Mixer|Interactivity")
+	static void GetResolvedButtonState(FMixerResolvedButton Button, FTimespan& RemainingCooldown, float& Progress, int32& DownCount, int32& PressCount, int32& UpCount, bool& Enabled);
+
 	/**
 	* Retrieve information about a joystick that is independent of its current state.
 	*
@@ -307,6 +376,24 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Mixer|Interactivity", Meta = (AdvancedDisplay = "4"))
 	static void GetStickState(FMixerStickReference Stick, float& XAxis, float& YAxis, bool& Enabled, int32 ParticipantId = 0);
 
+	/**
+	* Resolve a joystick once so that it can be polled every frame without a lookup by name.
+	* The result remains valid across interactive sessions and may be stored in a variable.
+	*
+	* @param	Stick			Reference to the joystick to resolve.
+	*/
+	UFUNCTION(BlueprintPure, Category = "Mixer|Interactivity")
+	static FMixerResolvedStick ResolveStick(FMixerStickReference Stick);
+
+	/**
+	* Retrieve information about a resolved joystick that is dependent on remote user and title interactions,
+	* aggregated over all participants.  See GetStickState for details of the outputs.
+	*
+	* @param	Stick			Joystick returned by ResolveStick.
+	*/
+	UFUNCTION(BlueprintPure, Category = "Mixer|Interactivity")
+	static void GetResolvedStickState(FMixerResolvedStick Stick, float& XAxis, float& YAxis, bool& Enabled);
+
 	/**
 	* Change the text that will be displayed to remote users on a label.
 	*
@@ -331,6 +418,23 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Mixer|Interactivity")
 	static void GetLabelDescription(FMixerLabelReference Label, FText& Text, FString& TextSize, FColor& TextColor, bool& Bold, bool& Underline, bool& Italic);
 
+	/**
+	* Resolve a label once so that it can be queried repeatedly without a lookup by name.
+	* The result remains valid across interactive sessions and may be stored in a variable.
+	*
+	* @param	Label			Reference to the label to resolve.
+	*/
+	UFUNCTION(BlueprintPure, Category = "Mixer|Interactivity")
+	static FMixerResolvedLabel ResolveLabel(FMixerLabelReference Label);
+
+	/**
+	* Retrieve information about properties of a resolved label.  See GetLabelDescription for details of the outputs.
+	*
+	* @param	Label			Label returned by ResolveLabel.
+	*/
+	UFUNCTION(BlueprintPure, Category = "Mixer|Interactivity")
+	static void GetResolvedLabelDescription(FMixerResolvedLabel Label, FText& Text, FString& TextSize, FColor& TextColor, bool& Bold, bool& Underline, bool& Italic);
+
 	/**
 	* Retrieve information about properties of a textbox that are configured at design time and
 	* are expected to change infrequently (or not at all) during runtime.
@@ -391,6 +495,14 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Mixer|Interactivity")
 	static void GetParticipantsInGroup(FMixerGroupReference Group, TArray<int32>& ParticipantIds);
 
+	/**
+	* Get the number of users assigned to a group.
+	*
+	* @param	Group			Reference to the user group whose members should be counted.
+	*/
+	UFUNCTION(BlueprintPure, Category = "Mixer|Interactivity")
+	static int32 GetParticipantCountInGroup(FMixerGroupReference Group);
+
 	/**
 	* Move a user to a new group.  The group must already exist.
 	*
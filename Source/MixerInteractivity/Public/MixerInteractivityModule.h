@@ -21,8 +21,13 @@ struct FMixerStickDescription;
 struct FMixerStickState;
 struct FMixerLabelDescription;
 struct FMixerTextboxDescription;
+struct FMixerButtonHandle;
+struct FMixerStickHandle;
+struct FMixerLabelHandle;
+struct FMixerTextboxHandle;
 struct FMixerButtonEventDetails;
 struct FMixerTextboxEventDetails;
+struct FMixerOutgoingMessageStats;
 class FUniqueNetId;
 class FJsonObject;
 
@@ -189,6 +194,41 @@ public:
 	*/
 	virtual bool GetButtonState(FName Button, uint32 ParticipantId, FMixerButtonState& OutState) = 0;
 
+	/**
+	* Retrieve information about a named button that is dependent on remote user and title interactions.
+	* See FMixerButtonState for details.
+	* This overload reports the aggregate state of the button over the participants in a single group.
+	*
+	* @param	Button			Name of the button for which information should be returned.
+	* @param	GroupName		Name of the group whose participants should be aggregated.
+	* @param	OutState		Out parameter filled in with information about the button upon success.
+	*
+	* @Return					True if button was found and OutState is valid.
+	*/
+	virtual bool GetButtonStateForGroup(FName Button, FName GroupName, FMixerButtonState& OutState) = 0;
+
+	/**
+	* Retrieve how heavily a named button has been pressed over the session so far.  Only
+	* completed input intervals are included.  See FMixerButtonPressHistogram for details.
+	*
+	* @param	Button			Name of the button for which information should be returned.
+	* @param	OutHistogram	Out parameter filled in with the button's press history upon success.
+	*
+	* @Return					True if button was found and OutHistogram is valid.
+	*/
+	virtual bool GetButtonPressHistogram(FName Button, FMixerButtonPressHistogram& OutHistogram) = 0;
+
+	/**
+	* Find the remote users who are currently holding down all of a set of buttons.
+	* Requires that per-participant state caching is enabled.
+	*
+	* @param	ButtonNames			Names of the buttons that must all be held.
+	* @param	OutParticipantIds	Out parameter filled in with Mixer ids of the matching remote users upon success.
+	*
+	* @Return						True if every button was found and OutParticipantIds is valid.
+	*/
+	virtual bool GetParticipantsHoldingButtons(const TArray<FName>& ButtonNames, TArray<uint32>& OutParticipantIds) = 0;
+
 	/**
 	* Retrieve information about a named joystick that is independent of its current state.
 	* See FMixerStickDescription for details.
@@ -225,6 +265,19 @@ public:
 	*/
 	virtual bool GetStickState(FName Stick, uint32 ParticipantId, FMixerStickState& OutState) = 0;
 
+	/**
+	* Retrieve information about a named joystick that is dependent on remote user and title interactions.
+	* See FMixerStickState for details.
+	* This overload reports the aggregate state of the stick over the participants in a single group.
+	*
+	* @param	Stick			Name of the joystick for which information should be returned.
+	* @param	GroupName		Name of the group whose participants should be aggregated.
+	* @param	OutState		Out parameter filled in with information about the joystick upon success.
+	*
+	* @Return					True if joystick was found and OutState is valid.
+	*/
+	virtual bool GetStickStateForGroup(FName Stick, FName GroupName, FMixerStickState& OutState) = 0;
+
 	/**
 	* Change the text that will be displayed to remote users on the named label.
 	*
@@ -257,6 +310,41 @@ public:
 	*/
 	virtual bool GetTextboxDescription(FName Textbox, FMixerTextboxDescription& OutDesc) = 0;
 
+	/**
+	* Resolve the name of a button to a handle that can be used in place of the name to
+	* poll it without a lookup by name.  See FMixerControlHandle for details.
+	* Names need not refer to a control in the current session (or any session yet).
+	*
+	* @param	Button			Name of the button.
+	*
+	* @Return					Handle for the button, unset if this implementation does not support handles.
+	*/
+	virtual FMixerButtonHandle ResolveButton(FName Button) = 0;
+
+	/** As GetButtonDescription, taking a handle from ResolveButton. */
+	virtual bool GetButtonDescription(FMixerButtonHandle Button, FMixerButtonDescription& OutDesc) = 0;
+
+	/** As the aggregate overload of GetButtonState, taking a handle from ResolveButton. */
+	virtual bool GetButtonState(FMixerButtonHandle Button, FMixerButtonState& OutState) = 0;
+
+	/** As ResolveButton, for joysticks. */
+	virtual FMixerStickHandle ResolveStick(FName Stick) = 0;
+
+	/** As the aggregate overload of GetStickState, taking a handle from ResolveStick. */
+	virtual bool GetStickState(FMixerStickHandle Stick, FMixerStickState& OutState) = 0;
+
+	/** As ResolveButton, for labels. */
+	virtual FMixerLabelHandle ResolveLabel(FName Label) = 0;
+
+	/** As GetLabelDescription, taking a handle from ResolveLabel. */
+	virtual bool GetLabelDescription(FMixerLabelHandle Label, FMixerLabelDescription& OutDesc) = 0;
+
+	/** As ResolveButton, for textboxes. */
+	virtual FMixerTextboxHandle ResolveTextbox(FName Textbox) = 0;
+
+	/** As GetTextboxDescription, taking a handle from ResolveTextbox. */
+	virtual bool GetTextboxDescription(FMixerTextboxHandle Textbox, FMixerTextboxDescription& OutDesc) = 0;
+
 	/**
 	* Retrieve information about a named custom control.  Information may include both static 
 	* (similar to Get*Description methods above) and dynamic (similar to Get*State methods) data.
@@ -323,6 +411,26 @@ public:
 	*/
 	virtual bool GetParticipantsInGroup(FName GroupName, TArray<TSharedPtr<const FMixerRemoteUser>>& OutParticipants) = 0;
 
+	/**
+	* Retrieve the ids of participants that belong to the named group.  Cheaper than GetParticipantsInGroup
+	* when only the ids are needed.
+	*
+	* @param	GroupName			Name of the group for which to retrieve participants.
+	* @param	OutParticipantIds	Out parameter filled with the Mixer ids of members of the named group.
+	*
+	* @Return						True if the group exists (even if it is empty).  False otherwise.
+	*/
+	virtual bool GetParticipantIdsInGroup(FName GroupName, TArray<uint32>& OutParticipantIds) = 0;
+
+	/**
+	* Count the participants that belong to the named group.
+	*
+	* @param	GroupName		Name of the group to count.
+	*
+	* @Return					Number of members, or 0 if the group doesn't exist.
+	*/
+	virtual int32 GetParticipantCountInGroup(FName GroupName) = 0;
+
 	/**
 	* Move a single participant to the named group.
 	*
@@ -344,6 +452,15 @@ public:
 
 	virtual void CallRemoteMethod(const FString& MethodName, const TSharedRef<FJsonObject> MethodParams) = 0;
 
+	/**
+	* Retrieve statistics about traffic being sent to the Mixer service.
+	*
+	* @param	OutStats		Current queue depth and send totals.
+	*
+	* @Return					True if the active backend queues outgoing messages and stats were returned.
+	*/
+	virtual bool GetOutgoingMessageStats(FMixerOutgoingMessageStats& OutStats) = 0;
+
 	/**
 	* Get access to Mixer chat via UE's standard IOnlineChat interface.
 	* Sending messages requires a logged in user.
@@ -380,6 +497,16 @@ public:
 	DECLARE_EVENT_ThreeParams(IMixerInteractivityModule, FOnTextboxSubmitEvent, FName, TSharedPtr<const FMixerRemoteUser>, const FMixerTextboxEventDetails&);
 	virtual FOnTextboxSubmitEvent& OnTextboxSubmitEvent() = 0;
 
+	/**
+	* Fired once per frame with all button, joystick and textbox input received during the frame,
+	* even if there was none.  Input is only batched while something is bound, and the per-event
+	* delegates above only fire while something is bound to them, so listening here instead of
+	* there avoids paying for an individual broadcast per input.  The frame is only valid for the
+	* duration of the call.
+	*/
+	DECLARE_EVENT_OneParam(IMixerInteractivityModule, FOnInputFrame, const FMixerInputFrame&);
+	virtual FOnInputFrame& OnInputFrame() = 0;
+
 	DECLARE_EVENT_OneParam(IMixerInteractivityModule, FOnBroadcastingStateChanged, bool);
 	virtual FOnBroadcastingStateChanged& OnBroadcastingStateChanged() = 0;
 
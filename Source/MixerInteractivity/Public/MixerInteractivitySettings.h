@@ -28,6 +28,37 @@ struct FMixerPredefinedGroup
 	FName InitialScene;
 };
 
+USTRUCT()
+struct FMixerControlPropertyUpdateRule
+{
+	GENERATED_BODY()
+
+	/** Control property this rule applies to, as named on the wire (e.g. progress). */
+	UPROPERTY(EditAnywhere, Category = "Networking")
+	FString Property;
+
+	/** Numeric changes no larger than this, relative to the value last sent, are not sent at all. */
+	UPROPERTY(EditAnywhere, Category = "Networking", meta = (ClampMin = "0.0"))
+	float Tolerance;
+
+	/** Changes are sent on the next frame regardless of the control update rate and byte limits. */
+	UPROPERTY(EditAnywhere, Category = "Networking")
+	bool bUrgent;
+
+	FMixerControlPropertyUpdateRule()
+		: Tolerance(0.0f)
+		, bUrgent(false)
+	{
+	}
+
+	FMixerControlPropertyUpdateRule(const FString& InProperty, float InTolerance, bool bInUrgent)
+		: Property(InProperty)
+		, Tolerance(InTolerance)
+		, bUrgent(bInUrgent)
+	{
+	}
+};
+
 UCLASS(config=Game, defaultconfig)
 class MIXERINTERACTIVITY_API UMixerInteractivitySettings : public UObject
 {
@@ -110,6 +141,86 @@ public:
 	UPROPERTY(EditAnywhere, Config, Category = "Interactive Controls", AdvancedDisplay, meta = (DisplayName = "Track built-in control state per remote participant"))
 	bool bPerParticipantStateCaching;
 
+	/**
+	* Fraction of remote users' joystick positions discarded from each end of each axis
+	* when computing a joystick's trimmed mean.
+	*/
+	UPROPERTY(EditAnywhere, Config, Category = "Interactive Controls", AdvancedDisplay, meta = (EditCondition = "bPerParticipantStateCaching", ClampMin = "0.0", ClampMax = "0.49"))
+	float StickTrimFraction;
+
+	/**
+	* Parse messages from the Mixer service on a worker thread instead of the game thread.
+	* Parsed messages are handed to the game thread each frame, subject to the budget below.
+	* Only affects backends that communicate with the service directly over websockets.
+	*/
+	UPROPERTY(EditAnywhere, Config, Category = "Networking", AdvancedDisplay)
+	bool bDecodeMessagesOffGameThread;
+
+	/**
+	* Maximum time in milliseconds spent each frame handling messages parsed off the game thread.
+	* Remaining messages are deferred to the next frame.  At least one message is always handled.
+	*/
+	UPROPERTY(EditAnywhere, Config, Category = "Networking", AdvancedDisplay, meta = (EditCondition = "bDecodeMessagesOffGameThread", ClampMin = "0.0"))
+	float MessageHandlingBudgetMs;
+
+	/**
+	* Approximate limit on bytes per second sent to the Mixer service.  Spark captures and
+	* ready state changes are never delayed; other messages queue (and control updates
+	* coalesce) until there is budget to send them.  0 means no limit.
+	*/
+	UPROPERTY(EditAnywhere, Config, Category = "Networking", AdvancedDisplay, meta = (ClampMin = "0"))
+	int32 OutgoingBytesPerSecondLimit;
+
+	/**
+	* Most updateControls messages sent per second for any one scene.  Changes made in between
+	* are merged and sent together.  0 means no limit.
+	*/
+	UPROPERTY(EditAnywhere, Config, Category = "Networking", AdvancedDisplay, meta = (ClampMin = "0.0"))
+	float MaxSceneUpdatesPerSecond;
+
+	/** Most times per second changes to any one control are sent.  0 means no limit. */
+	UPROPERTY(EditAnywhere, Config, Category = "Networking", AdvancedDisplay, meta = (ClampMin = "0.0"))
+	float MaxControlUpdatesPerSecond;
+
+	/**
+	* Approximate limit on bytes per second of control updates, applied before the overall
+	* outgoing limit above.  0 means no limit.
+	*/
+	UPROPERTY(EditAnywhere, Config, Category = "Networking", AdvancedDisplay, meta = (ClampMin = "0"))
+	int32 ControlUpdateBytesPerSecondLimit;
+
+	/** Per-property exceptions to the control update limits.  Changes apply from the next interactive connection. */
+	UPROPERTY(EditAnywhere, Config, Category = "Networking", AdvancedDisplay)
+	TArray<FMixerControlPropertyUpdateRule> ControlPropertyUpdateRules;
+
+	/** Seconds to wait for the Mixer service to reply to a request before giving up on it. */
+	UPROPERTY(EditAnywhere, Config, Category = "Networking", AdvancedDisplay, meta = (ClampMin = "1.0"))
+	float ReplyTimeoutSeconds;
+
+	/**
+	* Connect to this websocket url for interactivity instead of asking mixer.com for hosts.
+	* Use loopback://interactive for a simulated service running inside the game (non-shipping
+	* builds only), which also skips user login.
+	*/
+	UPROPERTY(EditAnywhere, Config, Category = "Networking", AdvancedDisplay)
+	FString InteractiveEndpointOverride;
+
+	/**
+	* Connect to this websocket url for chat instead of looking up the channel's chat servers
+	* on mixer.com.  Use loopback://chat for a simulated service running inside the game.
+	*/
+	UPROPERTY(EditAnywhere, Config, Category = "Networking", AdvancedDisplay)
+	FString ChatEndpointOverride;
+
+	/**
+	* If set, every websocket connection to the Mixer service records its traffic to a .mxcap file
+	* in this directory (relative paths are under the project's Saved directory).  Captures can
+	* be played back through an endpoint override of the form replay://<path to capture>.
+	* Ignored in shipping builds.  Chat auth keys are redacted from captures.
+	*/
+	UPROPERTY(EditAnywhere, Config, Category = "Networking", AdvancedDisplay)
+	FString TrafficCaptureDirectory;
+
 public:
 	FString GetResolvedRedirectUri() const
 	{
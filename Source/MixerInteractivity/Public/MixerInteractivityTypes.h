@@ -11,6 +11,7 @@
 #pragma once
 
 #include "Containers/UnrealString.h"
+#include "Containers/Map.h"
 #include "Misc/DateTime.h"
 #include "Internationalization/Text.h"
 #include "Math/Vector2D.h"
@@ -176,6 +177,55 @@ struct FMixerButtonState
 	bool Enabled;
 };
 
+/**
+* Distribution of the number of presses a button received per input interval (one tick),
+* over the intervals of the session in which it was pressed at least once.
+*/
+struct FMixerButtonPressHistogram
+{
+public:
+	/** Bucket i counts intervals with at least 2^i presses and, except for the last bucket, fewer than 2^(i+1). */
+	static const int32 NumBuckets = 16;
+
+	FMixerButtonPressHistogram()
+		: Intervals(0)
+		, TotalPresses(0)
+		, MaxPresses(0)
+	{
+		FMemory::Memzero(Buckets);
+	}
+
+	void AddInterval(uint32 Presses)
+	{
+		if (Presses > 0)
+		{
+			++Buckets[FMath::Min(static_cast<int32>(FMath::FloorLog2(Presses)), NumBuckets - 1)];
+			++Intervals;
+			TotalPresses += Presses;
+			MaxPresses = FMath::Max(MaxPresses, Presses);
+		}
+	}
+
+	static uint32 GetBucketLowerBound(int32 Bucket)
+	{
+		return 1u << Bucket;
+	}
+
+	double GetAveragePresses() const
+	{
+		return Intervals > 0 ? static_cast<double>(TotalPresses) / Intervals : 0.0;
+	}
+
+public:
+	uint32 Buckets[NumBuckets];
+
+	/** Number of intervals in which the button was pressed. */
+	uint32 Intervals;
+
+	uint64 TotalPresses;
+	uint32 MaxPresses;
+};
+
 /** Represents the Studio-configured properties of a joystick that
 * are immutable during an interactive session */
 struct FMixerStickDescription
@@ -191,6 +241,25 @@ struct FMixerStickState
 	/** Current aggregate state of the joystick [-1,1] */
 	FVector2D Axes;
 
+	/** Per-axis variance of the participant positions averaged into Axes. */
+	FVector2D AxesVariance;
+
+	/** Aggregate state of the joystick with each remote user weighted by their Mixer level. */
+	FVector2D LevelWeightedAxes;
+
+	/** Per-axis median of the participant positions. */
+	FVector2D MedianAxes;
+
+	/**
+	* Per-axis mean of the participant positions after discarding the most extreme on
+	* each side, so a few remote users can't drag the result around on their own.
+	* See UMixerInteractivitySettings::StickTrimFraction.
+	*/
+	FVector2D TrimmedMeanAxes;
+
+	/** Number of remote users currently deflecting the joystick. */
+	uint32 ParticipantCount;
+
 	/** NOT IMPLEMENTED. Whether the button is currently enabled. */
 	bool Enabled;
 };
@@ -276,6 +345,231 @@ struct FMixerTextboxDescription
 	bool HasSubmit;
 };
 
+/**
+* Pre-resolved reference to a control, for game code that polls the same controls every frame.
+* Obtained from IMixerInteractivityModule::ResolveButton and friends.  A handle stays valid
+* for the lifetime of the module, including across interactive sessions, and refers to the
+* same control for as long as the project keeps a control with that name.
+*/
+struct FMixerControlHandle
+{
+	/** Dense index of the control among controls of the same kind.  INDEX_NONE if unset. */
+	int32 Index;
+
+	bool IsSet() const
+	{
+		return Index != INDEX_NONE;
+	}
+
+protected:
+	FMixerControlHandle()
+		: Index(INDEX_NONE)
+	{
+	}
+
+	explicit FMixerControlHandle(int32 InIndex)
+		: Index(InIndex)
+	{
+	}
+};
+
+struct FMixerButtonHandle : public FMixerControlHandle
+{
+	FMixerButtonHandle() {}
+	explicit FMixerButtonHandle(int32 InIndex) : FMixerControlHandle(InIndex) {}
+};
+
+struct FMixerStickHandle : public FMixerControlHandle
+{
+	FMixerStickHandle() {}
+	explicit FMixerStickHandle(int32 InIndex) : FMixerControlHandle(InIndex) {}
+};
+
+struct FMixerLabelHandle : public FMixerControlHandle
+{
+	FMixerLabelHandle() {}
+	explicit FMixerLabelHandle(int32 InIndex) : FMixerControlHandle(InIndex) {}
+};
+
+struct FMixerTextboxHandle : public FMixerControlHandle
+{
+	FMixerTextboxHandle() {}
+	explicit FMixerTextboxHandle(int32 InIndex) : FMixerControlHandle(InIndex) {}
+};
+
+/** A button press or release recorded in an FMixerInputFrame. */
+struct FMixerButtonInput
+{
+	/** Same handle as IMixerInteractivityModule::ResolveButton returns for the button's name. */
+	FMixerButtonHandle Button;
+
+	/** Mixer id of the remote user, or 0 if they weren't known. */
+	uint32 ParticipantId;
+
+	/** Number of sparks that will be charged for this interaction, if confirmed */
+	uint32 SparkCost;
+
+	/** Index into FMixerInputFrame::TransactionIds, or INDEX_NONE if there is no transaction. */
+	int32 TransactionIndex;
+
+	/** Whether the button event represents a press (true) or release (false) */
+	bool Pressed;
+};
+
+/** A joystick move recorded in an FMixerInputFrame. */
+struct FMixerStickInput
+{
+	/** Same handle as IMixerInteractivityModule::ResolveStick returns for the joystick's name. */
+	FMixerStickHandle Stick;
+
+	/** Mixer id of the remote user, or 0 if they weren't known. */
+	uint32 ParticipantId;
+
+	/** Position of the remote user's joystick [-1,1] */
+	FVector2D Axes;
+};
+
+/** A textbox submission recorded in an FMixerInputFrame. */
+struct FMixerTextboxInput
+{
+	/** Same handle as IMixerInteractivityModule::ResolveTextbox returns for the textbox's name. */
+	FMixerTextboxHandle Textbox;
+
+	/** Mixer id of the remote user, or 0 if they weren't known. */
+	uint32 ParticipantId;
+
+	/** Number of sparks that will be charged for this interaction, if confirmed */
+	uint32 SparkCost;
+
+	/** Index into FMixerInputFrame::TransactionIds, or INDEX_NONE if there is no transaction. */
+	int32 TransactionIndex;
+
+	/** Index into FMixerInputFrame::SubmittedTexts */
+	int32 TextIndex;
+};
+
+/**
+* All button, joystick and textbox input received since the previous frame, in
+* arrival order per kind.  Records are plain data and independent of each other,
+* so they may be walked from worker threads (e.g. via ParallelFor) for as long as
+* the frame is being delivered.  Variable length fields are kept to the side so
+* the record arrays stay densely packed.
+*/
+struct FMixerInputFrame
+{
+	TArray<FMixerButtonInput> Buttons;
+	TArray<FMixerStickInput> Sticks;
+	TArray<FMixerTextboxInput> TextboxSubmits;
+
+	/** Spark transaction ids referenced by Buttons and TextboxSubmits. */
+	TArray<FString> TransactionIds;
+
+	/** Text referenced by TextboxSubmits. */
+	TArray<FText> SubmittedTexts;
+
+	bool IsEmpty() const
+	{
+		return Buttons.Num() == 0 && Sticks.Num() == 0 && TextboxSubmits.Num() == 0;
+	}
+
+	/** Empty the frame while keeping its allocations for the next one. */
+	void Reset()
+	{
+		Buttons.Reset();
+		Sticks.Reset();
+		TextboxSubmits.Reset();
+		TransactionIds.Reset();
+		SubmittedTexts.Reset();
+	}
+};
+
+/** Distribution of round trip times between sending a method to the Mixer service and receiving its reply. */
+struct FMixerReplyLatencyHistogram
+{
+public:
+	/** Bucket i counts replies that took less than 2^i * 8ms; the last bucket is unbounded. */
+	static const int32 NumBuckets = 12;
+
+	FMixerReplyLatencyHistogram()
+		: Count(0)
+		, TimedOut(0)
+		, Evicted(0)
+		, TotalSeconds(0.0)
+		, MaxSeconds(0.0)
+	{
+		FMemory::Memzero(Buckets);
+	}
+
+	void AddSample(double Seconds)
+	{
+		int32 Bucket = 0;
+		while (Bucket < NumBuckets - 1 && Seconds >= GetBucketUpperBoundSeconds(Bucket))
+		{
+			++Bucket;
+		}
+		++Buckets[Bucket];
+		++Count;
+		TotalSeconds += Seconds;
+		MaxSeconds = FMath::Max(MaxSeconds, Seconds);
+	}
+
+	static double GetBucketUpperBoundSeconds(int32 Bucket)
+	{
+		return Bucket < NumBuckets - 1 ? static_cast<double>(8 << Bucket) / 1000.0 : MAX_dbl;
+	}
+
+	double GetAverageSeconds() const
+	{
+		return Count > 0 ? TotalSeconds / Count : 0.0;
+	}
+
+public:
+	int32 Buckets[NumBuckets];
+
+	/** Number of replies received. */
+	int32 Count;
+
+	/** Number of requests abandoned because no reply arrived in time. */
+	int32 TimedOut;
+
+	/** Number of fire-and-forget requests no longer tracked to make room for newer ones. */
+	int32 Evicted;
+
+	double TotalSeconds;
+	double MaxSeconds;
+};
+
+/**
+* Snapshot of outgoing traffic to the Mixer service.  Titles that issue many
+* control updates can use this to back off when the connection is saturated.
+*/
+struct FMixerOutgoingMessageStats
+{
+	/** Number of messages waiting for send budget. */
+	int32 QueuedMessages;
+
+	/** Size in bytes (UTF-8) of all messages waiting for send budget. */
+	int32 QueuedBytes;
+
+	/** Number of sent messages for which no reply has been received yet. */
+	int32 AwaitingReply;
+
+	/** Total number of messages sent over the current session. */
+	int32 SentMessages;
+
+	/** Total size in bytes (UTF-8) of messages sent over the current session. */
+	int64 SentBytes;
+
+	/** Total number of requests abandoned because no reply arrived in time. */
+	int32 TimedOutReplies;
+
+	/** Total number of requests no longer tracked to make room for newer ones (not counted as timed out). */
+	int32 EvictedReplies;
+
+	/** Reply round trip times, keyed by method name. */
+	TMap<FString, FMixerReplyLatencyHistogram> ReplyLatencyByMethod;
+};
+
 enum class EMixerLoginState : uint8
 {
 	Not_Logged_In,
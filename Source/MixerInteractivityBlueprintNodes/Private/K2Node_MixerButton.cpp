@@ -50,6 +50,10 @@ void UK2Node_MixerButton::ExpandNode(FKismetCompilerContext& CompilerContext, UE
 	UK2Node_TemporaryVariable* IntermediateParticipantNode = nullptr;
 	UK2Node_TemporaryVariable* IntermediateTransactionNode = nullptr;
 	UK2Node_TemporaryVariable* IntermediateCostNode = nullptr;
+	UK2Node_TemporaryVariable* IntermediatePressCountNode = nullptr;
+
+	// Only coalesced events have a press count
+	UEdGraphPin* PressCountPin = FindPin(TEXT("PressCount"));
 
 	const UEdGraphSchema_K2* Schema = CompilerContext.GetSchema();
 
@@ -72,6 +76,13 @@ void UK2Node_MixerButton::ExpandNode(FKismetCompilerContext& CompilerContext, UE
 		IntermediateCostNode = CompilerContext.SpawnIntermediateNode<UK2Node_TemporaryVariable>(this, SourceGraph);
 		IntermediateCostNode->VariableType.PinCategory = Schema->PC_Int;
 		IntermediateCostNode->AllocateDefaultPins();
+
+		if (PressCountPin != nullptr)
+		{
+			IntermediatePressCountNode = CompilerContext.SpawnIntermediateNode<UK2Node_TemporaryVariable>(this, SourceGraph);
+			IntermediatePressCountNode->VariableType.PinCategory = Schema->PC_Int;
+			IntermediatePressCountNode->AllocateDefaultPins();
+		}
 	}
 
 	auto ExpandEventPin = [&](UEdGraphPin* OriginalPin, bool IsPressedEvent)
@@ -79,8 +90,11 @@ void UK2Node_MixerButton::ExpandNode(FKismetCompilerContext& CompilerContext, UE
 		UK2Node_MixerButtonEvent* ButtonEvent = CompilerContext.SpawnIntermediateEventNode<UK2Node_MixerButtonEvent>(this, OriginalPin, SourceGraph);
 		ButtonEvent->ButtonId = ButtonId;
 		ButtonEvent->Pressed = IsPressedEvent;
+		ButtonEvent->Coalescing = Coalescing;
 		ButtonEvent->CustomFunctionName = FName(*FString::Printf(TEXT("MixerButtonEvt_%s_%s"), *ButtonId.ToString(), IsPressedEvent ? TEXT("Pressed") : TEXT("Released")));
-		ButtonEvent->EventReference.SetExternalDelegateMember(FName(TEXT("MixerButtonEventDynamicDelegate__DelegateSignature")));
+		ButtonEvent->EventReference.SetExternalDelegateMember(FName(Coalescing == EMixerButtonEventCoalescing::OncePerFrame
+			? TEXT("MixerCoalescedButtonEventDynamicDelegate__DelegateSignature")
+			: TEXT("MixerButtonEventDynamicDelegate__DelegateSignature")));
 		ButtonEvent->bInternalEvent = true;
 		ButtonEvent->AllocateDefaultPins();
 
@@ -110,7 +124,15 @@ void UK2Node_MixerButton::ExpandNode(FKismetCompilerContext& CompilerContext, UE
 			Schema->TryCreateConnection(TransactionAssignment->GetThenPin(), ParticipantAssignment->GetExecPin());
 			Schema->TryCreateConnection(CostAssignment->GetThenPin(), TransactionAssignment->GetExecPin());
 
-			Schema->TryCreateConnection(Schema->FindExecutionPin(*ButtonEvent, EGPD_Output), CostAssignment->GetExecPin());
+			UK2Node_AssignmentStatement* FirstAssignment = CostAssignment;
+			if (IntermediatePressCountNode)
+			{
+				UK2Node_AssignmentStatement* PressCountAssignment = MoveNodeToIntermediate(TEXT("PressCount"), IntermediatePressCountNode);
+				Schema->TryCreateConnection(PressCountAssignment->GetThenPin(), CostAssignment->GetExecPin());
+				FirstAssignment = PressCountAssignment;
+			}
+
+			Schema->TryCreateConnection(Schema->FindExecutionPin(*ButtonEvent, EGPD_Output), FirstAssignment->GetExecPin());
 		}
 		else
 		{
@@ -119,6 +141,10 @@ void UK2Node_MixerButton::ExpandNode(FKismetCompilerContext& CompilerContext, UE
 			CompilerContext.MovePinLinksToIntermediate(*FindPin(TEXT("ParticipantId")), *ButtonEvent->FindPin(TEXT("ParticipantId")));
 			CompilerContext.MovePinLinksToIntermediate(*FindPin(TEXT("TransactionId")), *ButtonEvent->FindPin(TEXT("TransactionId")));
 			CompilerContext.MovePinLinksToIntermediate(*FindPin(TEXT("SparkCost")), *ButtonEvent->FindPin(TEXT("SparkCost")));
+			if (PressCountPin != nullptr)
+			{
+				CompilerContext.MovePinLinksToIntermediate(*PressCountPin, *ButtonEvent->FindPinChecked(TEXT("PressCount")));
+			}
 		}
 	};
 
@@ -182,6 +208,10 @@ void UK2Node_MixerButton::AllocateDefaultPins()
 	CreatePin(EGPD_Output, K2Schema->PC_Exec, FPinSubCategoryParamType(), nullptr, TEXT("Released"));
 	CreatePin(EGPD_Output, K2Schema->PC_Struct, FPinSubCategoryParamType(), FMixerButtonReference::StaticStruct(), TEXT("Button"));
 	CreatePin(EGPD_Output, K2Schema->PC_Int, FPinSubCategoryParamType(), nullptr, TEXT("ParticipantId"));
+	if (Coalescing == EMixerButtonEventCoalescing::OncePerFrame)
+	{
+		CreatePin(EGPD_Output, K2Schema->PC_Int, FPinSubCategoryParamType(), nullptr, TEXT("PressCount"));
+	}
 
 	// Advanced pins
 	UEdGraphPin* AdvancedPin = CreatePin(EGPD_Output, K2Schema->PC_Struct, FPinSubCategoryParamType(), FMixerTransactionId::StaticStruct(), TEXT("TransactionId"));
@@ -192,6 +222,18 @@ void UK2Node_MixerButton::AllocateDefaultPins()
 	Super::AllocateDefaultPins();
 }
 
+void UK2Node_MixerButton::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+
+	if (PropertyChangedEvent.GetPropertyName() == GET_MEMBER_NAME_CHECKED(UK2Node_MixerButton, Coalescing))
+	{
+		// Adds or removes the PressCount pin
+		ReconstructNode();
+		FBlueprintEditorUtils::MarkBlueprintAsModified(GetBlueprint());
+	}
+}
+
 FLinearColor UK2Node_MixerButton::GetNodeTitleColor() const
 {
 	return GetDefault<UGraphEditorSettings>()->EventNodeTitleColor;
@@ -41,7 +41,6 @@ void UK2Node_MixerStickEvent::GetMenuActions(FBlueprintActionDatabaseRegistrar&
 		UK2Node_MixerStickEvent* MixerNode = CastChecked<UK2Node_MixerStickEvent>(NewNode);
 		MixerNode->StickId = *StickName;
 		MixerNode->CustomFunctionName = FName(*FString::Printf(TEXT("MixerStickEvt_%s"), *StickName));
-		MixerNode->EventReference.SetExternalDelegateMember(FName(TEXT("MixerStickEventDynamicDelegate__DelegateSignature")));
 	};
 
 	UClass* ActionKey = GetClass();
@@ -63,6 +62,28 @@ FText UK2Node_MixerStickEvent::GetMenuCategory() const
 	return LOCTEXT("MixerStickNode_MenuCategory", "{MixerInteractivity}|Stick Events");
 }
 
+void UK2Node_MixerStickEvent::AllocateDefaultPins()
+{
+	// The signature follows the coalescing mode, which can be changed after the node is placed
+	const TCHAR* SignatureName = Coalescing == EMixerStickEventCoalescing::LatestPerParticipant
+		? TEXT("MixerStickFrameEventDynamicDelegate__DelegateSignature")
+		: TEXT("MixerStickEventDynamicDelegate__DelegateSignature");
+	EventReference.SetExternalDelegateMember(FName(SignatureName));
+
+	Super::AllocateDefaultPins();
+}
+
+void UK2Node_MixerStickEvent::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+
+	if (PropertyChangedEvent.GetPropertyName() == GET_MEMBER_NAME_CHECKED(UK2Node_MixerStickEvent, Coalescing))
+	{
+		ReconstructNode();
+		FBlueprintEditorUtils::MarkBlueprintAsModified(GetBlueprint());
+	}
+}
+
 FText UK2Node_MixerStickEvent::GetNodeTitle(ENodeTitleType::Type TitleType) const
 {
 	if (CachedNodeTitle.IsOutOfDate(this))
@@ -98,6 +119,7 @@ void UK2Node_MixerStickEvent::RegisterDynamicBinding(UDynamicBlueprintBinding* B
 	BindingInfo.TargetFunctionName = CustomFunctionName;
 	BindingInfo.NameParam = StickId;
 	BindingInfo.BindingType = EMixerGenericEventBindingType::Stick;
+	BindingInfo.StickCoalescing = Coalescing;
 
 	UMixerDelegateBinding* MixerBindingObject = CastChecked<UMixerDelegateBinding>(BindingObject);
 	MixerBindingObject->AddGenericBinding(BindingInfo);
@@ -11,6 +11,7 @@
 
 #include "K2Node.h"
 #include "EdGraph/EdGraphNodeUtils.h"
+#include "MixerDynamicDelegateBinding.h"
 
 #include "K2Node_MixerButton.generated.h"
 
@@ -23,8 +24,12 @@ public:
 	UPROPERTY()
 	FName ButtonId;
 
+	/** Deliver at most one Pressed and one Released event per frame rather than one per use, with a PressCount. */
+	UPROPERTY(EditAnywhere, Category = "Mixer")
+	EMixerButtonEventCoalescing Coalescing;
+
 	//~ Begin UK2Node Interface.
-	virtual bool ShouldShowNodeProperties() const override { return false; }
+	virtual bool ShouldShowNodeProperties() const override { return true; }
 	virtual void ValidateNodeDuringCompilation(class FCompilerResultsLog& MessageLog) const override;
 	virtual void ExpandNode(FKismetCompilerContext& CompilerContext, UEdGraph* SourceGraph) override;
 	virtual void GetMenuActions(FBlueprintActionDatabaseRegistrar& ActionRegistrar) const override;
@@ -41,6 +46,10 @@ public:
 	virtual bool IsCompatibleWithGraph(UEdGraph const* Graph) const override;
 	//~ End UEdGraphNode Interface.
 
+	//~ Begin UObject Interface.
+	virtual void PostEditChangeProperty(struct FPropertyChangedEvent& PropertyChangedEvent) override;
+	//~ End UObject Interface.
+
 private:
 	/** Constructing FText strings can be costly, so we cache the node's title/tooltip */
 	FNodeTextCache CachedTooltip;
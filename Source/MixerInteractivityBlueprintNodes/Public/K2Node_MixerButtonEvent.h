@@ -11,6 +11,7 @@
 #pragma once
 
 #include "K2Node_Event.h"
+#include "MixerDynamicDelegateBinding.h"
 #include "K2Node_MixerButtonEvent.generated.h"
 
 UCLASS(MinimalAPI)
@@ -25,6 +26,9 @@ public:
 	UPROPERTY()
 	bool Pressed;
 
+	UPROPERTY()
+	EMixerButtonEventCoalescing Coalescing;
+
 	virtual UClass* GetDynamicBindingClass() const override;
 	virtual void RegisterDynamicBinding(UDynamicBlueprintBinding* BindingObject) const override;
 
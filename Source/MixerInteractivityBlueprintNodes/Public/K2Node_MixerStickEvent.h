@@ -11,6 +11,7 @@
 #pragma once
 
 #include "K2Node_Event.h"
+#include "MixerDynamicDelegateBinding.h"
 #include "K2Node_MixerStickEvent.generated.h"
 
 UCLASS(MinimalAPI)
@@ -22,19 +23,31 @@ public:
 	UPROPERTY()
 	FName StickId;
 
+	/**
+	* Deliver one event per frame rather than one per move.  LatestPerParticipant events carry an
+	* array of moves instead of a single participant and position.
+	*/
+	UPROPERTY(EditAnywhere, Category = "Mixer")
+	EMixerStickEventCoalescing Coalescing;
+
 	//~ Begin UK2Node Interface.
-	virtual bool ShouldShowNodeProperties() const override { return false; }
+	virtual bool ShouldShowNodeProperties() const override { return true; }
 	virtual void ValidateNodeDuringCompilation(class FCompilerResultsLog& MessageLog) const override;
 	virtual void GetMenuActions(FBlueprintActionDatabaseRegistrar& ActionRegistrar) const override;
 	virtual FText GetMenuCategory() const override;
 	//~ End UK2Node Interface
 
 	//~ Begin UEdGraphNode Interface.
+	virtual void AllocateDefaultPins() override;
 	virtual FText GetNodeTitle(ENodeTitleType::Type TitleType) const override;
 	virtual FText GetTooltipText() const override;
 	virtual FSlateIcon GetIconAndTint(FLinearColor& OutColor) const override;
 	//~ End UEdGraphNode Interface.
 
+	//~ Begin UObject Interface.
+	virtual void PostEditChangeProperty(struct FPropertyChangedEvent& PropertyChangedEvent) override;
+	//~ End UObject Interface.
+
 	virtual UClass* GetDynamicBindingClass() const override;
 	virtual void RegisterDynamicBinding(UDynamicBlueprintBinding* BindingObject) const override;
 